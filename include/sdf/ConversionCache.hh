@@ -0,0 +1,131 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDF_CONVERSIONCACHE_HH_
+#define SDF_CONVERSIONCACHE_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <gz/utils/ImplPtr.hh>
+
+#include "sdf/SDFImpl.hh"
+#include "sdf/sdf_config.h"
+#include "sdf/system_util.hh"
+
+namespace sdf
+{
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  // Forward declarations.
+  class ParserConfig;
+
+  /// \brief Cache on disk of the element trees of files that are converted
+  /// from an older version of SDFormat when they are read.
+  ///
+  /// When a cache is set on a ParserConfig with
+  /// ParserConfig::SetConversionCache, a file that is converted while it is
+  /// read by sdf::readFile is saved to the cache directory with
+  /// SDF::SaveBinary. Later reads of a file with the same content load the
+  /// element tree from the cache instead of parsing, converting and reading
+  /// the XML. Entries are keyed by a SHA-256 hash of the path and content of
+  /// the file, which includes its version, of the SDFormat version it is
+  /// converted to, of the version of libsdformat, and of the policies of the
+  /// parser configuration, and the path stored in an entry is checked when
+  /// it is loaded. Only files that are read without errors, and that
+  /// do not include other files, are cached. Warnings that are printed when
+  /// a file is read are not printed again when it is loaded from the cache.
+  ///
+  /// The size of the cache directory is limited. When an entry is added and
+  /// the entries exceed the limit, the least recently used entries are
+  /// removed.
+  ///
+  /// A cache directory may be shared by several processes on one machine.
+  /// Entries are written to temporary files that are renamed into place, so
+  /// they are never read while they are written. An entry that can not be
+  /// read, for example because another process removed it, is a cache miss.
+  /// A cache object may be shared by any number of ParserConfig objects, and
+  /// is safe to use from multiple threads.
+  class SDFORMAT_VISIBLE ConversionCache
+  {
+    /// \brief Constructor.
+    /// \param[in] _directory Directory of the cache. It is created when the
+    /// first entry is added.
+    public: explicit ConversionCache(const std::string &_directory);
+
+    /// \brief Get the directory of the cache.
+    /// \return Directory of the cache.
+    public: const std::string &Directory() const;
+
+    /// \brief Set the maximum size of the entries of the cache.
+    /// \param[in] _size Size in bytes. Default is 256 MiB.
+    public: void SetMaxSize(std::uintmax_t _size);
+
+    /// \brief Get the maximum size of the entries of the cache.
+    /// \return Size in bytes.
+    /// \sa SetMaxSize
+    public: std::uintmax_t MaxSize() const;
+
+    /// \brief Load the element tree of a file from the cache. Nothing is
+    /// loaded if the SDF object already has child elements.
+    /// \param[in] _path Resolved path of the file.
+    /// \param[in] _data Content of the file.
+    /// \param[in] _size Size of the content in bytes.
+    /// \param[in] _config Parser configuration the file is read with.
+    /// \param[in,out] _sdf SDF object, initialized with sdf::init, that the
+    /// element tree is loaded into.
+    /// \return True if the element tree was loaded from the cache.
+    public: bool Find(const std::string &_path, const char *_data,
+                      std::size_t _size, const ParserConfig &_config,
+                      SDFPtr _sdf);
+
+    /// \brief Add the element tree read from a file to the cache. Nothing is
+    /// added if the file was not converted, or if the tree contains elements
+    /// read from other files.
+    /// \param[in] _path Resolved path of the file.
+    /// \param[in] _data Content of the file.
+    /// \param[in] _size Size of the content in bytes.
+    /// \param[in] _config Parser configuration the file was read with.
+    /// \param[in] _sdf SDF object the file was read into.
+    public: void Insert(const std::string &_path, const char *_data,
+                        std::size_t _size, const ParserConfig &_config,
+                        const SDFPtr &_sdf);
+
+    /// \brief Remove every entry from the cache directory. The hit and miss
+    /// counters are not reset.
+    public: void Clear();
+
+    /// \brief Get the size of the entries in the cache directory.
+    /// \return Size in bytes.
+    public: std::uintmax_t Size() const;
+
+    /// \brief Get the number of lookups by this object that loaded an
+    /// element tree from the cache.
+    /// \return Number of cache hits.
+    public: uint64_t Hits() const;
+
+    /// \brief Get the number of lookups by this object that did not load an
+    /// element tree from the cache.
+    /// \return Number of cache misses.
+    public: uint64_t Misses() const;
+
+    /// \brief Private data pointer.
+    GZ_UTILS_UNIQUE_IMPL_PTR(dataPtr)
+  };
+  }
+}
+#endif
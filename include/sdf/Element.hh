@@ -18,10 +18,13 @@
 #define SDF_ELEMENT_HH_
 
 #include <any>
+#include <cstddef>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -69,6 +72,115 @@ namespace sdf
   /// \addtogroup sdf
   /// \{
 
+  /// \class ElementIterator Element.hh sdf/sdf.hh
+  /// \brief Iterator over the child elements of an Element, optionally
+  /// restricted to the child elements with a given name. Dereferencing
+  /// returns the child element by value, so it stays valid even if child
+  /// elements are inserted while iterating.
+  /// \sa Element::Children
+  class SDFORMAT_VISIBLE ElementIterator
+  {
+    public: using iterator_category = std::input_iterator_tag;
+    public: using value_type = ElementPtr;
+    public: using difference_type = std::ptrdiff_t;
+    public: using pointer = const ElementPtr *;
+    public: using reference = ElementPtr;
+
+    /// \brief Default constructor, which is equal to an end iterator.
+    public: ElementIterator() = default;
+
+    /// \brief Constructor.
+    /// \param[in] _elements Child elements to iterate over.
+    /// \param[in] _index Index of the first child element to consider.
+    /// \param[in] _name Only visit child elements with this name, or all
+    /// child elements if empty.
+    public: ElementIterator(const ElementPtr_V *_elements, std::size_t _index,
+                            const std::string &_name);
+
+    /// \brief Get the current child element.
+    /// \return The current child element.
+    public: reference operator*() const;
+
+    /// \brief Access the current child element.
+    /// \return Pointer to the current child element.
+    public: pointer operator->() const;
+
+    /// \brief Advance to the next matching child element.
+    /// \return This iterator.
+    public: ElementIterator &operator++();
+
+    /// \brief Advance to the next matching child element.
+    /// \return A copy of this iterator before it was advanced.
+    public: ElementIterator operator++(int);
+
+    /// \brief Equality operator. All iterators past the last matching child
+    /// element are equal.
+    /// \param[in] _other Iterator to compare with.
+    /// \return True if both iterators refer to the same child element.
+    public: bool operator==(const ElementIterator &_other) const;
+
+    /// \brief Inequality operator.
+    /// \param[in] _other Iterator to compare with.
+    /// \return True if the iterators refer to different child elements.
+    public: bool operator!=(const ElementIterator &_other) const;
+
+    /// \brief Move to the first matching child element at or after the
+    /// current index.
+    private: void SkipToMatch();
+
+    /// \brief Child elements that are iterated over.
+    private: const ElementPtr_V *elements = nullptr;
+
+    /// \brief Index of the current child element.
+    private: std::size_t index = 0;
+
+    /// \brief Name filter, empty to visit all child elements.
+    private: std::string name;
+
+    /// \brief Interned copy of the name filter, set once a child element
+    /// matches it.
+    private: const std::string *internedName = nullptr;
+  };
+
+  /// \class ElementRange Element.hh sdf/sdf.hh
+  /// \brief Range over the child elements of an Element, optionally
+  /// restricted to the child elements with a given name. It can be used in
+  /// a range-based for loop:
+  ///
+  ///     for (const sdf::ElementPtr &link : model->Children("link"))
+  ///
+  /// The range refers to the child elements of the Element, which must
+  /// outlive it. Child elements that are inserted while iterating are
+  /// visited, but removing child elements while iterating may skip some.
+  /// \sa Element::Children
+  class SDFORMAT_VISIBLE ElementRange
+  {
+    /// \brief Constructor.
+    /// \param[in] _elements Child elements to iterate over.
+    /// \param[in] _name Only visit child elements with this name, or all
+    /// child elements if empty.
+    public: ElementRange(const ElementPtr_V *_elements,
+                         const std::string &_name);
+
+    /// \brief Get an iterator to the first matching child element.
+    /// \return Iterator to the first matching child element.
+    public: ElementIterator begin() const;
+
+    /// \brief Get an iterator past the last matching child element.
+    /// \return End iterator.
+    public: ElementIterator end() const;
+
+    /// \brief Check if there are no matching child elements.
+    /// \return True if there are no matching child elements.
+    public: bool empty() const;
+
+    /// \brief Child elements that are iterated over.
+    private: const ElementPtr_V *elements;
+
+    /// \brief Name filter, empty to visit all child elements.
+    private: std::string name;
+  };
+
   /// \class Element Element.hh sdf/sdf.hh
   /// \brief SDF Element class
   class SDFORMAT_VISIBLE Element :
@@ -81,10 +193,14 @@ namespace sdf
     public: virtual ~Element();
 
     /// \brief Create a copy of this Element.
+    /// Attributes, values and child elements are deep copied, while element
+    /// descriptions are shared with this Element.
     /// \return A copy of this Element.
     public: ElementPtr Clone() const;
 
     /// \brief Create a copy of this Element.
+    /// Attributes, values and child elements are deep copied, while element
+    /// descriptions are shared with this Element.
     /// \param[out] _errors Vector of errors.
     /// \return A copy of this Element, NULL if there was an error.
     public: ElementPtr Clone(sdf::Errors &_errors) const;
@@ -375,12 +491,16 @@ namespace sdf
     /// \return The number of element descriptions.
     public: size_t GetElementDescriptionCount() const;
 
-    /// \brief Get an element description using an index
+    /// \brief Get an element description using an index.
+    /// Element descriptions are shared between all elements created from
+    /// the same schema, so the result should be cloned before modifying it.
     /// \param[in] _index the index of the element description to get.
     /// \return An Element pointer to the found element.
     public: ElementPtr GetElementDescription(unsigned int _index) const;
 
-    /// \brief Get an element description using a key
+    /// \brief Get an element description using a key.
+    /// Element descriptions are shared between all elements created from
+    /// the same schema, so the result should be cloned before modifying it.
     /// \param[in] _key the key to use to find the element.
     /// \return An Element pointer to the found element.
     public: ElementPtr GetElementDescription(const std::string &_key) const;
@@ -524,8 +644,16 @@ namespace sdf
     /// This can be used in combination with GetFirstElement() to walk the SDF
     /// tree. First call parent->GetFirstElement() to get the first child. Call
     /// child = child->GetNextElement() to iterate through the children.
+    /// Children() is a simpler alternative for iterating through children.
     public: ElementPtr GetNextElement(const std::string &_name = "") const;
 
+    /// \brief Get a range over the child elements, for use in a range-based
+    /// for loop.
+    /// \param[in] _name if given then only child elements with this name are
+    /// visited.
+    /// \return Range over the matching child elements.
+    public: ElementRange Children(const std::string &_name = "") const;
+
     /// \brief Get set of child element type names.
     /// \return A set of the names of the child elements.
     public: std::set<std::string> GetElementTypeNames() const;
@@ -802,7 +930,8 @@ namespace sdf
     /// \param[in] _desc the text description to set for the element.
     public: void SetDescription(const std::string &_desc);
 
-    /// \brief Add a new element description
+    /// \brief Add a new element description. Only the descriptions of this
+    /// Element are modified, even if they are shared with other elements.
     /// \param[in] _elem the Element object to add to the descriptions.
     public: void AddElementDescription(ElementPtr _elem);
 
@@ -862,20 +991,36 @@ namespace sdf
 
     /// \brief Private data pointer
     private: std::unique_ptr<ElementPrivate> dataPtr;
+
+    /// \brief ElementPrivate keeps the position of child elements up to date.
+    friend class ElementPrivate;
   };
 
   /// \internal
   /// \brief Private data for Element
   class ElementPrivate
   {
-    /// \brief Element name
-    public: std::string name;
+    /// \brief Allocate private data from the arena of the document being
+    /// parsed, or from the heap if documents are not using an arena.
+    /// \param[in] _size Number of bytes to allocate.
+    /// \return Pointer to the allocated memory.
+    /// \sa ParserConfig::SetUseDocumentArena
+    public: static SDFORMAT_VISIBLE void *operator new(std::size_t _size);
+
+    /// \brief Release private data allocated by operator new.
+    /// \param[in] _ptr Pointer to release.
+    public: static SDFORMAT_VISIBLE void operator delete(void *_ptr) noexcept;
+
+    /// \brief Element name. This and the other raw string pointers below
+    /// point into the process-wide string pool, so copying them is cheap and
+    /// equal strings are stored once.
+    public: const std::string *name;
 
     /// \brief True if element is required
-    public: std::string required;
+    public: const std::string *required;
 
-    /// \brief Element description
-    public: std::string description;
+    /// \brief Element description, shared with clones of this element.
+    public: std::shared_ptr<const std::string> description;
 
     /// \brief True if element's children should be copied.
     public: bool copyChildren;
@@ -892,9 +1037,44 @@ namespace sdf
     // The existing child elements
     public: ElementPtr_V elements;
 
-    // The possible child elements
+    // The possible child elements. The description nodes are shared with
+    // clones of this element and must not be modified in place.
     public: ElementPtr_V elementDescriptions;
 
+    /// \brief Index from child element name to the first child element with
+    /// that name. It is only kept once the number of child elements reaches
+    /// kElementIndexThreshold, and is empty otherwise.
+    public: std::unordered_map<std::string, ElementPtr> elementIndex;
+
+    /// \brief Index from element description name to the first element
+    /// description with that name. It is shared along with the element
+    /// descriptions, and copied before a description is added if another
+    /// element shares it.
+    public: std::shared_ptr<std::unordered_map<std::string, ElementPtr>>
+        elementDescriptionIndex;
+
+    /// \brief Number of child elements from which elementIndex is kept.
+    /// Linear search is faster than hashing for fewer child elements.
+    public: static constexpr std::size_t kElementIndexThreshold = 8;
+
+    /// \brief Position of this element in the child elements of its parent,
+    /// used to find the next sibling without searching. It is only valid if
+    /// the parent's child element at this position is this element.
+    public: std::size_t indexInParent = 0;
+
+    /// \brief Append a child element and update the child element index.
+    /// \param[in] _elem Child element to append.
+    public: void PushElement(const ElementPtr &_elem);
+
+    /// \brief Remove a child element and update the child element index
+    /// and the position of the following child elements.
+    /// \param[in] _iter Iterator to the child element to remove.
+    public: void EraseElement(ElementPtr_V::const_iterator _iter);
+
+    /// \brief Rebuild the child element index after child elements were
+    /// removed or renamed.
+    public: void RebuildElementIndex();
+
     /// \brief The <include> element that was used to load this entity. For
     /// example, given the following SDFormat:
     /// <sdf version='1.8'>
@@ -918,13 +1098,14 @@ namespace sdf
     public: ElementPtr includeElement;
 
     /// \brief Name of reference sdf.
-    public: std::string referenceSDF;
+    public: const std::string *referenceSDF;
 
-    /// \brief Path to file where this element came from
-    public: std::string path;
+    /// \brief Path to file where this element came from, shared with the
+    /// child elements read from the same file.
+    public: std::shared_ptr<const std::string> path;
 
     /// \brief Spec version that this was originally parsed from.
-    public: std::string originalVersion;
+    public: const std::string *originalVersion;
 
     /// \brief True if the element was set in the SDF file.
     public: bool explicitlySetInFile;
@@ -1032,13 +1213,13 @@ namespace sdf
       {
         param->Get(result.first, _errors);
       }
-      else if (this->HasElement(_key))
+      else if (ElementPtr child = this->GetElementImpl(_key))
       {
-        result.first = this->GetElementImpl(_key)->Get<T>(_errors);
+        result.first = child->Get<T>(_errors);
       }
-      else if (this->HasElementDescription(_key))
+      else if (ElementPtr desc = this->GetElementDescription(_key))
       {
-        result.first = this->GetElementDescription(_key)->Get<T>(_errors);
+        result.first = desc->Get<T>(_errors);
       }
       else
       {
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDF_FINDFILECACHE_HH_
+#define SDF_FINDFILECACHE_HH_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <gz/utils/ImplPtr.hh>
+
+#include "sdf/Error.hh"
+#include "sdf/Types.hh"
+#include "sdf/sdf_config.h"
+#include "sdf/system_util.hh"
+
+namespace sdf
+{
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  /// \brief Cache of the paths found by sdf::findFile.
+  ///
+  /// When a cache is set on a ParserConfig with
+  /// ParserConfig::SetFindFileCache, each URI is searched for in the URI
+  /// paths, the install paths, SDF_PATH and the find file callback only
+  /// once. Later lookups of the same URI with the same search flags from the
+  /// same working directory return the path that was found, which is empty
+  /// if the file was not found, along with the errors that were reported.
+  /// Entries are discarded when the SDFormat version being parsed changes,
+  /// when they are older than the time to live, or when
+  /// ParserConfig::SetFindCallback or ParserConfig::AddURIPath is called on
+  /// a configuration that uses the cache. Entries that depend on SDF_PATH
+  /// must be invalidated by the caller when it changes.
+  ///
+  /// Entries are not keyed by the URI paths or the find file callback of the
+  /// configuration, so a cache must only be shared by ParserConfig objects
+  /// with the same URI paths and callback, such as copies of one
+  /// configuration. A cache is safe to use from multiple threads.
+  class SDFORMAT_VISIBLE FindFileCache
+  {
+    /// \brief Default constructor. The cache is empty, and its entries do
+    /// not expire.
+    public: FindFileCache();
+
+    /// \brief Set how long entries are kept.
+    /// \param[in] _timeToLive Time after which an entry is discarded, or zero
+    /// to keep entries until they are invalidated.
+    public: void SetTimeToLive(std::chrono::steady_clock::duration _timeToLive);
+
+    /// \brief Get how long entries are kept.
+    /// \return Time after which an entry is discarded, or zero if entries are
+    /// kept until they are invalidated.
+    public: std::chrono::steady_clock::duration TimeToLive() const;
+
+    /// \brief Find the path that was found for a URI from the current
+    /// working directory.
+    /// \param[in] _uri URI or file name that was searched for.
+    /// \param[in] _searchLocalPath True if the working directory was
+    /// searched.
+    /// \param[in] _useCallback True if the find file callback was used.
+    /// \param[out] _path Path that was found, or an empty string if the file
+    /// was not found.
+    /// \param[out] _errors Errors reported when the URI was searched for are
+    /// appended to this vector.
+    /// \return True if the URI is cached.
+    public: bool Find(const std::string &_uri, bool _searchLocalPath,
+                      bool _useCallback, std::string &_path,
+                      sdf::Errors &_errors);
+
+    /// \brief Add the path found for a URI from the current working
+    /// directory to the cache.
+    /// \param[in] _uri URI or file name that was searched for.
+    /// \param[in] _searchLocalPath True if the working directory was
+    /// searched.
+    /// \param[in] _useCallback True if the find file callback was used.
+    /// \param[in] _path Path that was found, or an empty string if the file
+    /// was not found.
+    /// \param[in] _errors Errors reported when the URI was searched for.
+    /// \param[in] _probes Number of filesystem probes and calls to the find
+    /// file callback made to search for the URI.
+    public: void Insert(const std::string &_uri, bool _searchLocalPath,
+                        bool _useCallback, const std::string &_path,
+                        const sdf::Errors &_errors, uint64_t _probes);
+
+    /// \brief Remove a URI from the cache, whatever the search flags.
+    /// \param[in] _uri URI or file name that was searched for.
+    /// \return True if the URI was cached.
+    public: bool Invalidate(const std::string &_uri);
+
+    /// \brief Remove every URI from the cache. The counters are not reset.
+    public: void Clear();
+
+    /// \brief Get the number of cached lookups.
+    /// \return Number of cached lookups.
+    public: uint64_t Size() const;
+
+    /// \brief Get the number of lookups that returned a cached path.
+    /// \return Number of cache hits.
+    public: uint64_t Hits() const;
+
+    /// \brief Get the number of lookups that did not return a cached path.
+    /// \return Number of cache misses.
+    public: uint64_t Misses() const;
+
+    /// \brief Get the number of filesystem probes and calls to the find file
+    /// callback made by lookups that were added to the cache.
+    /// \return Number of probes made.
+    public: uint64_t Probes() const;
+
+    /// \brief Get the number of filesystem probes and calls to the find file
+    /// callback that cache hits avoided.
+    /// \return Number of probes saved.
+    public: uint64_t ProbesSaved() const;
+
+    /// \brief Private data pointer.
+    GZ_UTILS_UNIQUE_IMPL_PTR(dataPtr)
+  };
+  }
+}
+#endif
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDF_INCLUDECACHE_HH_
+#define SDF_INCLUDECACHE_HH_
+
+#include <cstdint>
+#include <string>
+
+#include <gz/utils/ImplPtr.hh>
+
+#include "sdf/Element.hh"
+#include "sdf/Error.hh"
+#include "sdf/sdf_config.h"
+#include "sdf/system_util.hh"
+
+namespace sdf
+{
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  /// \brief Cache of the element trees read from files referenced by
+  /// <include> tags.
+  ///
+  /// When a cache is set on a ParserConfig with
+  /// ParserConfig::SetIncludeCache, each included file is found, loaded,
+  /// converted and read only once. Later includes of the same file receive a
+  /// clone of the element tree, along with the errors that were reported when
+  /// the file was first read. Entries are keyed by the resolved path of the
+  /// file, and are discarded when the SDFormat version being parsed changes,
+  /// or when the modification time of the file, or of any file it includes,
+  /// changes.
+  ///
+  /// Entries are not keyed by the configuration they were read with, so a
+  /// cache must only be shared by ParserConfig objects that find files and
+  /// enforce policies in the same way, i.e. that have the same find
+  /// callback, URI paths and policies. A cache is safe to use from multiple
+  /// threads.
+  class SDFORMAT_VISIBLE IncludeCache
+  {
+    /// \brief Default constructor. The cache is empty.
+    public: IncludeCache();
+
+    /// \brief Find the element tree that was read from a file.
+    /// \param[in] _path Resolved path of the file.
+    /// \param[out] _errors Errors reported when the file was read are
+    /// appended to this vector.
+    /// \return Clone of the root element read from the file, or nullptr if
+    /// the file is not cached, or if it or a file it includes has been
+    /// modified since it was cached.
+    public: ElementPtr Find(const std::string &_path, sdf::Errors &_errors);
+
+    /// \brief Add the element tree read from a file to the cache. Nothing is
+    /// added if the modification time of the file can not be read.
+    /// \param[in] _path Resolved path of the file.
+    /// \param[in] _root Root element read from the file. The cache stores a
+    /// clone of it.
+    /// \param[in] _errors Errors reported when the file was read.
+    public: void Insert(const std::string &_path, const ElementPtr &_root,
+                        const sdf::Errors &_errors);
+
+    /// \brief Remove a file from the cache.
+    /// \param[in] _path Resolved path of the file.
+    /// \return True if the file was cached.
+    public: bool Invalidate(const std::string &_path);
+
+    /// \brief Remove every file from the cache. The hit and miss counters are
+    /// not reset.
+    public: void Clear();
+
+    /// \brief Get the number of cached files.
+    /// \return Number of cached files.
+    public: uint64_t Size() const;
+
+    /// \brief Get the number of lookups that returned a cached element tree.
+    /// \return Number of cache hits.
+    public: uint64_t Hits() const;
+
+    /// \brief Get the number of lookups that did not return a cached element
+    /// tree.
+    /// \return Number of cache misses.
+    public: uint64_t Misses() const;
+
+    /// \brief Private data pointer.
+    GZ_UTILS_UNIQUE_IMPL_PTR(dataPtr)
+  };
+  }
+}
+#endif
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDF_MODELINDEX_HH_
+#define SDF_MODELINDEX_HH_
+
+#include <cstdint>
+#include <string>
+
+#include <gz/utils/ImplPtr.hh>
+
+#include "sdf/Error.hh"
+#include "sdf/Types.hh"
+#include "sdf/sdf_config.h"
+#include "sdf/system_util.hh"
+
+namespace sdf
+{
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  // Forward declarations.
+  class ParserConfig;
+
+  /// \brief Index of the model directories found in the search paths of a
+  /// ParserConfig.
+  ///
+  /// Build scans each directory of ParserConfig::URIPathMap and SDF_PATH
+  /// once, and records the names of its entries and, for every model
+  /// directory, the model file best supported by the current SDFormat
+  /// version. When an index is set on a ParserConfig with
+  /// ParserConfig::SetModelIndex, sdf::findFile answers whether a name such
+  /// as the one in model://name exists in an indexed directory without
+  /// probing the filesystem, and the model file of an included model
+  /// directory is taken from the index instead of its model.config. Names
+  /// with several path components, such as model://name/meshes/mesh.dae,
+  /// and directories that are not indexed are searched for as usual.
+  ///
+  /// The index is not updated when the indexed directories change. Calling
+  /// Build again rescans the directories whose modification time changed,
+  /// which is the case when entries are added to or removed from them, but
+  /// not when a model.config file is edited. An index can be saved to and
+  /// loaded from a file, so that the directories are scanned only when they
+  /// change.
+  ///
+  /// An index may be shared by any number of ParserConfig objects, and is
+  /// safe to use from multiple threads.
+  class SDFORMAT_VISIBLE ModelIndex
+  {
+    /// \brief Default constructor. The index is empty.
+    public: ModelIndex();
+
+    /// \brief Scan the directories of ParserConfig::URIPathMap and SDF_PATH
+    /// that are not indexed yet, or whose modification time changed since
+    /// they were indexed.
+    /// \param[in] _config Configuration whose search paths are indexed.
+    /// \param[in] _threadCount Maximum number of threads used to read the
+    /// model.config files of the model directories.
+    /// \return Errors reported while scanning the directories. Errors in
+    /// model.config files are not reported here, but when the models are
+    /// included.
+    public: sdf::Errors Build(const ParserConfig &_config,
+                              unsigned int _threadCount = 1);
+
+    /// \brief Save the index to a file.
+    /// \param[in] _filename Path of the file.
+    /// \return Errors, if any.
+    public: sdf::Errors Save(const std::string &_filename) const;
+
+    /// \brief Load an index saved with Save, replacing the content of this
+    /// index. An index saved for another SDFormat version is not loaded.
+    /// \param[in] _filename Path of the file.
+    /// \return Errors, if any.
+    public: sdf::Errors Load(const std::string &_filename);
+
+    /// \brief Remove every directory from the index.
+    public: void Clear();
+
+    /// \brief Get whether a directory is indexed.
+    /// \param[in] _directory Path of the directory, as it appears in the
+    /// search paths.
+    /// \return True if the directory is indexed.
+    public: bool IsIndexed(const std::string &_directory) const;
+
+    /// \brief Get whether an indexed directory contains an entry.
+    /// \param[in] _directory Path of an indexed directory.
+    /// \param[in] _name Name of the entry.
+    /// \return True if the directory contains an entry with the name.
+    public: bool Contains(const std::string &_directory,
+                          const std::string &_name) const;
+
+    /// \brief Get the model file of a model directory, that is best
+    /// supported by the current SDFormat version.
+    /// \param[in] _modelDirectory Path of the model directory, which is an
+    /// entry of an indexed directory.
+    /// \return Path of the model file, or an empty string if the directory is
+    /// not an indexed model directory, or its model file could not be
+    /// determined.
+    public: std::string ModelFile(const std::string &_modelDirectory) const;
+
+    /// \brief Get the number of indexed directories.
+    /// \return Number of indexed directories.
+    public: uint64_t DirectoryCount() const;
+
+    /// \brief Get the number of indexed model directories.
+    /// \return Number of model directories with a model file.
+    public: uint64_t ModelCount() const;
+
+    /// \brief Private data pointer.
+    GZ_UTILS_UNIQUE_IMPL_PTR(dataPtr)
+  };
+  }
+}
+#endif
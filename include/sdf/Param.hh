@@ -21,15 +21,21 @@
 #include <any>
 #include <algorithm>
 #include <cctype>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iomanip>
 #include <limits>
+#include <locale>
 #include <memory>
 #include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <typeinfo>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -75,6 +81,7 @@ namespace sdf
 
   /// \internal
   class ParamPrivate;
+  class ParamDescriptor;
 
   template<class T>
   struct ParamStreamer
@@ -405,7 +412,9 @@ namespace sdf
 
     /// \brief Set the parameter's value.
     ///
-    /// The passed in value value must have an input and output stream operator.
+    /// A value of the parameter's type is stored directly. Any other value
+    /// must have an input and output stream operator, and is converted
+    /// through its string form.
     /// \param[in] _value The value to set the parameter to.
     /// \return True if the value was successfully set.
     public: template<typename T>
@@ -413,7 +422,9 @@ namespace sdf
 
     /// \brief Set the parameter's value.
     ///
-    /// The passed in value value must have an input and output stream operator.
+    /// A value of the parameter's type is stored directly. Any other value
+    /// must have an input and output stream operator, and is converted
+    /// through its string form.
     /// \param[in] _value The value to set the parameter to.
     /// \param[out] _errors Vector of errors.
     /// \return True if the value was successfully set.
@@ -492,6 +503,10 @@ namespace sdf
       return _out;
     }
 
+    /// \brief Binary documents store values without converting them to
+    /// strings.
+    friend class BinaryDocument;
+
     /// \brief Private data
     private: std::unique_ptr<ParamPrivate> dataPtr;
   };
@@ -500,31 +515,90 @@ namespace sdf
   /// \brief Private data for the param class
   class ParamPrivate
   {
-    /// \brief Key value
-    public: std::string key;
+    /// \brief Allocate private data from the arena of the document being
+    /// parsed, or from the heap if documents are not using an arena.
+    /// \param[in] _size Number of bytes to allocate.
+    /// \return Pointer to the allocated memory.
+    /// \sa ParserConfig::SetUseDocumentArena
+    public: static SDFORMAT_VISIBLE void *operator new(std::size_t _size);
+
+    /// \brief Release private data allocated by operator new.
+    /// \param[in] _ptr Pointer to release.
+    public: static SDFORMAT_VISIBLE void operator delete(void *_ptr) noexcept;
+
+    /// \brief Metadata from the SDFormat description of the parameter. It is
+    /// shared by every copy of the parameter, and is replaced rather than
+    /// modified.
+    public: std::shared_ptr<const ParamDescriptor> descriptor;
+
+    /// \brief Type of a parameter value, resolved once from the type name so
+    /// that parsing, printing and validating values does not compare strings.
+    public: enum class ValueType : std::uint8_t
+    {
+      /// \brief The type name is not recognized.
+      UNKNOWN,
 
-    /// \brief True if the parameter is required.
-    public: bool required;
+      /// \brief bool
+      BOOL,
 
-    /// \brief True if the parameter is set.
-    public: bool set;
+      /// \brief char
+      CHAR,
 
-    //// \brief Name of the type.
-    public: std::string typeName;
+      /// \brief std::string
+      STRING,
 
-    /// \brief Description of the parameter.
-    public: std::string description;
+      /// \brief int
+      INT,
+
+      /// \brief std::uint64_t
+      UINT64,
+
+      /// \brief unsigned int
+      UNSIGNED_INT,
+
+      /// \brief double
+      DOUBLE,
+
+      /// \brief float
+      FLOAT,
+
+      /// \brief sdf::Time
+      TIME,
+
+      /// \brief gz::math::Angle
+      ANGLE,
+
+      /// \brief gz::math::Color
+      COLOR,
+
+      /// \brief gz::math::Vector2i
+      VECTOR2I,
+
+      /// \brief gz::math::Vector2d
+      VECTOR2D,
+
+      /// \brief gz::math::Vector3d
+      VECTOR3D,
+
+      /// \brief gz::math::Quaterniond
+      QUATERNION,
+
+      /// \brief gz::math::Pose3d
+      POSE
+    };
 
     /// \brief Parent element.
     public: ElementWeakPtr parentElement;
 
-    /// \brief Update function pointer.
-    public: std::function<std::any ()> updateFunc;
+    /// \brief Update function, allocated when one is set since few
+    /// parameters have one.
+    public: std::shared_ptr<const std::function<std::any ()>> updateFunc;
 
     /// \def ParamVariant
     /// \brief Variant type def.
-    /// Note: When a new variant is added, add variant to functions
-    /// ParamPrivate::TypeToString, ParamPrivate::ValueFromStringImpl,
+    /// Note: When a new variant is added, add variant to ValueType and to
+    /// functions ParamPrivate::TypeToString, ParamPrivate::TypeToValueType,
+    /// ParamPrivate::ValueTypeFromString, ParamPrivate::ValueFromStringImpl,
     /// and template std::ostream operator if new variant is floating point
     public: typedef std::variant<bool, char, std::string, int, std::uint64_t,
                                    unsigned int, double, float, sdf::Time,
@@ -539,26 +613,19 @@ namespace sdf
     /// \brief This parameter's value
     public: ParamVariant value;
 
+    /// \brief True if the parameter is set.
+    public: bool set;
+
     /// \brief True if the value has been parsed while ignoring its parent
     /// element's attributes, and will continue to ignore them for subsequent
     /// reparses.
     public: bool ignoreParentAttributes;
 
-    /// \brief This parameter's value that was provided as a string
+    /// \brief This parameter's value that was provided as a string, or
+    /// nullopt if the value is the default or was set from a value of the
+    /// parameter's type.
     public: std::optional<std::string> strValue;
 
-    /// \brief This parameter's default value that was provided as a string
-    public: std::string defaultStrValue;
-
-    /// \brief This parameter's default value
-    public: ParamVariant defaultValue;
-
-    /// \brief This parameter's minimum allowed value
-    public: std::optional<ParamVariant> minValue;
-
-    /// \brief This parameter's maximum allowed value
-    public: std::optional<ParamVariant> maxValue;
-
     /// \brief Initializer function to help Param constructors.
     /// \param[in] _key Key for the parameter.
     /// \param[in] _typeName String name for the value type (double,
@@ -600,6 +667,18 @@ namespace sdf
                                     ParamVariant &_valueToSet,
                                     sdf::Errors &_errors) const;
 
+    /// \brief Method used to set the Param from a passed-in string
+    /// \param[in] _type The data type of the value to set
+    /// \param[in] _valueStr The value as a string
+    /// \param[out] _valueToSet The value to set
+    /// \param[out] _errors Vector of errors.
+    /// \return True if the value was successfully set, false otherwise
+    public: bool SDFORMAT_VISIBLE ValueFromStringImpl(
+                                    ValueType _type,
+                                    std::string_view _valueStr,
+                                    ParamVariant &_valueToSet,
+                                    sdf::Errors &_errors) const;
+
     /// \brief Method used to get the string representation from a ParamVariant,
     /// or the string that was used to set it.
     /// \param[in] _config Print configuration for the string output
@@ -615,10 +694,85 @@ namespace sdf
                 std::string &_valueStr,
                 sdf::Errors &_errors) const;
 
+    /// \brief Method used to get the string representation from a ParamVariant,
+    /// or the string that was used to set it.
+    /// \param[in] _config Print configuration for the string output
+    /// \param[in] _type The data type of the value
+    /// \param[in] _value The value
+    /// \param[out] _valueStr The output string.
+    /// \param[out] _errors Vector of errors.
+    /// \return True if the string was successfully retrieved, false otherwise.
+    public: bool StringFromValueImpl(
+                const PrintConfig &_config,
+                ValueType _type,
+                const ParamVariant &_value,
+                std::string &_valueStr,
+                sdf::Errors &_errors) const;
+
+    /// \brief Resolve a type name, such as "double" or "vector3", to a value
+    /// type.
+    /// \param[in] _typeName The type name.
+    /// \return The value type, or ValueType::UNKNOWN.
+    public: static SDFORMAT_VISIBLE ValueType ValueTypeFromString(
+                const std::string &_typeName);
+
+    /// \brief Data type to value type mapping
+    /// \return The value type, or ValueType::UNKNOWN if T is not one of the
+    /// types of ParamVariant.
+    public: template<typename T>
+            static constexpr ValueType TypeToValueType();
+
     /// \brief Data type to string mapping
     /// \return The type as a string, empty string if unknown type
     public: template<typename T>
             static std::string TypeToString();
+
+    /// \brief Check that a value could also have been parsed from its
+    /// string form. Angles, vectors, quaternions and poses are rejected
+    /// when they have non-finite components.
+    /// \param[in] _value The value to check.
+    /// \return True if the value can be stored.
+    public: template<typename T>
+            static bool IsParsableValue(const T &_value);
+  };
+
+  /// \internal
+  /// \brief Metadata of a parameter that comes from its SDFormat
+  /// description. A descriptor is created when a parameter is constructed,
+  /// and is shared by all of the parameter's copies and clones, so that
+  /// parameters created from the same attribute or value description only
+  /// store their own value.
+  class ParamDescriptor
+  {
+    /// \brief Key value. This and typeName point into the process-wide
+    /// string pool, so copying them is cheap and equal strings are stored
+    /// once.
+    public: const std::string *key;
+
+    //// \brief Name of the type.
+    public: const std::string *typeName;
+
+    /// \brief Description of the parameter.
+    public: std::string description;
+
+    /// \brief Type of the value, resolved from typeName.
+    public: ParamPrivate::ValueType valueType =
+                ParamPrivate::ValueType::UNKNOWN;
+
+    /// \brief True if the parameter is required.
+    public: bool required;
+
+    /// \brief This parameter's default value that was provided as a string
+    public: std::string defaultStrValue;
+
+    /// \brief This parameter's default value
+    public: ParamPrivate::ParamVariant defaultValue;
+
+    /// \brief This parameter's minimum allowed value
+    public: std::optional<ParamPrivate::ParamVariant> minValue;
+
+    /// \brief This parameter's maximum allowed value
+    public: std::optional<ParamPrivate::ParamVariant> maxValue;
   };
 
   ///////////////////////////////////////////////
@@ -662,11 +816,83 @@ namespace sdf
       return "";
   }
 
+  ///////////////////////////////////////////////
+  template<typename T>
+  constexpr ParamPrivate::ValueType ParamPrivate::TypeToValueType()
+  {
+    if constexpr (std::is_same_v<T, bool>)
+      return ValueType::BOOL;
+    else if constexpr (std::is_same_v<T, char>)
+      return ValueType::CHAR;
+    else if constexpr (std::is_same_v<T, std::string>)
+      return ValueType::STRING;
+    else if constexpr (std::is_same_v<T, int>)
+      return ValueType::INT;
+    else if constexpr (std::is_same_v<T, std::uint64_t>)
+      return ValueType::UINT64;
+    else if constexpr (std::is_same_v<T, unsigned int>)
+      return ValueType::UNSIGNED_INT;
+    else if constexpr (std::is_same_v<T, double>)
+      return ValueType::DOUBLE;
+    else if constexpr (std::is_same_v<T, float>)
+      return ValueType::FLOAT;
+    else if constexpr (std::is_same_v<T, sdf::Time>)
+      return ValueType::TIME;
+    else if constexpr (std::is_same_v<T, gz::math::Angle>)
+      return ValueType::ANGLE;
+    else if constexpr (std::is_same_v<T, gz::math::Color>)
+      return ValueType::COLOR;
+    else if constexpr (std::is_same_v<T, gz::math::Vector2i>)
+      return ValueType::VECTOR2I;
+    else if constexpr (std::is_same_v<T, gz::math::Vector2d>)
+      return ValueType::VECTOR2D;
+    else if constexpr (std::is_same_v<T, gz::math::Vector3d>)
+      return ValueType::VECTOR3D;
+    else if constexpr (std::is_same_v<T, gz::math::Quaterniond>)
+      return ValueType::QUATERNION;
+    else if constexpr (std::is_same_v<T, gz::math::Pose3d>)
+      return ValueType::POSE;
+    else
+      return ValueType::UNKNOWN;
+  }
+
+  ///////////////////////////////////////////////
+  template<typename T>
+  bool ParamPrivate::IsParsableValue(const T &_value)
+  {
+    if constexpr (std::is_same_v<T, gz::math::Angle>)
+    {
+      return std::isfinite(_value.Radian());
+    }
+    else if constexpr (std::is_same_v<T, gz::math::Vector2d>)
+    {
+      return std::isfinite(_value.X()) && std::isfinite(_value.Y());
+    }
+    else if constexpr (std::is_same_v<T, gz::math::Vector3d>)
+    {
+      return _value.IsFinite();
+    }
+    else if constexpr (std::is_same_v<T, gz::math::Quaterniond>)
+    {
+      return std::isfinite(_value.W()) && std::isfinite(_value.X()) &&
+             std::isfinite(_value.Y()) && std::isfinite(_value.Z());
+    }
+    else if constexpr (std::is_same_v<T, gz::math::Pose3d>)
+    {
+      return IsParsableValue(_value.Pos()) && IsParsableValue(_value.Rot());
+    }
+    else
+    {
+      return true;
+    }
+  }
+
   ///////////////////////////////////////////////
   template<typename T>
   void Param::SetUpdateFunc(T _updateFunc)
   {
-    this->dataPtr->updateFunc = _updateFunc;
+    this->dataPtr->updateFunc =
+        std::make_shared<const std::function<std::any ()>>(_updateFunc);
   }
 
   ///////////////////////////////////////////////
@@ -684,9 +910,41 @@ namespace sdf
   template<typename T>
   bool Param::Set(const T &_value, sdf::Errors &_errors)
   {
+    // A value of the parameter's own type is stored as is. Its string form
+    // is only generated when it is asked for, and no precision is lost.
+    constexpr ParamPrivate::ValueType type =
+        ParamPrivate::TypeToValueType<T>();
+    if constexpr (type != ParamPrivate::ValueType::UNKNOWN &&
+                  type != ParamPrivate::ValueType::STRING)
+    {
+      if (type == this->dataPtr->descriptor->valueType)
+      {
+        this->dataPtr->ignoreParentAttributes = true;
+        if (!ParamPrivate::IsParsableValue(_value))
+        {
+          _errors.push_back({ErrorCode::PARAMETER_ERROR,
+              "Unable to set parameter[" + *this->dataPtr->descriptor->key +
+              "], values must be finite."});
+          return false;
+        }
+
+        ParamPrivate::ParamVariant oldValue = _value;
+        std::swap(oldValue, this->dataPtr->value);
+        if (!this->ValidateValue(_errors))
+        {
+          this->dataPtr->value = std::move(oldValue);
+          return false;
+        }
+        this->dataPtr->strValue = std::nullopt;
+        this->dataPtr->set = true;
+        return true;
+      }
+    }
+
     try
     {
       std::stringstream ss;
+      ss.imbue(std::locale::classic());
       ss << ParamStreamer<T>{_value, std::numeric_limits<int>::max()};
       return this->SetFromString(ss.str(), true, _errors);
     }
@@ -694,7 +952,7 @@ namespace sdf
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
           "Unable to set parameter["
-          + this->dataPtr->key + "]."
+          + *this->dataPtr->descriptor->key + "]."
           + "Type used must have a stream input and output operator,"
           + "which allows proper functioning of Param."});
       return false;
@@ -723,8 +981,9 @@ namespace sdf
     }
     else
     {
-      std::string typeStr = this->dataPtr->TypeToString<T>();
-      if (typeStr.empty())
+      constexpr ParamPrivate::ValueType type =
+          ParamPrivate::TypeToValueType<T>();
+      if (type == ParamPrivate::ValueType::UNKNOWN)
       {
         _errors.push_back({ErrorCode::UNKNOWN_PARAMETER_TYPE,
             "Unknown parameter type[" + std::string(typeid(T).name()) + "]"});
@@ -734,7 +993,7 @@ namespace sdf
       std::string valueStr = this->GetAsString(_errors);
       ParamPrivate::ParamVariant pv;
       bool success = this->dataPtr->ValueFromStringImpl(
-          typeStr, valueStr, pv, _errors);
+          type, valueStr, pv, _errors);
 
       if (success)
       {
@@ -752,7 +1011,7 @@ namespace sdf
   bool Param::GetDefault(T &_value) const
   {
     sdf::Errors errors;
-    bool result = this>GetDefault<T>(_value, errors);
+    bool result = this->GetDefault<T>(_value, errors);
     if (!errors.empty())
       sdferr << errors;
     return result;
@@ -762,11 +1021,24 @@ namespace sdf
   template<typename T>
   bool Param::GetDefault(T &_value, sdf::Errors &_errors) const
   {
+    // Strings are read with operator>> below, which stops at whitespace,
+    // so they keep going through the stream.
+    if constexpr (!std::is_same_v<T, std::string>)
+    {
+      if (const T *value =
+              std::get_if<T>(&this->dataPtr->descriptor->defaultValue))
+      {
+        _value = *value;
+        return true;
+      }
+    }
+
     std::stringstream ss;
+    ss.imbue(std::locale::classic());
 
     try
     {
-      ss << ParamStreamer{this->dataPtr->defaultValue,
+      ss << ParamStreamer{this->dataPtr->descriptor->defaultValue,
                           std::numeric_limits<int>::max()};
       ss >> _value;
     }
@@ -774,9 +1046,9 @@ namespace sdf
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
           "Unable to convert parameter["
-          + this->dataPtr->key + "] "
+          + *this->dataPtr->descriptor->key + "] "
           + "whose type is["
-          + this->dataPtr->typeName + "], to "
+          + *this->dataPtr->descriptor->typeName + "], to "
           + "type[" + typeid(T).name() + "]"});
       return false;
     }
@@ -20,6 +20,7 @@
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -72,6 +73,14 @@ enum class ConfigureResolveAutoInertials
 // Forward declare private data class.
 class ParserConfigPrivate;
 
+class ConversionCache;
+
+class FindFileCache;
+
+class IncludeCache;
+
+class ModelIndex;
+
 /// This class contains configuration options for the libsdformat parser.
 ///
 /// The configuration options include:
@@ -241,6 +250,109 @@ class SDFORMAT_VISIBLE ParserConfig
   /// store them.  False to preserve original URIs
   public: bool StoreResolvedURIs() const;
 
+  /// \brief Set whether documents are parsed into a per-document arena.
+  /// \param[in] _useArena True to place the Elements and Params of each
+  /// parsed document into a monotonic arena owned by that document. The
+  /// arena is released in bulk once the last Element of the document is
+  /// destroyed. This trades memory that is never reused while the document
+  /// is alive for faster loading and teardown of large documents. Default is
+  /// false.
+  public: void SetUseDocumentArena(bool _useArena);
+
+  /// \brief Get whether documents are parsed into a per-document arena.
+  /// \return True if parsed documents use an arena.
+  /// \sa SetUseDocumentArena
+  public: bool UseDocumentArena() const;
+
+  /// \brief Set the cache of files read through <include> tags. Copies of
+  /// this configuration share the cache. A cache must only be shared by
+  /// configurations that find files and enforce policies the same way.
+  /// \param[in] _cache Cache to use, or nullptr to read every included file
+  /// from disk. Default is nullptr.
+  /// \sa IncludeCache
+  public: void SetIncludeCache(std::shared_ptr<sdf::IncludeCache> _cache);
+
+  /// \brief Get the cache of files read through <include> tags.
+  /// \return The cache, or nullptr if included files are not cached.
+  /// \sa SetIncludeCache
+  public: std::shared_ptr<sdf::IncludeCache> IncludeCache() const;
+
+  /// \brief Set the cache of paths found by sdf::findFile. Copies of this
+  /// configuration share the cache. The cache is cleared when
+  /// SetFindCallback or AddURIPath is called. A cache must not be shared
+  /// with configurations that have other URI paths or find callbacks.
+  /// \param[in] _cache Cache to use, or nullptr to search for every file.
+  /// Default is nullptr.
+  /// \sa FindFileCache
+  public: void SetFindFileCache(std::shared_ptr<sdf::FindFileCache> _cache);
+
+  /// \brief Get the cache of paths found by sdf::findFile.
+  /// \return The cache, or nullptr if found paths are not cached.
+  /// \sa SetFindFileCache
+  public: std::shared_ptr<sdf::FindFileCache> FindFileCache() const;
+
+  /// \brief Set the index of the model directories in the search paths.
+  /// Copies of this configuration share the index.
+  /// \param[in] _index Index to use, or nullptr to search the filesystem for
+  /// every file. Default is nullptr.
+  /// \sa ModelIndex
+  public: void SetModelIndex(std::shared_ptr<sdf::ModelIndex> _index);
+
+  /// \brief Get the index of the model directories in the search paths.
+  /// \return The index, or nullptr if there is none.
+  /// \sa SetModelIndex
+  public: std::shared_ptr<sdf::ModelIndex> ModelIndex() const;
+
+  /// \brief Set the cache on disk of files that are converted from an older
+  /// version of SDFormat when they are read. Copies of this configuration
+  /// share the cache.
+  /// \param[in] _cache Cache to use, or nullptr to convert every file when
+  /// it is read. Default is nullptr.
+  /// \sa ConversionCache
+  public: void SetConversionCache(
+              std::shared_ptr<sdf::ConversionCache> _cache);
+
+  /// \brief Get the cache on disk of converted files.
+  /// \return The cache, or nullptr if converted files are not cached.
+  /// \sa SetConversionCache
+  public: std::shared_ptr<sdf::ConversionCache> ConversionCache() const;
+
+  /// \brief Set the number of threads used to read files referenced by
+  /// <include> tags. When it is larger than one, the files included by the
+  /// children of an element are found, loaded and read concurrently before
+  /// the children are processed in document order, so the resulting
+  /// document and errors are the same as when files are read one at a
+  /// time. Files included by those files are read by the same thread. The
+  /// find file callback and custom model parsers may then be called from
+  /// several threads at once, and must be thread-safe.
+  /// \param[in] _count Maximum number of threads. Zero or one reads
+  /// included files on the calling thread. Default is zero.
+  public: void SetIncludeWorkerCount(unsigned int _count);
+
+  /// \brief Get the number of threads used to read files referenced by
+  /// <include> tags.
+  /// \return Maximum number of threads. Zero or one if included files are
+  /// read on the calling thread.
+  /// \sa SetIncludeWorkerCount
+  public: unsigned int IncludeWorkerCount() const;
+
+  /// \brief Set whether SDFormat files and strings are read with a
+  /// streaming reader, which builds elements as the XML is read instead of
+  /// parsing the whole document with tinyxml2 first. This saves the memory
+  /// and the time taken by the intermediate document, and the resulting
+  /// elements and errors are the same. Documents with <include> tags,
+  /// documents that are converted from an older version, URDF, and XML
+  /// that the streaming reader does not handle, such as CDATA sections, are
+  /// parsed with tinyxml2 instead.
+  /// \param[in] _use True to use the streaming reader. Default is false.
+  public: void SetUseStreamingReader(bool _use);
+
+  /// \brief Get whether SDFormat files and strings are read with a
+  /// streaming reader.
+  /// \return True if the streaming reader is used.
+  /// \sa SetUseStreamingReader
+  public: bool UseStreamingReader() const;
+
   /// \brief Private data pointer.
   GZ_UTILS_IMPL_PTR(dataPtr)
 };
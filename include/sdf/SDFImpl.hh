@@ -174,6 +174,32 @@ namespace sdf
     public: void Write(const std::string &_filename);
     public: void Write(sdf::Errors &_errors, const std::string &_filename);
 
+    /// \brief Write the elements to a compact binary file, from which
+    /// LoadBinary restores them without parsing XML, converting the document
+    /// or resolving its includes. The file keeps the typed values of the
+    /// parameters, the strings they were parsed from, the line numbers and
+    /// XML paths of the elements, and the include elements of included
+    /// entities. It can only be read by the version of the library that
+    /// wrote it.
+    /// \param[out] _errors Vector of errors.
+    /// \param[in] _filename Name of the file to write.
+    public: void SaveBinary(sdf::Errors &_errors,
+                            const std::string &_filename) const;
+
+    /// \brief Replace the elements with those of a binary file written by
+    /// SaveBinary. The elements are the same as those of the document that
+    /// was saved, including their schema, so the result can be loaded with
+    /// sdf::Root::Load. Nothing is changed on error.
+    /// \param[out] _errors Vector of errors.
+    /// \param[in] _filename Name of the file to read.
+    /// \param[in] _config Custom parser configuration, which is used to load
+    /// the schema, and to place the elements in a document arena if
+    /// enabled.
+    public: void LoadBinary(sdf::Errors &_errors,
+                            const std::string &_filename,
+                            const ParserConfig &_config =
+                                ParserConfig::GlobalConfig());
+
     /// \brief Output SDF's values to stdout.
     /// \param[in] _config Configuration for printing the values.
     public: void PrintValues(const PrintConfig &_config = PrintConfig());
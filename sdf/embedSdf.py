@@ -3,12 +3,14 @@
 Script for generating a C++ file that contains the content from all SDF files
 """
 
-from typing import List, Optional
+from typing import Dict, List, Optional, Tuple
 
 import argparse
 import inspect
+import re
 import sys
 from pathlib import Path, PurePosixPath
+from xml.dom import minidom
 
 
 # The list of supported SDF specification versions. This will let us drop
@@ -110,10 +112,12 @@ def embed_sdf_content(arg_path: str, arg_file_content: str) -> str:
     return NEWLINE.join(res)
 
 
-def get_file_header_epilog() -> str:
+def get_file_header_epilog(schema_content: str) -> str:
     """
-    Provides the return statement and the closing brackets of the C++ file
+    Provides the return statement, the schema tables and the closing brackets
+    of the C++ file
 
+    :param schema_content: C++ code of the schema tables
     :returns: epilog of the C++ file
     """
     res = inspect.cleandoc(
@@ -123,21 +127,363 @@ def get_file_header_epilog() -> str:
         return result;
     }
 
+    """
+    )
+    end = inspect.cleandoc(
+        """
     }
     }  // namespace sdf
 
     """
     )
-    return NEWLINE + res
+    return NEWLINE + res + 2 * NEWLINE + schema_content + NEWLINE + end
+
+
+def cpp_string(arg_value: Optional[str]) -> str:
+    """
+    Converts a string to a C++ string literal, split into chunks so that
+    long descriptions stay within compiler limits on literal length
+
+    :param arg_value: String to convert, or None
+    :returns: C++ string literal, or nullptr if the string is None
+    """
+    if arg_value is None:
+        return "nullptr"
+    chunks = []
+    chunk = ""
+    for byte in arg_value.encode("utf8"):
+        if byte == ord("\\"):
+            chunk += "\\\\"
+        elif byte == ord('"'):
+            chunk += '\\"'
+        elif byte == ord("\n"):
+            chunk += "\\n"
+        elif byte < 0x20 or byte >= 0x7F or byte == ord("?"):
+            # Octal escapes are always three digits, so they can not merge
+            # with the characters that follow. '?' is escaped to avoid
+            # trigraphs.
+            chunk += f"\\{byte:03o}"
+        else:
+            chunk += chr(byte)
+        if len(chunk) >= 80:
+            chunks.append(f'"{chunk}"')
+            chunk = ""
+    if chunk or not chunks:
+        chunks.append(f'"{chunk}"')
+    return (NEWLINE + INDENTATION).join(chunks)
+
+
+def collapse_whitespace(arg_text: str) -> str:
+    """
+    Collapses whitespace the way tinyxml2 does when the parser reads the
+    spec files, so that the tables give the same descriptions
+
+    :param arg_text: Text to collapse
+    :returns: text without leading and trailing whitespace, and with each run
+        of inner whitespace replaced by a single space
+    """
+    whitespace = " \t\n\v\f\r"
+    return re.sub(f"[{whitespace}]+", " ", arg_text).strip(whitespace)
+
+
+def description_text(arg_element: minidom.Element) -> Optional[str]:
+    """
+    Gets the text of the first description child of an element, matching
+    tinyxml2's GetText: only a leading text or CDATA node counts, and CDATA
+    is kept verbatim
+
+    :param arg_element: Element whose description is read
+    :returns: description text, or None if there is none
+    """
+    for child in arg_element.childNodes:
+        if (child.nodeType == minidom.Node.ELEMENT_NODE
+                and child.tagName == "description"):
+            first = child.firstChild
+            if first is None:
+                return None
+            if first.nodeType == minidom.Node.CDATA_SECTION_NODE:
+                return first.data
+            if first.nodeType == minidom.Node.TEXT_NODE:
+                return collapse_whitespace(first.data)
+            return None
+    return None
+
+
+def child_elements(arg_element: minidom.Element, arg_tag: str) -> List[minidom.Element]:
+    """
+    Gets the direct children of an element with the given tag name
+
+    :param arg_element: Parent element
+    :param arg_tag: Tag name of the children
+    :returns: children in document order
+    """
+    return [
+        child
+        for child in arg_element.childNodes
+        if child.nodeType == minidom.Node.ELEMENT_NODE and child.tagName == arg_tag
+    ]
 
 
-def write_output(file_content: str, output_filename: str) -> None:
+class SchemaTables:
+    """
+    Flattened description of the spec files of one SDFormat version. Each
+    <element> of the spec appears once in the element table, and each file
+    is walked once; includes refer to the root element of the included file,
+    so the tables form a DAG that the parser expands into a tree.
+    """
+
+    def __init__(self, arg_files: Dict[str, Path]):
+        """
+        :param arg_files: Map from spec file name, such as "model.sdf", to
+            its path
+        """
+        self.files = arg_files
+        self.file_roots: Dict[str, int] = {}
+        self.elements: List[Optional[Tuple]] = []
+        self.attributes: List[Tuple] = []
+        self.children: List[Tuple[int, Optional[str]]] = []
+
+    def add_file(self, arg_name: str) -> int:
+        """
+        Adds a spec file and everything it includes to the tables
+
+        :param arg_name: Spec file name
+        :returns: index of the root element of the file
+        """
+        if arg_name in self.file_roots:
+            return self.file_roots[arg_name]
+        if arg_name not in self.files:
+            raise ValueError(f"Spec file [{arg_name}] is not available")
+        document = minidom.parse(str(self.files[arg_name]))
+        document.normalize()
+        roots = child_elements(document, "element")
+        if len(roots) != 1:
+            raise ValueError(f"Spec file [{arg_name}] must have one root element")
+        index = self.add_element(roots[0], arg_name)
+        self.file_roots[arg_name] = index
+        return index
+
+    def add_element(self, arg_xml: minidom.Element, arg_file: str) -> int:
+        """
+        Adds an <element> of the spec to the tables
+
+        :param arg_xml: XML of the element
+        :param arg_file: Spec file of the element, for error messages
+        :returns: index of the element
+        """
+        def attribute(arg_node: minidom.Element, arg_name: str) -> Optional[str]:
+            if not arg_node.hasAttribute(arg_name):
+                return None
+            value = arg_node.getAttribute(arg_name)
+            if any(c in value for c in "\t\n\r"):
+                # XML parsers normalize whitespace in attribute values, but
+                # tinyxml2 does not, so the tables could differ.
+                raise ValueError(
+                    f"Attribute [{arg_name}] in [{arg_file}] contains whitespace "
+                    "other than spaces")
+            return value
+
+        name = attribute(arg_xml, "name")
+        required = attribute(arg_xml, "required")
+        if name is None or required is None:
+            raise ValueError(
+                f"Element in [{arg_file}] is missing the name or required attribute")
+
+        # Reserve the slot so that parents come before their children.
+        index = len(self.elements)
+        self.elements.append(None)
+
+        description = description_text(arg_xml)
+        value_type = attribute(arg_xml, "type")
+        value = None
+        if value_type is not None:
+            default = attribute(arg_xml, "default")
+            if default is None:
+                raise ValueError(
+                    f"Element [{name}] in [{arg_file}] has a type but no default")
+            value = (
+                value_type,
+                default,
+                required == "1",
+                attribute(arg_xml, "min") or "",
+                attribute(arg_xml, "max") or "",
+            )
+
+        first_attribute = len(self.attributes)
+        for child in child_elements(arg_xml, "attribute"):
+            attr_name = attribute(child, "name")
+            attr_type = attribute(child, "type")
+            attr_default = attribute(child, "default")
+            attr_required = attribute(child, "required")
+            if None in (attr_name, attr_type, attr_default, attr_required):
+                raise ValueError(
+                    f"Attribute of [{name}] in [{arg_file}] is missing the name, "
+                    "type, default or required attribute")
+            self.attributes.append((
+                attr_name,
+                attr_type,
+                attr_default,
+                attr_required.strip() == "1",
+                description_text(child) or "",
+            ))
+        attribute_count = len(self.attributes) - first_attribute
+
+        copy_children = False
+        children: List[Tuple[int, Optional[str]]] = []
+        for child in child_elements(arg_xml, "element"):
+            copy_data = attribute(child, "copy_data")
+            if copy_data in ("true", "1"):
+                copy_children = True
+            else:
+                children.append((self.add_element(child, arg_file), None))
+        for child in child_elements(arg_xml, "include"):
+            filename = attribute(child, "filename")
+            if filename is None:
+                raise ValueError(f"Include in [{arg_file}] is missing a filename")
+            children.append((self.add_file(filename), description_text(child)))
+
+        first_child = len(self.children)
+        self.children.extend(children)
+
+        self.elements[index] = (
+            name,
+            required,
+            attribute(arg_xml, "ref"),
+            value,
+            description,
+            copy_children,
+            first_attribute,
+            attribute_count,
+            first_child,
+            len(children),
+        )
+        return index
+
+    def to_cpp(self, arg_version: str) -> str:
+        """
+        Generates the C++ tables
+
+        :param arg_version: SDFormat version of the spec files
+        :returns: C++ code defining GetEmbeddedSchema()
+        """
+        for table in (self.elements, self.attributes, self.children):
+            if len(table) >= 2 ** 16:
+                raise ValueError("Schema tables are too large for 16 bit indices")
+
+        res = []
+        res.append("namespace")
+        res.append("{")
+        res.append("// NOLINTBEGIN")
+        res.append("constexpr EmbeddedSchemaElement kSchemaElements[] = {")
+        for element in self.elements:
+            (name, required, ref, value, description, copy_children,
+             first_attribute, attribute_count, first_child, child_count) = element
+            value_type, default, value_required, min_value, max_value = \
+                value if value is not None else (None, None, False, None, None)
+            fields = [
+                cpp_string(name),
+                cpp_string(required),
+                cpp_string(ref),
+                cpp_string(value_type),
+                cpp_string(default),
+                "true" if value_required else "false",
+                cpp_string(min_value),
+                cpp_string(max_value),
+                cpp_string(description),
+                "true" if copy_children else "false",
+                str(first_attribute),
+                str(attribute_count),
+                str(first_child),
+                str(child_count),
+            ]
+            res.append(INDENTATION + "{" + ", ".join(fields) + "},")
+        res.append("};")
+        res.append("")
+
+        res.append("constexpr EmbeddedSchemaAttribute kSchemaAttributes[] = {")
+        for name, attr_type, default, required, description in self.attributes:
+            fields = [
+                cpp_string(name),
+                cpp_string(attr_type),
+                cpp_string(default),
+                "true" if required else "false",
+                cpp_string(description),
+            ]
+            res.append(INDENTATION + "{" + ", ".join(fields) + "},")
+        if not self.attributes:
+            res.append(INDENTATION + "{nullptr, nullptr, nullptr, false, nullptr},")
+        res.append("};")
+        res.append("")
+
+        res.append("constexpr EmbeddedSchemaChild kSchemaChildren[] = {")
+        for element, description in self.children:
+            res.append(INDENTATION + "{" + str(element) + ", " +
+                       cpp_string(description) + "},")
+        if not self.children:
+            res.append(INDENTATION + "{0, nullptr},")
+        res.append("};")
+        res.append("")
+
+        res.append("constexpr EmbeddedSchemaFile kSchemaFiles[] = {")
+        for filename in sorted(self.file_roots):
+            res.append(INDENTATION + "{" + cpp_string(filename) + ", " +
+                       str(self.file_roots[filename]) + "},")
+        res.append("};")
+        res.append("// NOLINTEND")
+        res.append("}")
+        res.append("")
+        res.append("/////////////////////////////////////////////////")
+        res.append("const EmbeddedSchema &GetEmbeddedSchema()")
+        res.append("{")
+        res.append(INDENTATION + "static constexpr EmbeddedSchema schema {")
+        res.append(2 * INDENTATION + cpp_string(arg_version) + ",")
+        res.append(2 * INDENTATION + "kSchemaElements,")
+        res.append(2 * INDENTATION + f"{len(self.elements)},")
+        res.append(2 * INDENTATION + "kSchemaAttributes,")
+        res.append(2 * INDENTATION + "kSchemaChildren,")
+        res.append(2 * INDENTATION + "kSchemaFiles,")
+        res.append(2 * INDENTATION + f"{len(self.file_roots)}")
+        res.append(INDENTATION + "};")
+        res.append(INDENTATION + "return schema;")
+        res.append("}")
+        return NEWLINE.join(res) + NEWLINE
+
+
+def generate_schema_content(paths: List[Path], relative_to: Optional[str] = None) -> str:
+    """
+    Generate the schema tables for the latest supported SDFormat version
+
+    :param paths: Spec files, as for generate_map_content
+    :param relative_to: Prefix to strip from the paths, as for
+        generate_map_content
+    :returns: C++ code of the schema tables
+    """
+    version = SUPPORTED_SDF_VERSIONS[0]
+    files: Dict[str, Path] = {}
+    for path in paths:
+        relative_path = str(path)
+        if relative_to is not None:
+            _, relative_path = relative_path.split(relative_to)
+        posix_path = PurePosixPath(relative_path)
+        if posix_path.suffix == ".sdf" and str(posix_path.parent) == version:
+            files[posix_path.name] = path
+
+    tables = SchemaTables(files)
+    # Walk root.sdf first so that its elements are at the start of the
+    # tables, then add the spec files that are only used on their own.
+    tables.add_file("root.sdf")
+    for filename in sorted(files):
+        tables.add_file(filename)
+    return tables.to_cpp(version)
+
+
+def write_output(file_content: str, schema_content: str, output_filename: str) -> None:
     """
     Print the content of the EmbeddedSdf.cc to a file
     """
     copyright_notice = get_copyright_notice()
     prolog = get_file_header_prolog()
-    epilog = get_file_header_epilog()
+    epilog = get_file_header_epilog(schema_content)
     output_content = copyright_notice + prolog + file_content + epilog
 
     with open(output_filename, "w", encoding="utf8") as output_file:
@@ -199,7 +545,8 @@ def main(args=None) -> int:
     else:
         paths = [Path(f) for f in args.input_files]
     content = generate_map_content(paths, args.sdf_root)
-    write_output(content, args.output_file)
+    schema_content = generate_schema_content(paths, args.sdf_root)
+    write_output(content, schema_content, args.output_file)
     return 0
 
 
@@ -0,0 +1,898 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "sdf/SDFImpl.hh"
+#include "sdf/parser.hh"
+#include "BinaryDocument.hh"
+
+namespace sdf
+{
+// Inline bracket to help doxygen filtering.
+inline namespace SDF_VERSION_NAMESPACE {
+/// \brief Bytes at the start of every binary document.
+static const char kMagic[4] = {'S', 'D', 'F', 'B'};
+
+/// \brief Version of the layout of binary documents.
+static const std::uint64_t kFormatVersion = 1;
+
+/// \brief Flags of an element in a binary document.
+enum ElementFlags : std::uint8_t
+{
+  /// \brief The element is created from a description of its parent.
+  ELEMENT_KNOWN = 1 << 0,
+
+  /// \brief The element has a line number.
+  ELEMENT_LINE_NUMBER = 1 << 1,
+
+  /// \brief The element was set explicitly in its file.
+  ELEMENT_EXPLICITLY_SET = 1 << 2,
+
+  /// \brief The element copies its children.
+  ELEMENT_COPY_CHILDREN = 1 << 3,
+
+  /// \brief The element has a value.
+  ELEMENT_VALUE = 1 << 4,
+
+  /// \brief The element has an include element.
+  ELEMENT_INCLUDE = 1 << 5
+};
+
+/// \brief Flags of a parameter in a binary document.
+enum ParamFlags : std::uint8_t
+{
+  /// \brief The parameter is required.
+  PARAM_REQUIRED = 1 << 0,
+
+  /// \brief The parameter is set.
+  PARAM_SET = 1 << 1,
+
+  /// \brief The parameter ignores the attributes of its element.
+  PARAM_IGNORE_PARENT_ATTRIBUTES = 1 << 2,
+
+  /// \brief The parameter has the string it was set from.
+  PARAM_STRING = 1 << 3
+};
+
+/// \internal
+/// \brief Output of a binary document, with its table of strings.
+class BinaryWriter
+{
+  /// \brief Write a byte.
+  /// \param[in] _value Byte to write.
+  public: void Byte(std::uint8_t _value)
+  {
+    this->data.push_back(static_cast<char>(_value));
+  }
+
+  /// \brief Write an unsigned integer in as few bytes as possible.
+  /// \param[in] _value Integer to write.
+  public: void Varint(std::uint64_t _value)
+  {
+    while (_value >= 0x80)
+    {
+      this->Byte(static_cast<std::uint8_t>(_value | 0x80));
+      _value >>= 7;
+    }
+    this->Byte(static_cast<std::uint8_t>(_value));
+  }
+
+  /// \brief Write a signed integer in as few bytes as possible.
+  /// \param[in] _value Integer to write.
+  public: void SignedVarint(std::int64_t _value)
+  {
+    this->Varint((static_cast<std::uint64_t>(_value) << 1) ^
+                 static_cast<std::uint64_t>(_value >> 63));
+  }
+
+  /// \brief Write a 64 bit integer in little endian order.
+  /// \param[in] _value Integer to write.
+  public: void Fixed64(std::uint64_t _value)
+  {
+    for (int i = 0; i < 8; ++i)
+      this->Byte(static_cast<std::uint8_t>(_value >> (8 * i)));
+  }
+
+  /// \brief Write a double exactly.
+  /// \param[in] _value Value to write.
+  public: void Double(double _value)
+  {
+    std::uint64_t bits;
+    std::memcpy(&bits, &_value, sizeof(bits));
+    this->Fixed64(bits);
+  }
+
+  /// \brief Write a float exactly.
+  /// \param[in] _value Value to write.
+  public: void Float(float _value)
+  {
+    std::uint32_t bits;
+    std::memcpy(&bits, &_value, sizeof(bits));
+    for (int i = 0; i < 4; ++i)
+      this->Byte(static_cast<std::uint8_t>(bits >> (8 * i)));
+  }
+
+  /// \brief Write a string as its index in the table of strings.
+  /// \param[in] _value String to write.
+  public: void String(const std::string &_value)
+  {
+    auto inserted = this->stringIndex.emplace(_value, this->strings.size());
+    if (inserted.second)
+      this->strings.push_back(&inserted.first->first);
+    this->Varint(inserted.first->second);
+  }
+
+  /// \brief Write a string in place.
+  /// \param[in] _value String to write.
+  public: void InlineString(const std::string &_value)
+  {
+    this->Varint(_value.size());
+    this->data.append(_value);
+  }
+
+  /// \brief Written bytes.
+  public: std::string data;
+
+  /// \brief Table of strings, in order of their index.
+  public: std::vector<const std::string *> strings;
+
+  /// \brief Index of each string in the table.
+  public: std::unordered_map<std::string, std::size_t> stringIndex;
+};
+
+/// \internal
+/// \brief Input of a binary document, with its table of strings. Reading
+/// past the end or an invalid string index makes the reader fail, and
+/// every later read returns zero.
+class BinaryReader
+{
+  /// \brief Constructor.
+  /// \param[in] _data Content of the document.
+  public: explicit BinaryReader(const std::string &_data)
+    : cursor(_data.data()), end(_data.data() + _data.size())
+  {
+  }
+
+  /// \brief Read a byte.
+  /// \return The byte.
+  public: std::uint8_t Byte()
+  {
+    if (this->cursor == this->end)
+    {
+      this->failed = true;
+      return 0;
+    }
+    return static_cast<std::uint8_t>(*this->cursor++);
+  }
+
+  /// \brief Read an unsigned integer written by BinaryWriter::Varint.
+  /// \return The integer.
+  public: std::uint64_t Varint()
+  {
+    std::uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+      const std::uint8_t byte = this->Byte();
+      value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80))
+        return value;
+    }
+    this->failed = true;
+    return 0;
+  }
+
+  /// \brief Read a signed integer written by BinaryWriter::SignedVarint.
+  /// \return The integer.
+  public: std::int64_t SignedVarint()
+  {
+    const std::uint64_t value = this->Varint();
+    return static_cast<std::int64_t>(value >> 1) ^
+           -static_cast<std::int64_t>(value & 1);
+  }
+
+  /// \brief Read a 64 bit integer in little endian order.
+  /// \return The integer.
+  public: std::uint64_t Fixed64()
+  {
+    std::uint64_t value = 0;
+    for (int i = 0; i < 8; ++i)
+      value |= static_cast<std::uint64_t>(this->Byte()) << (8 * i);
+    return value;
+  }
+
+  /// \brief Read a double written by BinaryWriter::Double.
+  /// \return The value.
+  public: double Double()
+  {
+    const std::uint64_t bits = this->Fixed64();
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  /// \brief Read a float written by BinaryWriter::Float.
+  /// \return The value.
+  public: float Float()
+  {
+    std::uint32_t bits = 0;
+    for (int i = 0; i < 4; ++i)
+      bits |= static_cast<std::uint32_t>(this->Byte()) << (8 * i);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  /// \brief Read a string written by BinaryWriter::String.
+  /// \return The string, which lives as long as the reader.
+  public: const std::string &String()
+  {
+    static const std::string kEmpty;
+    const std::uint64_t index = this->Varint();
+    if (index >= this->strings.size())
+    {
+      this->failed = true;
+      return kEmpty;
+    }
+    return this->strings[index];
+  }
+
+  /// \brief Read a string written by BinaryWriter::InlineString.
+  /// \return The string.
+  public: std::string InlineString()
+  {
+    const std::uint64_t size = this->Varint();
+    if (size > static_cast<std::uint64_t>(this->end - this->cursor))
+    {
+      this->failed = true;
+      return std::string();
+    }
+    std::string value(this->cursor, size);
+    this->cursor += size;
+    return value;
+  }
+
+  /// \brief Next byte to read.
+  public: const char *cursor;
+
+  /// \brief End of the document.
+  public: const char *end;
+
+  /// \brief True once a read failed.
+  public: bool failed = false;
+
+  /// \brief Table of strings, in order of their index.
+  public: std::vector<std::string> strings;
+};
+
+/////////////////////////////////////////////////
+/// \brief Write a value of a parameter. There is one overload for each type
+/// of ParamPrivate::ParamVariant.
+/// \param[in,out] _writer Output.
+/// \param[in] _value Value to write.
+static void writeValue(BinaryWriter &_writer, bool _value)
+{
+  _writer.Byte(_value ? 1 : 0);
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer, char _value)
+{
+  _writer.Byte(static_cast<std::uint8_t>(_value));
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer, const std::string &_value)
+{
+  _writer.String(_value);
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer, int _value)
+{
+  _writer.SignedVarint(_value);
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer, std::uint64_t _value)
+{
+  _writer.Varint(_value);
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer, unsigned int _value)
+{
+  _writer.Varint(_value);
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer, double _value)
+{
+  _writer.Double(_value);
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer, float _value)
+{
+  _writer.Float(_value);
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer, const sdf::Time &_value)
+{
+  _writer.SignedVarint(_value.sec);
+  _writer.SignedVarint(_value.nsec);
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer, const gz::math::Angle &_value)
+{
+  _writer.Double(_value.Radian());
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer, const gz::math::Color &_value)
+{
+  _writer.Float(_value.R());
+  _writer.Float(_value.G());
+  _writer.Float(_value.B());
+  _writer.Float(_value.A());
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer,
+                       const gz::math::Vector2i &_value)
+{
+  _writer.SignedVarint(_value.X());
+  _writer.SignedVarint(_value.Y());
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer,
+                       const gz::math::Vector2d &_value)
+{
+  _writer.Double(_value.X());
+  _writer.Double(_value.Y());
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer,
+                       const gz::math::Vector3d &_value)
+{
+  _writer.Double(_value.X());
+  _writer.Double(_value.Y());
+  _writer.Double(_value.Z());
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer,
+                       const gz::math::Quaterniond &_value)
+{
+  _writer.Double(_value.W());
+  _writer.Double(_value.X());
+  _writer.Double(_value.Y());
+  _writer.Double(_value.Z());
+}
+
+/////////////////////////////////////////////////
+static void writeValue(BinaryWriter &_writer, const gz::math::Pose3d &_value)
+{
+  writeValue(_writer, _value.Pos());
+  writeValue(_writer, _value.Rot());
+}
+
+/////////////////////////////////////////////////
+/// \brief Read a value written by writeValue. There is one overload for
+/// each type of ParamPrivate::ParamVariant.
+/// \param[in,out] _reader Input.
+/// \param[out] _value Value read.
+static void readValue(BinaryReader &_reader, bool &_value)
+{
+  _value = _reader.Byte() != 0;
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, char &_value)
+{
+  _value = static_cast<char>(_reader.Byte());
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, std::string &_value)
+{
+  _value = _reader.String();
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, int &_value)
+{
+  _value = static_cast<int>(_reader.SignedVarint());
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, std::uint64_t &_value)
+{
+  _value = _reader.Varint();
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, unsigned int &_value)
+{
+  _value = static_cast<unsigned int>(_reader.Varint());
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, double &_value)
+{
+  _value = _reader.Double();
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, float &_value)
+{
+  _value = _reader.Float();
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, sdf::Time &_value)
+{
+  _value.sec = static_cast<int32_t>(_reader.SignedVarint());
+  _value.nsec = static_cast<int32_t>(_reader.SignedVarint());
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, gz::math::Angle &_value)
+{
+  _value.SetRadian(_reader.Double());
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, gz::math::Color &_value)
+{
+  const float r = _reader.Float();
+  const float g = _reader.Float();
+  const float b = _reader.Float();
+  const float a = _reader.Float();
+  _value = gz::math::Color(r, g, b, a);
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, gz::math::Vector2i &_value)
+{
+  const int x = static_cast<int>(_reader.SignedVarint());
+  const int y = static_cast<int>(_reader.SignedVarint());
+  _value.Set(x, y);
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, gz::math::Vector2d &_value)
+{
+  const double x = _reader.Double();
+  const double y = _reader.Double();
+  _value.Set(x, y);
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, gz::math::Vector3d &_value)
+{
+  const double x = _reader.Double();
+  const double y = _reader.Double();
+  const double z = _reader.Double();
+  _value.Set(x, y, z);
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, gz::math::Quaterniond &_value)
+{
+  const double w = _reader.Double();
+  const double x = _reader.Double();
+  const double y = _reader.Double();
+  const double z = _reader.Double();
+  _value = gz::math::Quaterniond(w, x, y, z);
+}
+
+/////////////////////////////////////////////////
+static void readValue(BinaryReader &_reader, gz::math::Pose3d &_value)
+{
+  gz::math::Vector3d pos;
+  gz::math::Quaterniond rot;
+  readValue(_reader, pos);
+  readValue(_reader, rot);
+  _value.Set(pos, rot);
+}
+
+/////////////////////////////////////////////////
+/// \brief Read a value of the type at an index of ParamPrivate::ParamVariant.
+/// \param[in,out] _reader Input.
+/// \param[in] _index Index of the type in the variant.
+/// \param[out] _value Value read.
+template <std::size_t I = 0>
+static void readVariant(BinaryReader &_reader, std::size_t _index,
+                        ParamPrivate::ParamVariant &_value)
+{
+  using ParamVariant = ParamPrivate::ParamVariant;
+  if constexpr (I < std::variant_size_v<ParamVariant>)
+  {
+    if (_index == I)
+    {
+      std::variant_alternative_t<I, ParamVariant> value;
+      readValue(_reader, value);
+      _value = std::move(value);
+      return;
+    }
+    readVariant<I + 1>(_reader, _index, _value);
+  }
+}
+
+/////////////////////////////////////////////////
+bool BinaryDocument::Save(const std::string &_filename,
+                          const ElementPtr &_root,
+                          const std::string &_filePath,
+                          const std::string &_originalVersion,
+                          sdf::Errors &_errors)
+{
+  BinaryWriter body;
+  body.String(_filePath);
+  body.String(_originalVersion);
+  WriteElement(body, _root, nullptr);
+
+  BinaryWriter header;
+  header.data.append(kMagic, sizeof(kMagic));
+  header.Varint(kFormatVersion);
+  header.InlineString(SDF_VERSION_FULL);
+  header.InlineString(SDF::Version());
+  header.Varint(body.strings.size());
+  for (const std::string *str : body.strings)
+    header.InlineString(*str);
+
+  std::ofstream out(_filename, std::ios::out | std::ios::binary);
+  if (!out)
+  {
+    _errors.push_back({ErrorCode::FILE_READ,
+        "Unable to open file[" + _filename + "] for writing."});
+    return false;
+  }
+  out.write(header.data.data(), header.data.size());
+  out.write(body.data.data(), body.data.size());
+  out.close();
+  if (!out)
+  {
+    _errors.push_back({ErrorCode::FILE_READ,
+        "Unable to write file[" + _filename + "]."});
+    return false;
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool BinaryDocument::Load(const std::string &_filename,
+                          const ElementPtr &_root,
+                          std::string &_filePath,
+                          std::string &_originalVersion,
+                          const ParserConfig &_config,
+                          sdf::Errors &_errors)
+{
+  std::ifstream in(_filename, std::ios::in | std::ios::binary);
+  if (!in)
+  {
+    _errors.push_back({ErrorCode::FILE_READ,
+        "Unable to open file[" + _filename + "]."});
+    return false;
+  }
+  const std::string data((std::istreambuf_iterator<char>(in)),
+                         std::istreambuf_iterator<char>());
+
+  BinaryReader reader(data);
+  if (data.size() < sizeof(kMagic) ||
+      std::memcmp(data.data(), kMagic, sizeof(kMagic)) != 0)
+  {
+    _errors.push_back({ErrorCode::FILE_READ,
+        "File[" + _filename + "] is not a binary SDFormat document."});
+    return false;
+  }
+  reader.cursor += sizeof(kMagic);
+
+  // Elements are rebuilt from the schema, so it must be the one the
+  // document was written with.
+  const std::uint64_t formatVersion = reader.Varint();
+  const std::string libraryVersion = reader.InlineString();
+  const std::string sdfVersion = reader.InlineString();
+  if (formatVersion != kFormatVersion || libraryVersion != SDF_VERSION_FULL ||
+      sdfVersion != SDF::Version())
+  {
+    _errors.push_back({ErrorCode::FILE_READ,
+        "Binary document file[" + _filename + "] was written by libsdformat["
+        + libraryVersion + "] for SDFormat[" + sdfVersion + "], and can only "
+        "be read by the same version of libsdformat."});
+    return false;
+  }
+
+  const std::uint64_t stringCount = reader.Varint();
+  for (std::uint64_t i = 0; i < stringCount && !reader.failed; ++i)
+    reader.strings.push_back(reader.InlineString());
+
+  _filePath = reader.String();
+  _originalVersion = reader.String();
+
+  const std::uint8_t flags = reader.Byte();
+  const std::string &name = reader.String();
+  reader.String();
+  if (!reader.failed && name != _root->GetName())
+  {
+    _errors.push_back({ErrorCode::FILE_READ,
+        "Binary document file[" + _filename + "] has a root element <" +
+        name + "> instead of <" + _root->GetName() + ">."});
+    return false;
+  }
+
+  if (!ReadElementContent(reader, _root, flags, _config, _errors) ||
+      reader.failed || reader.cursor != reader.end)
+  {
+    _errors.push_back({ErrorCode::FILE_READ,
+        "Unable to read binary document file[" + _filename + "]."});
+    return false;
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+void BinaryDocument::WriteElement(BinaryWriter &_writer,
+                                  const ElementPtr &_elem,
+                                  const ElementPtr &_descriptionSource)
+{
+  const std::optional<int> lineNumber = _elem->LineNumber();
+  const ParamPtr value = _elem->GetValue();
+  const ElementPtr includeElement = _elem->GetIncludeElement();
+
+  std::uint8_t flags = 0;
+  if (_descriptionSource &&
+      _descriptionSource->HasElementDescription(_elem->GetName()))
+  {
+    flags |= ELEMENT_KNOWN;
+  }
+  if (lineNumber.has_value())
+    flags |= ELEMENT_LINE_NUMBER;
+  if (_elem->GetExplicitlySetInFile())
+    flags |= ELEMENT_EXPLICITLY_SET;
+  if (_elem->GetCopyChildren())
+    flags |= ELEMENT_COPY_CHILDREN;
+  if (value)
+    flags |= ELEMENT_VALUE;
+  if (includeElement)
+    flags |= ELEMENT_INCLUDE;
+
+  _writer.Byte(flags);
+  _writer.String(_elem->GetName());
+  _writer.String(_elem->ReferenceSDF());
+  _writer.String(_elem->GetRequired());
+  _writer.String(_elem->FilePath());
+  _writer.String(_elem->XmlPath());
+  _writer.String(_elem->OriginalVersion());
+  if (lineNumber.has_value())
+    _writer.SignedVarint(lineNumber.value());
+
+  _writer.Varint(_elem->GetAttributeCount());
+  for (const ParamPtr &attribute : _elem->GetAttributes())
+    WriteParam(_writer, *attribute);
+
+  if (value)
+    WriteParam(_writer, *value);
+
+  std::vector<ElementPtr> children;
+  for (const ElementPtr &child : _elem->Children())
+    children.push_back(child);
+  _writer.Varint(children.size());
+  for (const ElementPtr &child : children)
+    WriteElement(_writer, child, _elem);
+
+  // The include element is created from a description of the element that
+  // the included entity was inserted into.
+  if (includeElement)
+    WriteElement(_writer, includeElement, _elem->GetParent());
+}
+
+/////////////////////////////////////////////////
+void BinaryDocument::WriteParam(BinaryWriter &_writer, const Param &_param)
+{
+  const ParamPrivate &data = *_param.dataPtr;
+
+  // The description of the parameter is only used if the parameter is not
+  // in the schema, such as attributes of unknown elements.
+  std::uint8_t flags = 0;
+  if (data.descriptor->required)
+    flags |= PARAM_REQUIRED;
+  if (data.set)
+    flags |= PARAM_SET;
+  if (data.ignoreParentAttributes)
+    flags |= PARAM_IGNORE_PARENT_ATTRIBUTES;
+  if (data.strValue.has_value())
+    flags |= PARAM_STRING;
+
+  _writer.Byte(flags);
+  _writer.String(*data.descriptor->key);
+  _writer.String(*data.descriptor->typeName);
+  _writer.String(data.descriptor->defaultStrValue);
+  _writer.String(data.descriptor->description);
+  if (data.strValue.has_value())
+    _writer.String(data.strValue.value());
+
+  _writer.Byte(static_cast<std::uint8_t>(data.value.index()));
+  std::visit([&_writer](const auto &_value)
+      {
+        writeValue(_writer, _value);
+      }, data.value);
+}
+
+/////////////////////////////////////////////////
+ElementPtr BinaryDocument::ReadElement(BinaryReader &_reader,
+                                       const ElementPtr &_descriptionSource,
+                                       const ElementPtr &_parent,
+                                       const ParserConfig &_config,
+                                       sdf::Errors &_errors)
+{
+  const std::uint8_t flags = _reader.Byte();
+  const std::string &name = _reader.String();
+  const std::string &referenceSdf = _reader.String();
+  if (_reader.failed)
+    return nullptr;
+
+  ElementPtr elem;
+  if (flags & ELEMENT_KNOWN)
+  {
+    ElementPtr description = _descriptionSource ?
+        _descriptionSource->GetElementDescription(name) : nullptr;
+    if (!description)
+    {
+      _errors.push_back({ErrorCode::FILE_READ,
+          "Element[" + name + "] of a binary document is not in the "
+          "schema."});
+      return nullptr;
+    }
+    elem = description->Clone(_errors);
+
+    // Nested elements are described by another schema file, as in the
+    // parser.
+    if (referenceSdf.empty() && !elem->ReferenceSDF().empty())
+    {
+      ElementPtr refSdf(new Element);
+      if (!initFile(elem->ReferenceSDF() + ".sdf", _config, refSdf, _errors))
+        return nullptr;
+      elem->Copy(refSdf, _errors);
+    }
+  }
+  else
+  {
+    elem.reset(new Element);
+    elem->SetName(name);
+  }
+  elem->SetParent(_parent);
+
+  if (!ReadElementContent(_reader, elem, flags, _config, _errors))
+    return nullptr;
+  return elem;
+}
+
+/////////////////////////////////////////////////
+bool BinaryDocument::ReadElementContent(BinaryReader &_reader,
+                                        const ElementPtr &_elem,
+                                        std::uint8_t _flags,
+                                        const ParserConfig &_config,
+                                        sdf::Errors &_errors)
+{
+  _elem->SetRequired(_reader.String());
+  _elem->SetFilePath(_reader.String());
+  _elem->SetXmlPath(_reader.String());
+  _elem->SetOriginalVersion(_reader.String());
+  if (_flags & ELEMENT_LINE_NUMBER)
+    _elem->SetLineNumber(static_cast<int>(_reader.SignedVarint()));
+  _elem->SetExplicitlySetInFile(_flags & ELEMENT_EXPLICITLY_SET);
+  _elem->SetCopyChildren(_flags & ELEMENT_COPY_CHILDREN);
+
+  const std::uint64_t attributeCount = _reader.Varint();
+  for (std::uint64_t i = 0; i < attributeCount && !_reader.failed; ++i)
+  {
+    if (!ReadParam(_reader, _elem, true, _errors))
+      return false;
+  }
+
+  if ((_flags & ELEMENT_VALUE) && !ReadParam(_reader, _elem, false, _errors))
+    return false;
+
+  const std::uint64_t childCount = _reader.Varint();
+  for (std::uint64_t i = 0; i < childCount && !_reader.failed; ++i)
+  {
+    ElementPtr child = ReadElement(_reader, _elem, _elem, _config, _errors);
+    if (!child)
+      return false;
+    _elem->InsertElement(child);
+  }
+
+  if (_flags & ELEMENT_INCLUDE)
+  {
+    ElementPtr includeElement = ReadElement(
+        _reader, _elem->GetParent(), nullptr, _config, _errors);
+    if (!includeElement)
+      return false;
+    _elem->SetIncludeElement(includeElement);
+  }
+
+  return !_reader.failed;
+}
+
+/////////////////////////////////////////////////
+bool BinaryDocument::ReadParam(BinaryReader &_reader,
+                               const ElementPtr &_elem,
+                               bool _isAttribute,
+                               sdf::Errors &_errors)
+{
+  const std::uint8_t flags = _reader.Byte();
+  const std::string &key = _reader.String();
+  const std::string &typeName = _reader.String();
+  const std::string &defaultValue = _reader.String();
+  const std::string &description = _reader.String();
+  const std::string *strValue =
+      (flags & PARAM_STRING) ? &_reader.String() : nullptr;
+  const std::size_t index = _reader.Byte();
+  if (_reader.failed)
+    return false;
+
+  ParamPtr param = _isAttribute ? _elem->GetAttribute(key) : _elem->GetValue();
+  if (!param)
+  {
+    const bool required = flags & PARAM_REQUIRED;
+    if (_isAttribute)
+    {
+      _elem->AddAttribute(key, typeName, defaultValue, required, _errors,
+                          description);
+      param = _elem->GetAttribute(key);
+    }
+    else
+    {
+      _elem->AddValue(typeName, defaultValue, required, _errors,
+                      description);
+      param = _elem->GetValue();
+    }
+  }
+
+  ParamPrivate &data = *param->dataPtr;
+  if (index != data.value.index())
+  {
+    _errors.push_back({ErrorCode::FILE_READ,
+        "Parameter[" + key + "] of element[" + _elem->GetName() +
+        "] in a binary document does not have the type of the schema."});
+    return false;
+  }
+
+  readVariant(_reader, index, data.value);
+  data.set = flags & PARAM_SET;
+  data.ignoreParentAttributes = flags & PARAM_IGNORE_PARENT_ATTRIBUTES;
+  if (strValue)
+    data.strValue = *strValue;
+  else
+    data.strValue = std::nullopt;
+  return !_reader.failed;
+}
+}
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDFORMAT_BINARYDOCUMENT_HH
+#define SDFORMAT_BINARYDOCUMENT_HH
+
+#include <cstdint>
+#include <string>
+
+#include "sdf/Element.hh"
+#include "sdf/Error.hh"
+#include "sdf/Param.hh"
+#include "sdf/ParserConfig.hh"
+#include "sdf/sdf_config.h"
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  class BinaryReader;
+  class BinaryWriter;
+
+  /// \internal
+  /// \brief Reads and writes parsed element trees in a compact binary form,
+  /// so that a document can be loaded again without parsing XML, converting
+  /// it, or resolving its includes.
+  ///
+  /// Every string is written once to a table at the start of the file and
+  /// referred to by its index. Elements that are in the schema are rebuilt
+  /// from the schema of their parent, as the parser does, so only the
+  /// values of their parameters are written. Values are written in their
+  /// parsed type, along with the string they were parsed from, so they are
+  /// not parsed again.
+  ///
+  /// A file can only be read by the version of the library that wrote it.
+  class BinaryDocument
+  {
+    /// \brief Write a document to a file.
+    /// \param[in] _filename Name of the file to write.
+    /// \param[in] _root Root <sdf> element of the document.
+    /// \param[in] _filePath Path of the document.
+    /// \param[in] _originalVersion Spec version the document was parsed
+    /// from.
+    /// \param[out] _errors Errors are appended to this vector.
+    /// \return True if the file was written.
+    public: static bool Save(const std::string &_filename,
+                             const ElementPtr &_root,
+                             const std::string &_filePath,
+                             const std::string &_originalVersion,
+                             sdf::Errors &_errors);
+
+    /// \brief Read a document from a file.
+    /// \param[in] _filename Name of the file to read.
+    /// \param[in,out] _root Root <sdf> element, freshly initialized from the
+    /// schema, into which the document is read.
+    /// \param[out] _filePath Path of the document.
+    /// \param[out] _originalVersion Spec version the document was parsed
+    /// from.
+    /// \param[in] _config Parser configuration used to load the schema files
+    /// of nested elements.
+    /// \param[out] _errors Errors are appended to this vector.
+    /// \return True if the document was read.
+    public: static bool Load(const std::string &_filename,
+                             const ElementPtr &_root,
+                             std::string &_filePath,
+                             std::string &_originalVersion,
+                             const ParserConfig &_config,
+                             sdf::Errors &_errors);
+
+    /// \brief Write an element and its descendants.
+    /// \param[in,out] _writer Output.
+    /// \param[in] _elem Element to write.
+    /// \param[in] _descriptionSource Element whose description the element
+    /// was created from, or nullptr.
+    private: static void WriteElement(BinaryWriter &_writer,
+                                      const ElementPtr &_elem,
+                                      const ElementPtr &_descriptionSource);
+
+    /// \brief Write a parameter.
+    /// \param[in,out] _writer Output.
+    /// \param[in] _param Parameter to write.
+    private: static void WriteParam(BinaryWriter &_writer,
+                                    const Param &_param);
+
+    /// \brief Read an element and its descendants.
+    /// \param[in,out] _reader Input.
+    /// \param[in] _descriptionSource Element whose description the element
+    /// is created from, or nullptr.
+    /// \param[in] _parent Parent of the element, or nullptr.
+    /// \param[in] _config Parser configuration.
+    /// \param[out] _errors Errors are appended to this vector.
+    /// \return The element, or nullptr on error.
+    private: static ElementPtr ReadElement(
+                BinaryReader &_reader, const ElementPtr &_descriptionSource,
+                const ElementPtr &_parent, const ParserConfig &_config,
+                sdf::Errors &_errors);
+
+    /// \brief Read the content of an element that was already created.
+    /// \param[in,out] _reader Input.
+    /// \param[in,out] _elem Element to read into.
+    /// \param[in] _flags Flags of the element.
+    /// \param[in] _config Parser configuration.
+    /// \param[out] _errors Errors are appended to this vector.
+    /// \return True on success.
+    private: static bool ReadElementContent(BinaryReader &_reader,
+                                            const ElementPtr &_elem,
+                                            std::uint8_t _flags,
+                                            const ParserConfig &_config,
+                                            sdf::Errors &_errors);
+
+    /// \brief Read a parameter into an attribute or the value of an element.
+    /// \param[in,out] _reader Input.
+    /// \param[in,out] _elem Element of the parameter.
+    /// \param[in] _isAttribute True for an attribute, false for the value.
+    /// \param[out] _errors Errors are appended to this vector.
+    /// \return True on success.
+    private: static bool ReadParam(BinaryReader &_reader,
+                                   const ElementPtr &_elem,
+                                   bool _isAttribute,
+                                   sdf::Errors &_errors);
+  };
+  }
+}
+#endif
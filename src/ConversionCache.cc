@@ -0,0 +1,502 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "sdf/ConversionCache.hh"
+#include "sdf/Element.hh"
+#include "sdf/ParserConfig.hh"
+#include "XmlStreamReader.hh"
+
+using namespace sdf;
+
+/// \brief Extension of the cache entries.
+static const char kEntryExtension[] = ".sdfb";
+
+/// \brief Extension of entries that are being written.
+static const char kTemporaryExtension[] = ".tmp";
+
+/// \brief Private data for ConversionCache.
+class sdf::ConversionCache::Implementation
+{
+  /// \brief Directory of the cache.
+  public: std::string directory;
+
+  /// \brief Maximum size of the entries in bytes.
+  public: std::atomic<std::uintmax_t> maxSize{256u * 1024u * 1024u};
+
+  /// \brief Mutex that serializes writes and evictions by this object.
+  public: std::mutex mutex;
+
+  /// \brief Number of lookups that loaded an element tree.
+  public: std::atomic<uint64_t> hits{0};
+
+  /// \brief Number of lookups that did not load an element tree.
+  public: std::atomic<uint64_t> misses{0};
+
+  /// \brief Number of temporary files written by this object.
+  public: std::atomic<uint64_t> temporaryCount{0};
+
+  /// \brief Random number that tells the temporary files of this object
+  /// apart from those of other processes.
+  public: uint64_t temporaryId = 0;
+};
+
+namespace
+{
+/// \brief Incremental SHA-256 hash, used to name the cache entries so that
+/// two different inputs can not share an entry.
+class Sha256
+{
+  /// \brief Constructor.
+  public: Sha256()
+  {
+    this->state = {0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u, 0xa54ff53au,
+                   0x510e527fu, 0x9b05688cu, 0x1f83d9abu, 0x5be0cd19u};
+  }
+
+  /// \brief Add bytes to the hash.
+  /// \param[in] _data Bytes to add.
+  /// \param[in] _size Number of bytes to add.
+  public: void Update(const char *_data, std::size_t _size)
+  {
+    for (std::size_t i = 0; i < _size; ++i)
+    {
+      this->block[this->blockSize++] = static_cast<uint8_t>(_data[i]);
+      if (this->blockSize == this->block.size())
+      {
+        this->Transform();
+        this->blockSize = 0;
+      }
+    }
+    this->length += _size;
+  }
+
+  /// \brief Add a string, followed by a separator, to the hash.
+  /// \param[in] _str String to add.
+  public: void Update(const std::string &_str)
+  {
+    // Include the terminating null, so that the strings "ab" "c" and "a"
+    // "bc" have different hashes.
+    this->Update(_str.c_str(), _str.size() + 1);
+  }
+
+  /// \brief Finish the hash.
+  /// \return Hash of the bytes that were added, in hexadecimal.
+  public: std::string HexDigest()
+  {
+    const uint64_t bitLength = this->length * 8;
+    const char padding = static_cast<char>(0x80);
+    this->Update(&padding, 1);
+    const char zero = 0;
+    while (this->blockSize != 56)
+      this->Update(&zero, 1);
+    for (int i = 7; i >= 0; --i)
+    {
+      const char byte = static_cast<char>((bitLength >> (i * 8)) & 0xff);
+      this->Update(&byte, 1);
+    }
+
+    char hex[65];
+    for (std::size_t i = 0; i < this->state.size(); ++i)
+    {
+      std::snprintf(hex + i * 8, 9, "%08x",
+                    static_cast<unsigned int>(this->state[i]));
+    }
+    return std::string(hex, 64);
+  }
+
+  /// \brief Hash the current block.
+  private: void Transform()
+  {
+    static const uint32_t k[64] = {
+      0x428a2f98u, 0x71374491u, 0xb5c0fbcfu, 0xe9b5dba5u, 0x3956c25bu,
+      0x59f111f1u, 0x923f82a4u, 0xab1c5ed5u, 0xd807aa98u, 0x12835b01u,
+      0x243185beu, 0x550c7dc3u, 0x72be5d74u, 0x80deb1feu, 0x9bdc06a7u,
+      0xc19bf174u, 0xe49b69c1u, 0xefbe4786u, 0x0fc19dc6u, 0x240ca1ccu,
+      0x2de92c6fu, 0x4a7484aau, 0x5cb0a9dcu, 0x76f988dau, 0x983e5152u,
+      0xa831c66du, 0xb00327c8u, 0xbf597fc7u, 0xc6e00bf3u, 0xd5a79147u,
+      0x06ca6351u, 0x14292967u, 0x27b70a85u, 0x2e1b2138u, 0x4d2c6dfcu,
+      0x53380d13u, 0x650a7354u, 0x766a0abbu, 0x81c2c92eu, 0x92722c85u,
+      0xa2bfe8a1u, 0xa81a664bu, 0xc24b8b70u, 0xc76c51a3u, 0xd192e819u,
+      0xd6990624u, 0xf40e3585u, 0x106aa070u, 0x19a4c116u, 0x1e376c08u,
+      0x2748774cu, 0x34b0bcb5u, 0x391c0cb3u, 0x4ed8aa4au, 0x5b9cca4fu,
+      0x682e6ff3u, 0x748f82eeu, 0x78a5636fu, 0x84c87814u, 0x8cc70208u,
+      0x90befffau, 0xa4506cebu, 0xbef9a3f7u, 0xc67178f2u};
+    auto rotr = [](uint32_t _x, int _n)
+    {
+      return (_x >> _n) | (_x << (32 - _n));
+    };
+
+    uint32_t w[64];
+    for (int i = 0; i < 16; ++i)
+    {
+      w[i] = (static_cast<uint32_t>(this->block[i * 4]) << 24) |
+             (static_cast<uint32_t>(this->block[i * 4 + 1]) << 16) |
+             (static_cast<uint32_t>(this->block[i * 4 + 2]) << 8) |
+             static_cast<uint32_t>(this->block[i * 4 + 3]);
+    }
+    for (int i = 16; i < 64; ++i)
+    {
+      const uint32_t s0 =
+          rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+      const uint32_t s1 =
+          rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+      w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    std::array<uint32_t, 8> h = this->state;
+    for (int i = 0; i < 64; ++i)
+    {
+      const uint32_t s1 = rotr(h[4], 6) ^ rotr(h[4], 11) ^ rotr(h[4], 25);
+      const uint32_t ch = (h[4] & h[5]) ^ (~h[4] & h[6]);
+      const uint32_t t1 = h[7] + s1 + ch + k[i] + w[i];
+      const uint32_t s0 = rotr(h[0], 2) ^ rotr(h[0], 13) ^ rotr(h[0], 22);
+      const uint32_t maj = (h[0] & h[1]) ^ (h[0] & h[2]) ^ (h[1] & h[2]);
+      const uint32_t t2 = s0 + maj;
+      h = {t1 + t2, h[0], h[1], h[2], h[3] + t1, h[4], h[5], h[6]};
+    }
+    for (std::size_t i = 0; i < this->state.size(); ++i)
+      this->state[i] += h[i];
+  }
+
+  /// \brief Hash of the blocks so far.
+  private: std::array<uint32_t, 8> state;
+
+  /// \brief Block being filled.
+  private: std::array<uint8_t, 64> block{};
+
+  /// \brief Number of bytes in the block.
+  private: std::size_t blockSize = 0;
+
+  /// \brief Number of bytes added.
+  private: uint64_t length = 0;
+};
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the name of the cache entry of a file.
+/// \param[in] _path Resolved path of the file.
+/// \param[in] _data Content of the file.
+/// \param[in] _size Size of the content in bytes.
+/// \param[in] _config Parser configuration the file is read with.
+/// \return File name of the entry.
+static std::string entryName(const std::string &_path, const char *_data,
+                             std::size_t _size, const ParserConfig &_config)
+{
+  std::ostringstream policies;
+  policies << static_cast<int>(_config.WarningsPolicy()) << ' '
+           << static_cast<int>(_config.UnrecognizedElementsPolicy()) << ' '
+           << static_cast<int>(_config.DeprecatedElementsPolicy());
+
+  // The size is hashed before the content, so that the content can not
+  // run into the strings that follow it.
+  Sha256 hash;
+  hash.Update(std::to_string(_size));
+  hash.Update(_data, _size);
+  hash.Update(_path);
+  hash.Update(SDF::Version());
+  hash.Update(SDF_VERSION_FULL);
+  hash.Update(policies.str());
+  return hash.HexDigest() + kEntryExtension;
+}
+
+/////////////////////////////////////////////////
+/// \brief Check whether a document may have a cache entry. Only documents
+/// converted from another SDFormat version are cached, so the version of
+/// the root element is read first to avoid hashing the other documents.
+/// \param[in] _data Content of the document.
+/// \param[in] _size Size of the content in bytes.
+/// \return False if the document can not have a cache entry.
+static bool mayHaveEntry(const char *_data, std::size_t _size)
+{
+  XmlStreamReader reader(_data, _size);
+  XmlStreamReader::Token token = reader.Next();
+  while (token == XmlStreamReader::Token::OTHER)
+    token = reader.Next();
+
+  // Documents the reader does not handle are hashed as before.
+  if (token != XmlStreamReader::Token::START_ELEMENT)
+    return true;
+
+  const XmlStreamElement &root = reader.Element();
+  const char *version = root.Attribute("version");
+  return root.name == "sdf" && version && version != SDF::Version();
+}
+
+/////////////////////////////////////////////////
+/// \brief Check whether an element tree only contains elements read from
+/// one file.
+/// \param[in] _elem Root of the element tree.
+/// \param[in] _path Path of the file.
+/// \return True if no element of the tree was read from another file or
+/// is an include element.
+static bool readFromFile(const ElementPtr &_elem, const std::string &_path)
+{
+  if (_elem->GetName() == "include" || _elem->GetIncludeElement() ||
+      (!_elem->FilePath().empty() && _elem->FilePath() != _path))
+  {
+    return false;
+  }
+
+  for (ElementPtr child = _elem->GetFirstElement(); child;
+       child = child->GetNextElement())
+  {
+    if (!readFromFile(child, _path))
+      return false;
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+ConversionCache::ConversionCache(const std::string &_directory)
+  : dataPtr(gz::utils::MakeUniqueImpl<Implementation>())
+{
+  this->dataPtr->directory = _directory;
+  std::random_device device;
+  this->dataPtr->temporaryId =
+      (static_cast<uint64_t>(device()) << 32) | device();
+}
+
+/////////////////////////////////////////////////
+const std::string &ConversionCache::Directory() const
+{
+  return this->dataPtr->directory;
+}
+
+/////////////////////////////////////////////////
+void ConversionCache::SetMaxSize(std::uintmax_t _size)
+{
+  this->dataPtr->maxSize = _size;
+}
+
+/////////////////////////////////////////////////
+std::uintmax_t ConversionCache::MaxSize() const
+{
+  return this->dataPtr->maxSize;
+}
+
+/////////////////////////////////////////////////
+bool ConversionCache::Find(const std::string &_path, const char *_data,
+                           std::size_t _size, const ParserConfig &_config,
+                           SDFPtr _sdf)
+{
+  if (!_data || !_sdf || !_sdf->Root() || _sdf->Root()->GetFirstElement())
+  {
+    ++this->dataPtr->misses;
+    return false;
+  }
+
+  if (!mayHaveEntry(_data, _size))
+  {
+    ++this->dataPtr->misses;
+    return false;
+  }
+
+  const std::filesystem::path entry =
+      std::filesystem::path(this->dataPtr->directory) /
+      entryName(_path, _data, _size, _config);
+
+  std::error_code ec;
+  if (!std::filesystem::is_regular_file(entry, ec))
+  {
+    ++this->dataPtr->misses;
+    return false;
+  }
+
+  // The entry name is a hash of the path, so the path stored in the entry
+  // must be the same.
+  sdf::Errors errors;
+  _sdf->LoadBinary(errors, entry.string(), _config);
+  if (!errors.empty() || _sdf->FilePath() != _path)
+  {
+    // The entry is damaged, or was written by another version of the
+    // library, so replace it when the file is read.
+    std::filesystem::remove(entry, ec);
+    ++this->dataPtr->misses;
+    return false;
+  }
+
+  // The modification time orders the entries for eviction.
+  std::filesystem::last_write_time(
+      entry, std::filesystem::file_time_type::clock::now(), ec);
+  ++this->dataPtr->hits;
+  return true;
+}
+
+/////////////////////////////////////////////////
+void ConversionCache::Insert(const std::string &_path, const char *_data,
+                             std::size_t _size, const ParserConfig &_config,
+                             const SDFPtr &_sdf)
+{
+  if (!_data || !_sdf || !_sdf->Root() ||
+      _sdf->OriginalVersion().empty() ||
+      _sdf->OriginalVersion() == SDF::Version() ||
+      !readFromFile(_sdf->Root(), _path))
+  {
+    return;
+  }
+
+  namespace fs = std::filesystem;
+  const fs::path directory(this->dataPtr->directory);
+  const fs::path entry = directory / entryName(_path, _data, _size, _config);
+  const fs::path temporary = directory /
+      (entry.stem().string() + "." +
+       std::to_string(this->dataPtr->temporaryId) + "." +
+       std::to_string(this->dataPtr->temporaryCount++) + kTemporaryExtension);
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+
+  std::error_code ec;
+  fs::create_directories(directory, ec);
+  if (ec)
+    return;
+
+  sdf::Errors errors;
+  _sdf->SaveBinary(errors, temporary.string());
+  if (!errors.empty())
+  {
+    fs::remove(temporary, ec);
+    return;
+  }
+
+  // Renaming is atomic, so other readers see either no entry or a
+  // complete one.
+  fs::rename(temporary, entry, ec);
+  if (ec)
+  {
+    fs::remove(temporary, ec);
+    return;
+  }
+
+  // Evict the least recently used entries until the cache fits. Temporary
+  // files that are old were left by processes that stopped while writing.
+  std::vector<std::pair<fs::file_time_type, fs::path>> entries;
+  std::uintmax_t total = 0;
+  const auto staleTime =
+      fs::file_time_type::clock::now() - std::chrono::hours(1);
+  for (fs::directory_iterator it(directory, ec), end; !ec && it != end;
+       it.increment(ec))
+  {
+    const fs::path &path = it->path();
+    const fs::file_time_type modified = fs::last_write_time(path, ec);
+    if (ec)
+    {
+      ec.clear();
+      continue;
+    }
+
+    if (path.extension() == kTemporaryExtension)
+    {
+      if (modified < staleTime)
+        fs::remove(path, ec);
+      ec.clear();
+      continue;
+    }
+    if (path.extension() != kEntryExtension)
+      continue;
+
+    const std::uintmax_t size = fs::file_size(path, ec);
+    if (ec)
+    {
+      ec.clear();
+      continue;
+    }
+    total += size;
+    entries.emplace_back(modified, path);
+  }
+
+  const std::uintmax_t maxSize = this->dataPtr->maxSize;
+  if (total <= maxSize)
+    return;
+
+  std::sort(entries.begin(), entries.end());
+  for (const auto &[modified, path] : entries)
+  {
+    if (total <= maxSize)
+      break;
+    // Keep the new entry, which may have the same time as older ones.
+    if (path == entry)
+      continue;
+    const std::uintmax_t size = fs::file_size(path, ec);
+    if (!ec && fs::remove(path, ec))
+      total -= std::min(size, total);
+    ec.clear();
+  }
+}
+
+/////////////////////////////////////////////////
+void ConversionCache::Clear()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+
+  std::error_code ec;
+  for (std::filesystem::directory_iterator it(this->dataPtr->directory, ec),
+       end; !ec && it != end; it.increment(ec))
+  {
+    const std::filesystem::path &path = it->path();
+    if (path.extension() == kEntryExtension ||
+        path.extension() == kTemporaryExtension)
+    {
+      std::error_code removeEc;
+      std::filesystem::remove(path, removeEc);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+std::uintmax_t ConversionCache::Size() const
+{
+  std::uintmax_t total = 0;
+  std::error_code ec;
+  for (std::filesystem::directory_iterator it(this->dataPtr->directory, ec),
+       end; !ec && it != end; it.increment(ec))
+  {
+    if (it->path().extension() != kEntryExtension)
+      continue;
+
+    std::error_code sizeEc;
+    const std::uintmax_t size = std::filesystem::file_size(it->path(), sizeEc);
+    if (!sizeEc)
+      total += size;
+  }
+  return total;
+}
+
+/////////////////////////////////////////////////
+uint64_t ConversionCache::Hits() const
+{
+  return this->dataPtr->hits;
+}
+
+/////////////////////////////////////////////////
+uint64_t ConversionCache::Misses() const
+{
+  return this->dataPtr->misses;
+}
@@ -0,0 +1,247 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/ConversionCache.hh"
+#include "sdf/Element.hh"
+#include "sdf/ParserConfig.hh"
+#include "sdf/SDFImpl.hh"
+#include "sdf/parser.hh"
+
+/////////////////////////////////////////////////
+/// \brief Create a file with a model in the temporary directory.
+/// \param[in] _name Name of the file.
+/// \param[in] _version SDFormat version of the file.
+/// \return Path of the file.
+static std::string modelFile(const std::string &_name,
+                             const std::string &_version)
+{
+  const std::filesystem::path path =
+      std::filesystem::temp_directory_path() / _name;
+  std::ofstream(path)
+    << "<sdf version='" << _version << "'>"
+    << "<model name='" << _name << "'>"
+    << "<link name='link'><pose>0 0 1 0 0 0</pose></link>"
+    << "</model></sdf>";
+  return path.string();
+}
+
+/////////////////////////////////////////////////
+/// \brief Read a file.
+/// \param[in] _path Path of the file.
+/// \param[in] _config Parser configuration.
+/// \return The document.
+static sdf::SDFPtr read(const std::string &_path,
+                        const sdf::ParserConfig &_config)
+{
+  sdf::SDFPtr sdf(new sdf::SDF());
+  sdf::init(sdf, _config);
+  sdf::Errors errors;
+  EXPECT_TRUE(sdf::readFile(_path, _config, sdf, errors)) << errors;
+  EXPECT_TRUE(errors.empty()) << errors;
+  return sdf;
+}
+
+/////////////////////////////////////////////////
+/// \brief Create an empty cache directory.
+/// \param[in] _name Name of the directory.
+/// \return The cache.
+static std::shared_ptr<sdf::ConversionCache> emptyCache(
+    const std::string &_name)
+{
+  const std::filesystem::path directory =
+      std::filesystem::temp_directory_path() / _name;
+  std::filesystem::remove_all(directory);
+  return std::make_shared<sdf::ConversionCache>(directory.string());
+}
+
+/////////////////////////////////////////////////
+TEST(ConversionCache, Construction)
+{
+  sdf::ConversionCache cache("directory");
+  EXPECT_EQ("directory", cache.Directory());
+  EXPECT_EQ(256u * 1024u * 1024u, cache.MaxSize());
+  cache.SetMaxSize(1024u);
+  EXPECT_EQ(1024u, cache.MaxSize());
+
+  // The directory does not exist yet
+  EXPECT_EQ(0u, cache.Size());
+  EXPECT_EQ(0u, cache.Hits());
+  EXPECT_EQ(0u, cache.Misses());
+  cache.Clear();
+}
+
+/////////////////////////////////////////////////
+TEST(ConversionCache, ReadFile)
+{
+  auto cache = emptyCache("sdf_conversion_cache_read");
+  sdf::ParserConfig config;
+  config.SetConversionCache(cache);
+
+  const std::string path = modelFile("sdf_conversion_cache.sdf", "1.6");
+  sdf::SDFPtr first = read(path, config);
+  EXPECT_EQ(0u, cache->Hits());
+  EXPECT_EQ(1u, cache->Misses());
+  EXPECT_GT(cache->Size(), 0u);
+
+  sdf::SDFPtr second = read(path, config);
+  EXPECT_EQ(1u, cache->Hits());
+  EXPECT_EQ(1u, cache->Misses());
+  EXPECT_EQ(first->ToString(), second->ToString());
+  EXPECT_EQ(path, second->FilePath());
+  EXPECT_EQ("1.6", second->OriginalVersion());
+
+  // Other policies give other entries
+  sdf::ParserConfig strictConfig = config;
+  strictConfig.SetWarningsPolicy(sdf::EnforcementPolicy::ERR);
+  read(path, strictConfig);
+  EXPECT_EQ(1u, cache->Hits());
+  EXPECT_EQ(2u, cache->Misses());
+
+  // Reading without conversion does not use the cache
+  sdf::SDFPtr sdf(new sdf::SDF());
+  sdf::init(sdf, config);
+  sdf::Errors errors;
+  sdf::readFileWithoutConversion(path, config, sdf, errors);
+  EXPECT_EQ(1u, cache->Hits());
+  EXPECT_EQ(2u, cache->Misses());
+
+  // A changed file is read again
+  modelFile("sdf_conversion_cache.sdf", "1.5");
+  sdf::SDFPtr changed = read(path, config);
+  EXPECT_EQ("1.5", changed->OriginalVersion());
+  EXPECT_EQ(1u, cache->Hits());
+  EXPECT_EQ(3u, cache->Misses());
+
+  cache->Clear();
+  EXPECT_EQ(0u, cache->Size());
+  read(path, config);
+  EXPECT_EQ(1u, cache->Hits());
+  EXPECT_EQ(4u, cache->Misses());
+}
+
+/////////////////////////////////////////////////
+TEST(ConversionCache, CurrentVersionNotCached)
+{
+  auto cache = emptyCache("sdf_conversion_cache_current");
+  sdf::ParserConfig config;
+  config.SetConversionCache(cache);
+
+  const std::string path =
+      modelFile("sdf_conversion_cache_current.sdf", SDF_VERSION);
+  read(path, config);
+  read(path, config);
+  EXPECT_EQ(0u, cache->Hits());
+  EXPECT_EQ(2u, cache->Misses());
+  EXPECT_EQ(0u, cache->Size());
+}
+
+/////////////////////////////////////////////////
+TEST(ConversionCache, DamagedEntry)
+{
+  auto cache = emptyCache("sdf_conversion_cache_damaged");
+  sdf::ParserConfig config;
+  config.SetConversionCache(cache);
+
+  const std::string path = modelFile("sdf_conversion_cache_damaged.sdf", "1.6");
+  sdf::SDFPtr expected = read(path, config);
+  for (const auto &entry :
+       std::filesystem::directory_iterator(cache->Directory()))
+  {
+    std::ofstream(entry.path(), std::ios::binary) << "damaged";
+  }
+
+  sdf::SDFPtr sdf = read(path, config);
+  EXPECT_EQ(expected->ToString(), sdf->ToString());
+  EXPECT_EQ(0u, cache->Hits());
+  EXPECT_EQ(2u, cache->Misses());
+
+  // The entry is written again
+  read(path, config);
+  EXPECT_EQ(1u, cache->Hits());
+}
+
+/////////////////////////////////////////////////
+TEST(ConversionCache, EntryOfAnotherFile)
+{
+  auto cache = emptyCache("sdf_conversion_cache_other");
+  sdf::ParserConfig config;
+  config.SetConversionCache(cache);
+
+  // Read two files, and find the entry of each one
+  const std::string first = modelFile("sdf_conversion_cache_c.sdf", "1.6");
+  const std::string second = modelFile("sdf_conversion_cache_d.sdf", "1.6");
+  read(first, config);
+  std::filesystem::path firstEntry;
+  for (const auto &entry :
+       std::filesystem::directory_iterator(cache->Directory()))
+  {
+    firstEntry = entry.path();
+  }
+  sdf::SDFPtr expected = read(second, config);
+  std::filesystem::path secondEntry;
+  for (const auto &entry :
+       std::filesystem::directory_iterator(cache->Directory()))
+  {
+    if (entry.path() != firstEntry)
+      secondEntry = entry.path();
+  }
+  ASSERT_FALSE(firstEntry.empty());
+  ASSERT_FALSE(secondEntry.empty());
+  EXPECT_EQ(64u + 5u, secondEntry.filename().string().size());
+
+  // An entry that holds the document of another file is not used
+  std::filesystem::copy_file(firstEntry, secondEntry,
+      std::filesystem::copy_options::overwrite_existing);
+  sdf::SDFPtr sdf = read(second, config);
+  EXPECT_EQ(second, sdf->FilePath());
+  EXPECT_EQ(expected->ToString(), sdf->ToString());
+  EXPECT_EQ(0u, cache->Hits());
+  EXPECT_EQ(3u, cache->Misses());
+}
+
+/////////////////////////////////////////////////
+TEST(ConversionCache, Eviction)
+{
+  auto cache = emptyCache("sdf_conversion_cache_eviction");
+  sdf::ParserConfig config;
+  config.SetConversionCache(cache);
+
+  const std::string first = modelFile("sdf_conversion_cache_a.sdf", "1.6");
+  const std::string second = modelFile("sdf_conversion_cache_b.sdf", "1.6");
+  read(first, config);
+  const std::uintmax_t entrySize = cache->Size();
+  ASSERT_GT(entrySize, 0u);
+
+  // Only one entry fits, so the least recently used one is removed
+  cache->SetMaxSize(entrySize + entrySize / 2);
+  read(second, config);
+  EXPECT_LE(cache->Size(), cache->MaxSize());
+  EXPECT_EQ(0u, cache->Hits());
+
+  read(second, config);
+  EXPECT_EQ(1u, cache->Hits());
+  read(first, config);
+  EXPECT_EQ(1u, cache->Hits());
+  EXPECT_EQ(3u, cache->Misses());
+}
@@ -16,7 +16,11 @@
  */
 
 #include <algorithm>
+#include <cstring>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <set>
 #include <sstream>
 #include <string>
@@ -42,6 +46,23 @@ bool EndsWith(const std::string& _a, const std::string& _b)
       (_a.compare(_a.size() - _b.size(), _b.size(), _b) == 0);
 }
 
+/////////////////////////////////////////////////
+// returns an attribute of a convert element, or nullopt if either is missing
+std::optional<std::string> OptionalAttribute(
+    const tinyxml2::XMLElement *_elem, const char *_name)
+{
+  if (_elem == nullptr || _elem->Attribute(_name) == nullptr)
+    return std::nullopt;
+  return std::string(_elem->Attribute(_name));
+}
+
+/////////////////////////////////////////////////
+// returns the string of an attribute compiled by OptionalAttribute, or nullptr
+const char *CStr(const std::optional<std::string> &_value)
+{
+  return _value ? _value->c_str() : nullptr;
+}
+
 /////////////////////////////////////////////////
 // returns true if the element is not one of the listed for Unflatten conversion
 bool IsNotFlattenedElement(const std::string &_elemName)
@@ -77,6 +98,92 @@ void UpdatePose(tinyxml2::XMLElement *_elem,
 }
 }
 
+/////////////////////////////////////////////////
+struct Converter::Operation
+{
+  /// \brief Kind of operation, from the name of its element.
+  enum class Type
+  {
+    RENAME,
+    COPY,
+    MAP,
+    MOVE,
+    ADD,
+    REMOVE,
+    REMOVE_EMPTY,
+    UNFLATTEN,
+    UNKNOWN
+  };
+
+  /// \brief Kind of operation.
+  Type type = Type::UNKNOWN;
+
+  /// \brief Name of the element of the operation.
+  std::string name;
+
+  /// \brief Attributes of the <from> and <to> elements of rename, copy and
+  /// move.
+  std::optional<std::string> fromElement;
+  std::optional<std::string> fromAttribute;
+  std::optional<std::string> toElement;
+  std::optional<std::string> toAttribute;
+
+  /// \brief Attributes of add, remove and remove_empty.
+  std::optional<std::string> element;
+  std::optional<std::string> attribute;
+  std::optional<std::string> value;
+
+  /// \brief Source and destination of copy, move and map, split into the
+  /// names of elements.
+  std::vector<std::string> fromTokens;
+  std::vector<std::string> toTokens;
+
+  /// \brief Values of map.
+  std::map<std::string, std::string> valueMap;
+
+  /// \brief Error of an invalid map, which is reported each time it is
+  /// applied.
+  std::string error;
+};
+
+/////////////////////////////////////////////////
+struct Converter::Program
+{
+  /// \brief The recipe is applied to the children with this name.
+  std::optional<std::string> name;
+
+  /// \brief The recipe is applied to the descendants with this name.
+  std::optional<std::string> descendantName;
+
+  /// \brief Text of the <deprecated> elements.
+  std::vector<std::string> deprecated;
+
+  /// \brief Nested <convert> elements.
+  std::vector<Program> children;
+
+  /// \brief Other elements, in order.
+  std::vector<Operation> operations;
+};
+
+/////////////////////////////////////////////////
+struct Converter::Step
+{
+  /// \brief Version that the step converts to.
+  std::string toVersion;
+
+  /// \brief XML of the recipe.
+  const std::string *xml = nullptr;
+
+  /// \brief Flag to compile the recipe once.
+  std::once_flag compiled;
+
+  /// \brief The compiled recipe.
+  Program program;
+
+  /// \brief Error of parsing the XML of the recipe, if any.
+  std::string error;
+};
+
 /////////////////////////////////////////////////
 bool Converter::Convert(sdf::Errors &_errors,
                         tinyxml2::XMLDocument *_doc,
@@ -121,45 +228,26 @@ bool Converter::Convert(sdf::Errors &_errors,
 
   elem->SetAttribute("version", _toVersion.c_str());
 
-  // The conversion recipes within the embedded files database are named, e.g.,
-  // "1.8/1_7.convert" to upgrade from 1.7 to 1.8.
-  const std::map<std::string, std::string> &embedded = GetEmbeddedSdf();
-
   // Apply the conversions one at a time until we reach the desired _toVersion.
   std::string curVersion = origVersion;
   while (curVersion != _toVersion)
   {
-    // Find the (at most one) file named, e.g., ".../1_7.convert".
-    std::string snakeVersion = curVersion;
-    std::replace(snakeVersion.begin(), snakeVersion.end(), '.', '_');
-    const std::string suffix = "/" + snakeVersion + ".convert";
-    const char* convertXml = nullptr;
-    for (const auto& [pathname, data] : embedded)
-    {
-      if (EndsWith(pathname, suffix))
-      {
-        curVersion = pathname.substr(0, pathname.size() - suffix.size());
-        convertXml = data.c_str();
-        break;
-      }
-    }
-    if (convertXml == nullptr)
+    const Step *step = EmbeddedStep(curVersion);
+    if (step == nullptr)
     {
       break;
     }
+    curVersion = step->toVersion;
 
-    // Parse and apply the conversion XML.
-    tinyxml2::XMLDocument xmlDoc;
-    xmlDoc.Parse(convertXml);
-    if (xmlDoc.Error())
+    if (!step->error.empty())
     {
       std::stringstream ss;
       ss << "Error parsing XML from string: "
-         << xmlDoc.ErrorStr();
+         << step->error;
       _errors.push_back({ErrorCode::CONVERSION_ERROR, ss.str()});
       return false;
     }
-    ConvertImpl(elem, xmlDoc.FirstChildElement("convert"), _config, _errors);
+    ConvertImpl(elem, step->program, _config, _errors);
   }
 
   // Check that we actually converted to the desired final version.
@@ -186,17 +274,197 @@ void Converter::Convert(sdf::Errors &_errors,
   SDF_ASSERT(_doc != NULL, "SDF XML doc is NULL");
   SDF_ASSERT(_convertDoc != NULL, "Convert XML doc is NULL");
 
-  ConvertImpl(_doc->FirstChildElement(), _convertDoc->FirstChildElement(),
-              _config, _errors);
+  Program program;
+  Compile(_convertDoc->FirstChildElement(), program);
+  ConvertImpl(_doc->FirstChildElement(), program, _config, _errors);
+}
+
+/////////////////////////////////////////////////
+const Converter::Step *Converter::EmbeddedStep(
+    const std::string &_fromVersion)
+{
+  // The conversion recipes within the embedded files database are named, e.g.,
+  // "1.8/1_7.convert" to upgrade from 1.7 to 1.8. They are indexed by the
+  // version they upgrade from, and compiled when they are first used.
+  static const std::map<std::string, std::unique_ptr<Step>> steps = []()
+  {
+    const std::string extension = ".convert";
+    std::map<std::string, std::unique_ptr<Step>> result;
+    for (const auto& [pathname, data] : GetEmbeddedSdf())
+    {
+      const size_t slash = pathname.rfind('/');
+      if (slash == std::string::npos || !EndsWith(pathname, extension))
+      {
+        continue;
+      }
+      auto step = std::make_unique<Step>();
+      step->toVersion = pathname.substr(0, slash);
+      step->xml = &data;
+      result.emplace(pathname.substr(slash + 1,
+          pathname.size() - slash - 1 - extension.size()), std::move(step));
+    }
+    return result;
+  }();
+
+  std::string snakeVersion = _fromVersion;
+  std::replace(snakeVersion.begin(), snakeVersion.end(), '.', '_');
+  auto it = steps.find(snakeVersion);
+  if (it == steps.end())
+  {
+    return nullptr;
+  }
+
+  Step &step = *it->second;
+  std::call_once(step.compiled, [&step]()
+      {
+        tinyxml2::XMLDocument xmlDoc;
+        xmlDoc.Parse(step.xml->c_str());
+        if (xmlDoc.Error())
+        {
+          step.error = xmlDoc.ErrorStr();
+          return;
+        }
+        Compile(xmlDoc.FirstChildElement("convert"), step.program);
+      });
+  return &step;
+}
+
+/////////////////////////////////////////////////
+void Converter::Compile(const tinyxml2::XMLElement *_convert,
+                        Program &_program)
+{
+  SDF_ASSERT(_convert != NULL, "Convert element is NULL");
+
+  _program.name = OptionalAttribute(_convert, "name");
+  _program.descendantName = OptionalAttribute(_convert, "descendant_name");
+
+  for (auto *deprecatedElem = _convert->FirstChildElement("deprecated");
+       deprecatedElem;
+       deprecatedElem = deprecatedElem->NextSiblingElement("deprecated"))
+  {
+    const char *text = deprecatedElem->GetText();
+    _program.deprecated.push_back(text ? text : "");
+  }
+
+  // Errors of a map do not depend on the document, so they are found here
+  // and reported when the map is applied.
+  auto compileMap = [](const tinyxml2::XMLElement *_mapElem,
+                       Operation &_map) -> std::string
+  {
+    auto *fromConvertElem = _mapElem->FirstChildElement("from");
+    auto *toConvertElem = _mapElem->FirstChildElement("to");
+    if (!fromConvertElem)
+      return "<map> element requires a <from> child element.";
+    if (!toConvertElem)
+      return "<map> element requires a <to> child element.";
+
+    const char *fromNameStr = fromConvertElem->Attribute("name");
+    const char *toNameStr = toConvertElem->Attribute("name");
+    if (!fromNameStr || strlen(fromNameStr) == 0)
+      return "Map: <from> element requires a non-empty name attribute.";
+    if (!toNameStr || strlen(toNameStr) == 0)
+      return "Map: <to> element requires a non-empty name attribute.";
+
+    // create map of input and output values
+    auto *fromValueElem = fromConvertElem->FirstChildElement("value");
+    auto *toValueElem = toConvertElem->FirstChildElement("value");
+    if (!fromValueElem)
+      return "Map: <from> element requires at least one <value> element";
+    if (!toValueElem)
+      return "Map: <to> element requires at least one <value> element.";
+    if (!fromValueElem->GetText())
+      return "Map: from value must not be empty.";
+    if (!toValueElem->GetText())
+      return "Map: to value must not be empty.";
+    _map.valueMap[fromValueElem->GetText()] = toValueElem->GetText();
+    while (fromValueElem->NextSiblingElement("value"))
+    {
+      fromValueElem = fromValueElem->NextSiblingElement("value");
+      if (toValueElem->NextSiblingElement("value"))
+      {
+        toValueElem = toValueElem->NextSiblingElement("value");
+      }
+      if (!fromValueElem->GetText())
+        return "Map: from value must not be empty.";
+      if (!toValueElem->GetText())
+        return "Map: to value must not be empty.";
+      _map.valueMap[fromValueElem->GetText()] = toValueElem->GetText();
+    }
+
+    // tokenize 'from' and 'to' name attributes
+    _map.fromTokens = split(fromNameStr, "/");
+    _map.toTokens = split(toNameStr, "/");
+    return "";
+  };
+
+  for (const tinyxml2::XMLElement *childElem = _convert->FirstChildElement();
+       childElem; childElem = childElem->NextSiblingElement())
+  {
+    Operation op;
+    op.name = childElem->Name();
+
+    if (op.name == "convert")
+    {
+      _program.children.emplace_back();
+      Compile(childElem, _program.children.back());
+      continue;
+    }
+    else if (op.name == "rename" || op.name == "copy" || op.name == "move")
+    {
+      if (op.name == "rename")
+        op.type = Operation::Type::RENAME;
+      else if (op.name == "copy")
+        op.type = Operation::Type::COPY;
+      else
+        op.type = Operation::Type::MOVE;
+
+      auto *fromConvertElem = childElem->FirstChildElement("from");
+      auto *toConvertElem = childElem->FirstChildElement("to");
+      op.fromElement = OptionalAttribute(fromConvertElem, "element");
+      op.fromAttribute = OptionalAttribute(fromConvertElem, "attribute");
+      op.toElement = OptionalAttribute(toConvertElem, "element");
+      op.toAttribute = OptionalAttribute(toConvertElem, "attribute");
+
+      // tokenize 'from' and 'to' strs
+      op.fromTokens = split(
+          op.fromElement.value_or(op.fromAttribute.value_or("")), "::");
+      op.toTokens = split(
+          op.toElement.value_or(op.toAttribute.value_or("")), "::");
+    }
+    else if (op.name == "map")
+    {
+      op.type = Operation::Type::MAP;
+      op.error = compileMap(childElem, op);
+    }
+    else if (op.name == "add" || op.name == "remove" ||
+             op.name == "remove_empty")
+    {
+      if (op.name == "add")
+        op.type = Operation::Type::ADD;
+      else if (op.name == "remove")
+        op.type = Operation::Type::REMOVE;
+      else
+        op.type = Operation::Type::REMOVE_EMPTY;
+
+      op.element = OptionalAttribute(childElem, "element");
+      op.attribute = OptionalAttribute(childElem, "attribute");
+      op.value = OptionalAttribute(childElem, "value");
+    }
+    else if (op.name == "unflatten")
+    {
+      op.type = Operation::Type::UNFLATTEN;
+    }
+    _program.operations.push_back(std::move(op));
+  }
 }
 
 /////////////////////////////////////////////////
 void Converter::ConvertDescendantsImpl(tinyxml2::XMLElement *_e,
-                                       tinyxml2::XMLElement *_c,
+                                       const Program &_c,
                                        const ParserConfig &_config,
                                        sdf::Errors &_errors)
 {
-  if (!_c->Attribute("descendant_name"))
+  if (!_c.descendantName)
   {
     return;
   }
@@ -214,7 +482,7 @@ void Converter::ConvertDescendantsImpl(tinyxml2::XMLElement *_e,
   tinyxml2::XMLElement *e = _e->FirstChildElement();
   while (e)
   {
-    if (strcmp(e->Name(), _c->Attribute("descendant_name")) == 0)
+    if (*_c.descendantName == e->Name())
     {
       ConvertImpl(e, _c, _config, _errors);
     }
@@ -225,78 +493,69 @@ void Converter::ConvertDescendantsImpl(tinyxml2::XMLElement *_e,
 
 /////////////////////////////////////////////////
 void Converter::ConvertImpl(tinyxml2::XMLElement *_elem,
-                            tinyxml2::XMLElement *_convert,
+                            const Program &_convert,
                             const ParserConfig &_config,
                             sdf::Errors &_errors)
 {
   SDF_ASSERT(_elem != NULL, "SDF element is NULL");
-  SDF_ASSERT(_convert != NULL, "Convert element is NULL");
 
   CheckDeprecation(_elem, _convert, _config, _errors);
 
-  for (auto *convertElem = _convert->FirstChildElement("convert");
-       convertElem; convertElem = convertElem->NextSiblingElement("convert"))
+  for (const Program &convert : _convert.children)
   {
-    if (convertElem->Attribute("name"))
+    if (convert.name)
     {
       tinyxml2::XMLElement *elem = _elem->FirstChildElement(
-          convertElem->Attribute("name"));
+          convert.name->c_str());
       while (elem)
       {
-        ConvertImpl(elem, convertElem, _config, _errors);
-        elem = elem->NextSiblingElement(convertElem->Attribute("name"));
+        ConvertImpl(elem, convert, _config, _errors);
+        elem = elem->NextSiblingElement(convert.name->c_str());
       }
     }
-    if (convertElem->Attribute("descendant_name"))
+    if (convert.descendantName)
     {
-      ConvertDescendantsImpl(_elem, convertElem, _config, _errors);
+      ConvertDescendantsImpl(_elem, convert, _config, _errors);
     }
   }
 
-  for (tinyxml2::XMLElement *childElem = _convert->FirstChildElement();
-       childElem; childElem = childElem->NextSiblingElement())
+  for (const Operation &op : _convert.operations)
   {
-    const auto name = std::string(childElem->Name());
-
-    if (name == "rename")
+    switch (op.type)
     {
-      Rename(_elem, childElem, _errors);
-    }
-    else if (name == "copy")
-    {
-      Move(_elem, childElem, true, _errors);
-    }
-    else if (name == "map")
-    {
-      Map(_elem, childElem, _errors);
-    }
-    else if (name == "move")
-    {
-      Move(_elem, childElem, false, _errors);
-    }
-    else if (name == "add")
-    {
-      Add(_elem, childElem, _errors);
-    }
-    else if (name == "remove")
-    {
-      Remove(_errors, _elem, childElem);
-    }
-    else if (name == "remove_empty")
-    {
-      Remove(_errors, _elem, childElem, true);
-    }
-    else if (name == "unflatten")
-    {
-      Unflatten(_elem, _errors);
-    }
-    else if (name != "convert")
-    {
-      std::stringstream ss;
-      ss << "Unknown convert element["
-         << name
-         << "]";
-      _errors.push_back({ErrorCode::CONVERSION_ERROR, ss.str()});
+      case Operation::Type::RENAME:
+        Rename(_elem, op, _errors);
+        break;
+      case Operation::Type::COPY:
+        Move(_elem, op, true, _errors);
+        break;
+      case Operation::Type::MAP:
+        Map(_elem, op, _errors);
+        break;
+      case Operation::Type::MOVE:
+        Move(_elem, op, false, _errors);
+        break;
+      case Operation::Type::ADD:
+        Add(_elem, op, _errors);
+        break;
+      case Operation::Type::REMOVE:
+        Remove(_errors, _elem, op);
+        break;
+      case Operation::Type::REMOVE_EMPTY:
+        Remove(_errors, _elem, op, true);
+        break;
+      case Operation::Type::UNFLATTEN:
+        Unflatten(_elem, _errors);
+        break;
+      case Operation::Type::UNKNOWN:
+      {
+        std::stringstream ss;
+        ss << "Unknown convert element["
+           << op.name
+           << "]";
+        _errors.push_back({ErrorCode::CONVERSION_ERROR, ss.str()});
+        break;
+      }
     }
   }
 }
@@ -576,20 +835,16 @@ bool Converter::FindNewModelElements(tinyxml2::XMLElement *_elem,
 
 /////////////////////////////////////////////////
 void Converter::Rename(tinyxml2::XMLElement *_elem,
-                       tinyxml2::XMLElement *_renameElem,
+                       const Operation &_rename,
                        sdf::Errors &_errors)
 {
   SDF_ASSERT(_elem != NULL, "SDF element is NULL");
-  SDF_ASSERT(_renameElem != NULL, "Rename element is NULL");
-
-  auto *fromConvertElem = _renameElem->FirstChildElement("from");
-  auto *toConvertElem = _renameElem->FirstChildElement("to");
 
-  const char *fromElemName = fromConvertElem->Attribute("element");
-  const char *fromAttrName = fromConvertElem->Attribute("attribute");
+  const char *fromElemName = CStr(_rename.fromElement);
+  const char *fromAttrName = CStr(_rename.fromAttribute);
 
-  const char *toElemName = toConvertElem->Attribute("element");
-  const char *toAttrName = toConvertElem->Attribute("attribute");
+  const char *toElemName = CStr(_rename.toElement);
+  const char *toAttrName = CStr(_rename.toAttribute);
 
   const char *value = GetValue(fromElemName, fromAttrName, _elem);
   if (!value)
@@ -631,15 +886,14 @@ void Converter::Rename(tinyxml2::XMLElement *_elem,
 
 /////////////////////////////////////////////////
 void Converter::Add(tinyxml2::XMLElement *_elem,
-                    tinyxml2::XMLElement *_addElem,
+                    const Operation &_add,
                     sdf::Errors &_errors)
 {
   SDF_ASSERT(_elem != NULL, "SDF element is NULL");
-  SDF_ASSERT(_addElem != NULL, "Add element is NULL");
 
-  const char *attributeName = _addElem->Attribute("attribute");
-  const char *elementName = _addElem->Attribute("element");
-  const char *value = _addElem->Attribute("value");
+  const char *attributeName = CStr(_add.attribute);
+  const char *elementName = CStr(_add.element);
+  const char *value = CStr(_add.value);
 
   if (!((attributeName == nullptr) ^ (elementName == nullptr)))
   {
@@ -677,14 +931,13 @@ void Converter::Add(tinyxml2::XMLElement *_elem,
 /////////////////////////////////////////////////
 void Converter::Remove(sdf::Errors &_errors,
                        tinyxml2::XMLElement *_elem,
-                       tinyxml2::XMLElement *_removeElem,
+                       const Operation &_remove,
                        bool _removeOnlyEmpty)
 {
   SDF_ASSERT(_elem != NULL, "SDF element is NULL");
-  SDF_ASSERT(_removeElem != NULL, "remove element is NULL");
 
-  const char *attributeName = _removeElem->Attribute("attribute");
-  const char *elementName = _removeElem->Attribute("element");
+  const char *attributeName = CStr(_remove.attribute);
+  const char *elementName = CStr(_remove.element);
 
   if (!((attributeName == nullptr) ^ (elementName == nullptr)))
   {
@@ -720,101 +973,19 @@ void Converter::Remove(sdf::Errors &_errors,
 
 /////////////////////////////////////////////////
 void Converter::Map(tinyxml2::XMLElement *_elem,
-                    tinyxml2::XMLElement *_mapElem,
+                    const Operation &_map,
                     sdf::Errors &_errors)
 {
   SDF_ASSERT(_elem != nullptr, "SDF element is nullptr");
-  SDF_ASSERT(_mapElem != nullptr, "Map element is nullptr");
-
-  tinyxml2::XMLElement *fromConvertElem = _mapElem->FirstChildElement("from");
-  tinyxml2::XMLElement *toConvertElem = _mapElem->FirstChildElement("to");
 
-  if (!fromConvertElem)
+  if (!_map.error.empty())
   {
-    _errors.push_back({ErrorCode::CONVERSION_ERROR,
-        "<map> element requires a <from> child element."});
-    return;
-  }
-  if (!toConvertElem)
-  {
-    _errors.push_back({ErrorCode::CONVERSION_ERROR,
-        "<map> element requires a <to> child element."});
+    _errors.push_back({ErrorCode::CONVERSION_ERROR, _map.error});
     return;
   }
 
-  const char *fromNameStr = fromConvertElem->Attribute("name");
-  const char *toNameStr = toConvertElem->Attribute("name");
-
-  if (!fromNameStr || strlen(fromNameStr) == 0)
-  {
-    _errors.push_back({ErrorCode::CONVERSION_ERROR,
-        "Map: <from> element requires a non-empty name attribute."});
-    return;
-  }
-  if (!toNameStr || strlen(toNameStr) == 0)
-  {
-    _errors.push_back({ErrorCode::CONVERSION_ERROR,
-        "Map: <to> element requires a non-empty name attribute."});
-    return;
-  }
-
-  // create map of input and output values
-  std::map<std::string, std::string> valueMap;
-  auto *fromValueElem = fromConvertElem->FirstChildElement("value");
-  auto *toValueElem = toConvertElem->FirstChildElement("value");
-  if (!fromValueElem)
-  {
-    _errors.push_back({ErrorCode::CONVERSION_ERROR,
-        "Map: <from> element requires at least one <value> element"});
-    return;
-  }
-  if (!toValueElem)
-  {
-    _errors.push_back({ErrorCode::CONVERSION_ERROR,
-        "Map: <to> element requires at least one <value> element."});
-    return;
-  }
-  if (!fromValueElem->GetText())
-  {
-    _errors.push_back({ErrorCode::CONVERSION_ERROR,
-        "Map: from value must not be empty."});
-    return;
-  }
-  if (!toValueElem->GetText())
-  {
-    _errors.push_back({ErrorCode::CONVERSION_ERROR,
-        "Map: to value must not be empty."});
-    return;
-  }
-  valueMap[fromValueElem->GetText()] = toValueElem->GetText();
-  while (fromValueElem->NextSiblingElement("value"))
-  {
-    fromValueElem = fromValueElem->NextSiblingElement("value");
-    if (toValueElem->NextSiblingElement("value"))
-    {
-      toValueElem = toValueElem->NextSiblingElement("value");
-    }
-    if (!fromValueElem->GetText())
-    {
-      _errors.push_back({ErrorCode::CONVERSION_ERROR,
-          "Map: from value must not be empty."});
-      return;
-    }
-    if (!toValueElem->GetText())
-    {
-      _errors.push_back({ErrorCode::CONVERSION_ERROR,
-          "Map: to value must not be empty."});
-      return;
-    }
-    valueMap[fromValueElem->GetText()] = toValueElem->GetText();
-  }
-
-  // tokenize 'from' and 'to' name attributes
-  std::string fromStr = fromNameStr;
-  std::string toStr = toNameStr;
-
-  std::vector<std::string> fromTokens = split(fromStr, "/");
-  std::vector<std::string> toTokens = split(toStr, "/");
+  const std::vector<std::string> &fromTokens = _map.fromTokens;
+  const std::vector<std::string> &toTokens = _map.toTokens;
 
   // split() always returns at least one element, even with the
   // empty string.  Thus we don't check if the fromTokens or toTokens are empty.
@@ -852,12 +1023,14 @@ void Converter::Map(tinyxml2::XMLElement *_elem,
     fromValue = GetValue(fromLeaf, nullptr, fromElem);
   }
 
-  if (!fromValue || valueMap.end() == valueMap.find(std::string(fromValue)))
+  auto mapped = fromValue ? _map.valueMap.find(fromValue) :
+      _map.valueMap.end();
+  if (mapped == _map.valueMap.end())
   {
     // No match, no message to avoid spam.
     return;
   }
-  const char *toValue = valueMap[std::string(fromValue)].c_str();
+  const char *toValue = mapped->second.c_str();
   // sdfdbg << "Map from [" << fromValue << "] to [" << toValue << "]\n";
 
   // check if destination elements before leaf exist and create if necessary
@@ -922,44 +1095,20 @@ void Converter::Map(tinyxml2::XMLElement *_elem,
 
 /////////////////////////////////////////////////
 void Converter::Move(tinyxml2::XMLElement *_elem,
-                     tinyxml2::XMLElement *_moveElem,
+                     const Operation &_move,
                      const bool _copy,
                      sdf::Errors &_errors)
 {
   SDF_ASSERT(_elem != NULL, "SDF element is NULL");
-  SDF_ASSERT(_moveElem != NULL, "Move element is NULL");
 
-  tinyxml2::XMLElement *fromConvertElem = _moveElem->FirstChildElement("from");
-  tinyxml2::XMLElement *toConvertElem = _moveElem->FirstChildElement("to");
+  const char *fromElemStr = CStr(_move.fromElement);
+  const char *fromAttrStr = CStr(_move.fromAttribute);
 
-  const char *fromElemStr = fromConvertElem->Attribute("element");
-  const char *fromAttrStr = fromConvertElem->Attribute("attribute");
+  const char *toElemStr = CStr(_move.toElement);
+  const char *toAttrStr = CStr(_move.toAttribute);
 
-  const char *toElemStr = toConvertElem->Attribute("element");
-  const char *toAttrStr = toConvertElem->Attribute("attribute");
-
-  // tokenize 'from' and 'to' strs
-  std::string fromStr = "";
-  if (fromElemStr)
-  {
-    fromStr = fromElemStr;
-  }
-  else if (fromAttrStr)
-  {
-    fromStr = fromAttrStr;
-  }
-  std::string toStr = "";
-  if (toElemStr)
-  {
-    toStr = toElemStr;
-  }
-  else if (toAttrStr)
-  {
-    toStr = toAttrStr;
-  }
-
-  std::vector<std::string> fromTokens = split(fromStr, "::");
-  std::vector<std::string> toTokens = split(toStr, "::");
+  const std::vector<std::string> &fromTokens = _move.fromTokens;
+  const std::vector<std::string> &toTokens = _move.toTokens;
 
   // split() always returns at least one element, even with the
   // empty string.  Thus we don't check if the fromTokens or toTokens are empty.
@@ -1111,16 +1260,13 @@ const char *Converter::GetValue(const char *_valueElem, const char *_valueAttr,
 
 /////////////////////////////////////////////////
 void Converter::CheckDeprecation(tinyxml2::XMLElement *_elem,
-                                 tinyxml2::XMLElement *_convert,
+                                 const Program &_convert,
                                  const ParserConfig &_config,
                                  sdf::Errors &_errors)
 {
   // Process deprecated elements
-  for (auto *deprecatedElem = _convert->FirstChildElement("deprecated");
-       deprecatedElem;
-       deprecatedElem = deprecatedElem->NextSiblingElement("deprecated"))
+  for (const std::string &value : _convert.deprecated)
   {
-    std::string value = deprecatedElem->GetText();
     std::vector<std::string> valueSplit = split(value, "/");
 
     bool found = false;
@@ -61,78 +61,97 @@ namespace sdf
                                 const ParserConfig &_config);
     /// \endcond
 
+    /// \brief Operation of a compiled conversion recipe, such as <rename>.
+    private: struct Operation;
+
+    /// \brief Conversion recipe compiled from a <convert> element, so that
+    /// it can be applied to many documents without reading its XML again.
+    private: struct Program;
+
+    /// \brief Conversion from one version of SDF to the next, compiled from
+    /// an embedded recipe when it is first used.
+    private: struct Step;
+
+    /// \brief Compile a <convert> element.
+    /// \param[in] _convert Convert xml element tree.
+    /// \param[out] _program The compiled recipe.
+    private: static void Compile(const tinyxml2::XMLElement *_convert,
+                                 Program &_program);
+
+    /// \brief Get the compiled recipe that converts from a version to the
+    /// next one.
+    /// \param[in] _fromVersion Version to convert from.
+    /// \return The recipe, or nullptr if there is none.
+    private: static const Step *EmbeddedStep(const std::string &_fromVersion);
+
     /// \brief Implementation of Convert functionality.
     /// \param[in] _elem SDF xml element tree to convert.
-    /// \param[in] _convert Convert xml element tree.
+    /// \param[in] _convert Compiled convert element tree.
     /// \param[in] _config Parser configuration.
     /// \param[out] _errors Vector of errors.
     private: static void ConvertImpl(tinyxml2::XMLElement *_elem,
-                                     tinyxml2::XMLElement *_convert,
+                                     const Program &_convert,
                                      const ParserConfig &_config,
                                      sdf::Errors &_errors);
 
     /// \brief Recursive helper function for ConvertImpl that converts
     /// elements named by the descendant_name attribute.
     /// \param[in] _e SDF xml element tree to convert.
-    /// \param[in] _c Convert xml element tree.
+    /// \param[in] _c Compiled convert element tree.
     /// \param[in] _config Parser configuration.
     /// \param[out] _errors Vector of errors.
     private: static void ConvertDescendantsImpl(tinyxml2::XMLElement *_e,
-                                                tinyxml2::XMLElement *_c,
+                                                const Program &_c,
                                                 const ParserConfig &_config,
                                                 sdf::Errors &_errors);
 
     /// \brief Rename an element or attribute.
     /// \param[in] _elem The element to be renamed, or the element which
     /// has the attribute to be renamed.
-    /// \param[in] _renameElem A 'convert' element that describes the rename.
+    /// \param[in] _rename Compiled 'rename' operation.
     /// \param[out] _errors Vector of errors.
-    /// operation.
     private: static void Rename(tinyxml2::XMLElement *_elem,
-                                tinyxml2::XMLElement *_renameElem,
+                                const Operation &_rename,
                                 sdf::Errors &_errors);
 
     /// \brief Map values from one element or attribute to another.
     /// \param[in] _elem Ancestor element of the element or attribute to
     /// be mapped.
-    /// \param[in] _mapElem A 'convert' element that describes the map
+    /// \param[in] _map Compiled 'map' operation.
     /// \param[out] _errors Vector of errors.
-    /// operation.
     private: static void Map(tinyxml2::XMLElement *_elem,
-                             tinyxml2::XMLElement *_mapElem,
+                             const Operation &_map,
                              sdf::Errors &_errors);
 
     /// \brief Move an element or attribute within a common ancestor element.
     /// \param[in] _elem Ancestor element of the element or attribute to
     /// be moved.
-    /// \param[in] _moveElem A 'convert' element that describes the move
-    /// operation.
+    /// \param[in] _move Compiled 'move' or 'copy' operation.
     /// \param[in] _copy True to copy the element
     /// \param[out] _errors Vector of errors.
     private: static void Move(tinyxml2::XMLElement *_elem,
-                              tinyxml2::XMLElement *_moveElem,
+                              const Operation &_move,
                               const bool _copy,
                               sdf::Errors &_errors);
 
     /// \brief Add an element or attribute to an element.
     /// \param[in] _elem The element to receive the value.
-    /// \param[in] _addElem A 'convert' element that describes the add
+    /// \param[in] _add Compiled 'add' operation.
     /// \param[out] _errors Vector of Errors.
-    /// operation.
     private: static void Add(tinyxml2::XMLElement *_elem,
-                             tinyxml2::XMLElement *_addElem,
+                             const Operation &_add,
                              sdf::Errors &_errors);
 
     /// \brief Remove an attribute or elements.
     /// \param[out] _errors Vector of Errors.
     /// \param[in] _elem The element from which data may be removed.
-    /// \param[in] _removeElem The metadata about what to remove.
+    /// \param[in] _remove Compiled 'remove' or 'remove_empty' operation.
     /// \param[in] _removeOnlyEmpty If true, only remove an attribute
     /// containing an empty string or elements that contain neither value nor
     /// child elements nor attributes.
     private: static void Remove(sdf::Errors &_errors,
                                 tinyxml2::XMLElement *_elem,
-                                tinyxml2::XMLElement *_removeElem,
+                                const Operation &_remove,
                                 bool _removeOnlyEmpty = false);
 
     /// \brief Unflatten an element (conversion from SDFormat <= 1.7 to 1.8)
@@ -158,7 +177,7 @@ namespace sdf
                                          tinyxml2::XMLElement *_elem);
 
     private: static void CheckDeprecation(tinyxml2::XMLElement *_elem,
-                                          tinyxml2::XMLElement *_convert,
+                                          const Program &_convert,
                                           const ParserConfig &_config,
                                           sdf::Errors &_errors);
   };
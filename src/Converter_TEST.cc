@@ -16,8 +16,12 @@
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <array>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 #include "sdf/Exception.hh"
 #include "sdf/Filesystem.hh"
 #include "sdf/ParserConfig.hh"
@@ -3734,3 +3738,89 @@ TEST(Converter, World_17_to_18)
   EXPECT_STREQ(convertedElem->Attribute("relative_to"), "__model__");
   EXPECT_STREQ(convertedElem->NextSiblingElement()->Name(), "geometry");
 }
+
+/////////////////////////////////////////////////
+/// Test that converting with the embedded recipes, which are compiled once
+/// and shared by threads, gives the same result as applying each recipe file
+TEST(Converter, EmbeddedRecipesConcurrent)
+{
+  const std::string xmlString = R"(
+<?xml version="1.0" ?>
+<sdf version="1.6">
+  <world name="default">
+    <gravity>0 0 -9.8</gravity>
+    <model name="model">
+      <pose frame="world">1 0 0 0 0 0</pose>
+      <link name="parent"/>
+      <link name="child">
+        <pose frame="joint">0 0 1 0 0 0</pose>
+        <sensor name="imu" type="imu">
+          <imu>
+            <angular_velocity>
+              <x><noise type="gaussian"><mean>0</mean></noise></x>
+            </angular_velocity>
+          </imu>
+        </sensor>
+      </link>
+      <joint name="joint" type="revolute">
+        <parent>parent</parent>
+        <child>child</child>
+        <axis>
+          <xyz>0 0 1</xyz>
+          <use_parent_model_frame>1</use_parent_model_frame>
+        </axis>
+      </joint>
+    </model>
+  </world>
+</sdf>)";
+
+  // Apply the recipe files one at a time
+  tinyxml2::XMLDocument expectedDoc;
+  expectedDoc.Parse(xmlString.c_str());
+  sdf::ParserConfig parserConfig;
+  sdf::Errors errors;
+  for (const std::string &version : {"1.7", "1.8", "1.9", "1.10", "1.11",
+                                     "1.12"})
+  {
+    std::string fromVersion = expectedDoc.FirstChildElement("sdf")
+        ->Attribute("version");
+    std::replace(fromVersion.begin(), fromVersion.end(), '.', '_');
+    tinyxml2::XMLDocument convertXmlDoc;
+    convertXmlDoc.LoadFile(sdf::testing::SourceFile(
+        "sdf", version, fromVersion + ".convert").c_str());
+    sdf::Converter::Convert(errors, &expectedDoc, &convertXmlDoc,
+                            parserConfig);
+    expectedDoc.FirstChildElement("sdf")->SetAttribute("version",
+                                                       version.c_str());
+  }
+  EXPECT_TRUE(errors.empty()) << errors;
+  tinyxml2::XMLPrinter expected;
+  expectedDoc.Print(&expected);
+
+  // Convert on several threads at once
+  const std::size_t threadCount = 4;
+  std::vector<std::string> results(threadCount);
+  std::vector<sdf::Errors> threadErrors(threadCount);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < threadCount; ++i)
+  {
+    threads.emplace_back([&, i]()
+        {
+          tinyxml2::XMLDocument xmlDoc;
+          xmlDoc.Parse(xmlString.c_str());
+          sdf::Converter::Convert(threadErrors[i], &xmlDoc, "1.12",
+                                  parserConfig, true);
+          tinyxml2::XMLPrinter printer;
+          xmlDoc.Print(&printer);
+          results[i] = printer.CStr();
+        });
+  }
+  for (std::thread &thread : threads)
+    thread.join();
+
+  for (std::size_t i = 0; i < threadCount; ++i)
+  {
+    EXPECT_TRUE(threadErrors[i].empty()) << threadErrors[i];
+    EXPECT_EQ(expected.CStr(), results[i]);
+  }
+}
@@ -0,0 +1,245 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <new>
+#include <shared_mutex>
+#include <utility>
+
+#include "DocumentArena.hh"
+
+namespace sdf
+{
+// Inline bracket to help doxygen filtering.
+inline namespace SDF_VERSION_NAMESPACE {
+
+namespace
+{
+/// \brief Size of the first block allocated by an arena.
+constexpr std::size_t kInitialBlockSize = 64 * 1024;
+
+/// \brief Largest block size; arenas grow geometrically up to this size.
+constexpr std::size_t kMaxBlockSize = 4 * 1024 * 1024;
+
+/// \brief Header placed in front of every allocation made by
+/// documentArenaNew from an arena, keeping the arena alive. Allocations
+/// from the heap have no header.
+struct AllocationHeader
+{
+  /// \brief Arena of the allocation.
+  std::shared_ptr<DocumentArena> arena;
+};
+
+/// \brief Size of the allocation header, rounded up so that the memory that
+/// follows it is suitably aligned for any type.
+constexpr std::size_t kHeaderSize =
+    (sizeof(AllocationHeader) + alignof(std::max_align_t) - 1) /
+    alignof(std::max_align_t) * alignof(std::max_align_t);
+
+/// \brief Address ranges of the blocks of every arena, which tell the
+/// memory of an arena apart from the heap.
+struct BlockRegistry
+{
+  /// \brief Protects the blocks.
+  std::shared_mutex mutex;
+
+  /// \brief Arena and end address of each block, by start address.
+  std::map<std::uintptr_t, std::pair<std::uintptr_t, DocumentArena *>> blocks;
+
+  /// \brief Number of blocks, read without the lock so that the heap path
+  /// costs nothing while no arena exists.
+  std::atomic<std::size_t> count{0};
+};
+
+/////////////////////////////////////////////////
+/// \brief Get the registry of arena blocks.
+BlockRegistry &blockRegistry()
+{
+  // Never destroyed, since nodes may be released during static destruction.
+  static BlockRegistry *registry = new BlockRegistry;
+  return *registry;
+}
+
+/////////////////////////////////////////////////
+/// \brief Find the arena that owns an address.
+/// \param[in] _ptr The address.
+/// \return The arena, or nullptr if the address is not in an arena.
+DocumentArena *findArena(const void *_ptr)
+{
+  BlockRegistry &registry = blockRegistry();
+  if (_ptr == nullptr || registry.count.load(std::memory_order_acquire) == 0)
+    return nullptr;
+
+  const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(_ptr);
+  std::shared_lock<std::shared_mutex> lock(registry.mutex);
+  auto it = registry.blocks.upper_bound(address);
+  if (it == registry.blocks.begin())
+    return nullptr;
+  --it;
+  return address < it->second.first ? it->second.second : nullptr;
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the arena that is current on this thread.
+std::shared_ptr<DocumentArena> &currentArena()
+{
+  static thread_local std::shared_ptr<DocumentArena> arena;
+  return arena;
+}
+}
+
+/////////////////////////////////////////////////
+DocumentArena::~DocumentArena()
+{
+  BlockRegistry &registry = blockRegistry();
+  std::unique_lock<std::shared_mutex> lock(registry.mutex);
+  for (const std::unique_ptr<unsigned char[]> &block : this->blocks)
+    registry.blocks.erase(reinterpret_cast<std::uintptr_t>(block.get()));
+  registry.count -= this->blocks.size();
+}
+
+/////////////////////////////////////////////////
+void *DocumentArena::Allocate(std::size_t _bytes, std::size_t _alignment)
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+
+  const std::size_t padding =
+      (_alignment - reinterpret_cast<std::uintptr_t>(this->cursor) %
+       _alignment) % _alignment;
+  if (this->cursor == nullptr || padding + _bytes > this->remaining)
+  {
+    this->blockSize = this->blockSize == 0 ? kInitialBlockSize :
+        std::min(this->blockSize * 2, kMaxBlockSize);
+    const std::size_t size = std::max(this->blockSize, _bytes);
+    this->blocks.emplace_back(new unsigned char[size]);
+    this->cursor = this->blocks.back().get();
+    {
+      BlockRegistry &registry = blockRegistry();
+      const std::uintptr_t start =
+          reinterpret_cast<std::uintptr_t>(this->cursor);
+      std::unique_lock<std::shared_mutex> registryLock(registry.mutex);
+      registry.blocks[start] = {start + size, this};
+      ++registry.count;
+    }
+    this->remaining = size;
+    this->bytesAllocated += _bytes;
+
+    // New blocks are aligned for any fundamental type.
+    void *result = this->cursor;
+    this->cursor += _bytes;
+    this->remaining -= _bytes;
+    return result;
+  }
+
+  void *result = this->cursor + padding;
+  this->cursor += padding + _bytes;
+  this->remaining -= padding + _bytes;
+  this->bytesAllocated += padding + _bytes;
+  return result;
+}
+
+/////////////////////////////////////////////////
+std::size_t DocumentArena::BytesAllocated() const
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->bytesAllocated;
+}
+
+/////////////////////////////////////////////////
+const std::shared_ptr<DocumentArena> &DocumentArena::Current()
+{
+  return currentArena();
+}
+
+/////////////////////////////////////////////////
+std::shared_ptr<DocumentArena> DocumentArena::ForDocument(bool _useArena,
+    const void *_node)
+{
+  if (currentArena())
+  {
+    return currentArena();
+  }
+
+  // Keep the document in the arena its root was created in, for example by
+  // sdf::init.
+  if (DocumentArena *arena = findArena(_node))
+  {
+    return arena->shared_from_this();
+  }
+
+  if (!_useArena)
+  {
+    return nullptr;
+  }
+  return std::make_shared<DocumentArena>();
+}
+
+/////////////////////////////////////////////////
+DocumentArenaScope::DocumentArenaScope(std::shared_ptr<DocumentArena> _arena)
+  : previous(std::move(currentArena()))
+{
+  currentArena() = std::move(_arena);
+}
+
+/////////////////////////////////////////////////
+DocumentArenaScope::~DocumentArenaScope()
+{
+  currentArena() = std::move(this->previous);
+}
+
+/////////////////////////////////////////////////
+void *documentArenaNew(std::size_t _size)
+{
+  const std::shared_ptr<DocumentArena> &arena = currentArena();
+  if (!arena)
+  {
+    return ::operator new(_size);
+  }
+
+  void *block =
+      arena->Allocate(kHeaderSize + _size, alignof(std::max_align_t));
+  new (block) AllocationHeader{arena};
+  return static_cast<unsigned char *>(block) + kHeaderSize;
+}
+
+/////////////////////////////////////////////////
+void documentArenaDelete(void *_ptr) noexcept
+{
+  if (_ptr == nullptr)
+  {
+    return;
+  }
+
+  if (!findArena(_ptr))
+  {
+    ::operator delete(_ptr);
+    return;
+  }
+
+  void *block = static_cast<unsigned char *>(_ptr) - kHeaderSize;
+  auto *header = static_cast<AllocationHeader *>(block);
+
+  // Keep the arena alive until the header is gone, since the header itself
+  // lives in the arena.
+  std::shared_ptr<DocumentArena> arena = std::move(header->arena);
+  header->~AllocationHeader();
+}
+}
+}
@@ -0,0 +1,216 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDFORMAT_DOCUMENTARENA_HH
+#define SDFORMAT_DOCUMENTARENA_HH
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "sdf/sdf_config.h"
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  /// \internal
+  /// \brief Monotonic arena holding the Elements and Params of one parsed
+  /// document. Memory handed out by the arena is never reused; it is all
+  /// released at once when the arena is destroyed.
+  ///
+  /// Every node placed in the arena holds a reference to it, so the arena
+  /// lives exactly as long as the last node of its document. The address
+  /// ranges of the blocks of every arena are registered, so that memory of
+  /// an arena can be told apart from the heap without a header.
+  /// Allocation is thread-safe.
+  class DocumentArena : public std::enable_shared_from_this<DocumentArena>
+  {
+    /// \brief Constructor.
+    public: DocumentArena() = default;
+
+    /// \brief Destructor. Releases all memory handed out by the arena.
+    public: ~DocumentArena();
+
+    DocumentArena(const DocumentArena &) = delete;
+    DocumentArena &operator=(const DocumentArena &) = delete;
+
+    /// \brief Allocate memory from the arena.
+    /// \param[in] _bytes Number of bytes to allocate.
+    /// \param[in] _alignment Alignment of the allocation. Must be a power of
+    /// two no larger than alignof(std::max_align_t).
+    /// \return Pointer to the allocated memory.
+    public: void *Allocate(std::size_t _bytes, std::size_t _alignment);
+
+    /// \brief Get the number of bytes handed out by the arena.
+    /// \return Number of bytes allocated, including alignment padding.
+    public: std::size_t BytesAllocated() const;
+
+    /// \brief Get the arena of the document currently being parsed on this
+    /// thread.
+    /// \return The current arena, or nullptr if nodes should be allocated on
+    /// the heap.
+    public: static const std::shared_ptr<DocumentArena> &Current();
+
+    /// \brief Get the arena to use for a document that is about to be
+    /// parsed. Documents read while another document is being parsed on the
+    /// same thread, such as included files, share the enclosing arena, and
+    /// a document whose root element is already in an arena, such as one
+    /// created by sdf::init, stays in that arena.
+    /// \param[in] _useArena True if the document should use an arena.
+    /// \param[in] _root Root element of the document, or nullptr.
+    /// \return The current arena if there is one, otherwise the arena of
+    /// _root if it is in one, otherwise a new arena if _useArena is true,
+    /// otherwise nullptr.
+    /// \sa ParserConfig::UseDocumentArena
+    public: static std::shared_ptr<DocumentArena> ForDocument(bool _useArena,
+                const void *_root = nullptr);
+
+    /// \brief Protects the members below.
+    private: mutable std::mutex mutex;
+
+    /// \brief Memory blocks owned by the arena.
+    private: std::vector<std::unique_ptr<unsigned char[]>> blocks;
+
+    /// \brief Next free byte in the last block.
+    private: unsigned char *cursor = nullptr;
+
+    /// \brief Number of free bytes left in the last block.
+    private: std::size_t remaining = 0;
+
+    /// \brief Size of the last block.
+    private: std::size_t blockSize = 0;
+
+    /// \brief Number of bytes handed out so far.
+    private: std::size_t bytesAllocated = 0;
+  };
+
+  /// \internal
+  /// \brief Makes an arena current on this thread for the lifetime of the
+  /// scope, restoring the previously current arena on destruction.
+  class DocumentArenaScope
+  {
+    /// \brief Constructor.
+    /// \param[in] _arena Arena to make current, or nullptr to allocate on
+    /// the heap within this scope. Process-wide caches use the latter, since
+    /// anything they keep would otherwise pin the arena of whichever
+    /// document happened to fill them.
+    public: explicit DocumentArenaScope(std::shared_ptr<DocumentArena> _arena);
+
+    /// \brief Destructor. Restores the previously current arena.
+    public: ~DocumentArenaScope();
+
+    DocumentArenaScope(const DocumentArenaScope &) = delete;
+    DocumentArenaScope &operator=(const DocumentArenaScope &) = delete;
+
+    /// \brief Arena that was current before this scope.
+    private: std::shared_ptr<DocumentArena> previous;
+  };
+
+  /// \internal
+  /// \brief Standard allocator that allocates from a document arena. Used
+  /// with std::allocate_shared so that a node and its control block are
+  /// placed in the arena and keep it alive.
+  template <typename T>
+  class ArenaAllocator
+  {
+    public: using value_type = T;
+
+    /// \brief Constructor.
+    /// \param[in] _arena Arena to allocate from.
+    public: explicit ArenaAllocator(std::shared_ptr<DocumentArena> _arena)
+      : arena(std::move(_arena))
+    {
+    }
+
+    /// \brief Rebinding constructor.
+    /// \param[in] _other Allocator to copy the arena from.
+    public: template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &_other)  // NOLINT
+      : arena(_other.arena)
+    {
+    }
+
+    /// \brief Allocate memory for _n objects.
+    /// \param[in] _n Number of objects.
+    /// \return Pointer to the allocated memory.
+    public: T *allocate(std::size_t _n)
+    {
+      return static_cast<T *>(
+          this->arena->Allocate(_n * sizeof(T), alignof(T)));
+    }
+
+    /// \brief Memory is released in bulk with the arena, so this does
+    /// nothing.
+    public: void deallocate(T *, std::size_t)
+    {
+    }
+
+    /// \brief Equality operator.
+    public: template <typename U>
+    bool operator==(const ArenaAllocator<U> &_other) const
+    {
+      return this->arena == _other.arena;
+    }
+
+    /// \brief Inequality operator.
+    public: template <typename U>
+    bool operator!=(const ArenaAllocator<U> &_other) const
+    {
+      return this->arena != _other.arena;
+    }
+
+    /// \brief Arena to allocate from.
+    public: std::shared_ptr<DocumentArena> arena;
+  };
+
+  /// \internal
+  /// \brief Create a shared object in the current document arena, or on the
+  /// heap if there is no current arena.
+  /// \param[in] _args Constructor arguments.
+  /// \return Shared pointer to the new object.
+  template <typename T, typename... Args>
+  std::shared_ptr<T> makeDocumentShared(Args &&... _args)
+  {
+    const std::shared_ptr<DocumentArena> &arena = DocumentArena::Current();
+    if (arena)
+    {
+      return std::allocate_shared<T>(
+          ArenaAllocator<T>(arena), std::forward<Args>(_args)...);
+    }
+    return std::make_shared<T>(std::forward<Args>(_args)...);
+  }
+
+  /// \internal
+  /// \brief Allocate memory for a private data object from the current
+  /// document arena, or from the heap if there is no current arena. It must
+  /// be released with documentArenaDelete, regardless of which arena is
+  /// current then. Allocations from an arena keep it alive with a header;
+  /// allocations from the heap have no overhead.
+  /// \param[in] _size Number of bytes to allocate.
+  /// \return Pointer to the allocated memory.
+  void *documentArenaNew(std::size_t _size);
+
+  /// \internal
+  /// \brief Release memory allocated by documentArenaNew.
+  /// \param[in] _ptr Pointer returned by documentArenaNew, or nullptr.
+  void documentArenaDelete(void *_ptr) noexcept;
+  }
+}
+#endif
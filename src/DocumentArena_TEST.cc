@@ -0,0 +1,148 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "DocumentArena.hh"
+
+/////////////////////////////////////////////////
+TEST(DocumentArena, Allocate)
+{
+  sdf::DocumentArena arena;
+  EXPECT_EQ(0u, arena.BytesAllocated());
+
+  void *first = arena.Allocate(1, 1);
+  ASSERT_NE(nullptr, first);
+  void *aligned = arena.Allocate(sizeof(double), alignof(double));
+  EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(aligned) % alignof(double));
+  EXPECT_NE(first, aligned);
+  EXPECT_GE(arena.BytesAllocated(), 1u + sizeof(double));
+
+  // Allocations larger than a block get a block of their own
+  const std::size_t large = 16 * 1024 * 1024;
+  void *big = arena.Allocate(large, alignof(std::max_align_t));
+  ASSERT_NE(nullptr, big);
+  EXPECT_GE(arena.BytesAllocated(), large);
+}
+
+/////////////////////////////////////////////////
+TEST(DocumentArena, Scope)
+{
+  EXPECT_EQ(nullptr, sdf::DocumentArena::Current());
+  EXPECT_EQ(nullptr, sdf::DocumentArena::ForDocument(false));
+
+  {
+    sdf::DocumentArenaScope scope(sdf::DocumentArena::ForDocument(true));
+    std::shared_ptr<sdf::DocumentArena> arena = sdf::DocumentArena::Current();
+    ASSERT_NE(nullptr, arena);
+
+    // Nested documents share the enclosing arena
+    EXPECT_EQ(arena, sdf::DocumentArena::ForDocument(true));
+    EXPECT_EQ(arena, sdf::DocumentArena::ForDocument(false));
+
+    {
+      sdf::DocumentArenaScope heapScope(nullptr);
+      EXPECT_EQ(nullptr, sdf::DocumentArena::Current());
+    }
+    EXPECT_EQ(arena, sdf::DocumentArena::Current());
+  }
+
+  EXPECT_EQ(nullptr, sdf::DocumentArena::Current());
+}
+
+/////////////////////////////////////////////////
+TEST(DocumentArena, SharedObjectsKeepArenaAlive)
+{
+  std::weak_ptr<sdf::DocumentArena> weakArena;
+  std::shared_ptr<std::string> str;
+  {
+    sdf::DocumentArenaScope scope(sdf::DocumentArena::ForDocument(true));
+    weakArena = sdf::DocumentArena::Current();
+    str = sdf::makeDocumentShared<std::string>("placed in the arena");
+    EXPECT_GT(weakArena.lock()->BytesAllocated(), 0u);
+  }
+
+  // The scope is gone, but the string still references the arena
+  ASSERT_FALSE(weakArena.expired());
+  EXPECT_EQ("placed in the arena", *str);
+
+  str.reset();
+  EXPECT_TRUE(weakArena.expired());
+
+  // Without an arena objects are allocated on the heap
+  str = sdf::makeDocumentShared<std::string>("on the heap");
+  EXPECT_EQ("on the heap", *str);
+}
+
+/////////////////////////////////////////////////
+TEST(DocumentArena, NewDelete)
+{
+  void *heap = sdf::documentArenaNew(32);
+  ASSERT_NE(nullptr, heap);
+  sdf::documentArenaDelete(heap);
+  sdf::documentArenaDelete(nullptr);
+
+  std::weak_ptr<sdf::DocumentArena> weakArena;
+  void *inArena = nullptr;
+  {
+    sdf::DocumentArenaScope scope(sdf::DocumentArena::ForDocument(true));
+    weakArena = sdf::DocumentArena::Current();
+    inArena = sdf::documentArenaNew(32);
+    ASSERT_NE(nullptr, inArena);
+  }
+  EXPECT_FALSE(weakArena.expired());
+
+  // Releasing the last allocation releases the arena, even though a
+  // different arena, or none, is current.
+  sdf::documentArenaDelete(inArena);
+  EXPECT_TRUE(weakArena.expired());
+}
+
+/////////////////////////////////////////////////
+TEST(DocumentArena, ForDocumentOfRoot)
+{
+  std::shared_ptr<std::string> root;
+  std::shared_ptr<sdf::DocumentArena> arena;
+  {
+    sdf::DocumentArenaScope scope(sdf::DocumentArena::ForDocument(true));
+    arena = sdf::DocumentArena::Current();
+    root = sdf::makeDocumentShared<std::string>("root");
+  }
+
+  // A document whose root is in an arena stays in it, whether or not the
+  // configuration asks for an arena
+  EXPECT_EQ(arena, sdf::DocumentArena::ForDocument(false, root.get()));
+  EXPECT_EQ(arena, sdf::DocumentArena::ForDocument(true, root.get()));
+
+  // Roots on the heap give no arena, or a new one
+  auto heapRoot = std::make_shared<std::string>("heap");
+  EXPECT_EQ(nullptr, sdf::DocumentArena::ForDocument(false, heapRoot.get()));
+  std::shared_ptr<sdf::DocumentArena> other =
+      sdf::DocumentArena::ForDocument(true, heapRoot.get());
+  ASSERT_NE(nullptr, other);
+  EXPECT_NE(arena, other);
+
+  // The current arena comes first
+  {
+    sdf::DocumentArenaScope scope(other);
+    EXPECT_EQ(other, sdf::DocumentArena::ForDocument(true, root.get()));
+  }
+}
@@ -22,16 +22,35 @@
 #include "sdf/Assert.hh"
 #include "sdf/Element.hh"
 #include "sdf/Filesystem.hh"
+#include "DocumentArena.hh"
+#include "StringPool.hh"
 #include "Utils.hh"
 
 using namespace sdf;
 
+/////////////////////////////////////////////////
+/// \brief Get the empty string shared by elements without a file path or
+/// description.
+/// \return The empty string.
+static const std::shared_ptr<const std::string> &emptySharedString()
+{
+  static const std::shared_ptr<const std::string> empty =
+      std::make_shared<const std::string>();
+  return empty;
+}
+
 /////////////////////////////////////////////////
 Element::Element()
   : dataPtr(new ElementPrivate)
 {
+  const std::string *empty = InternString("");
+  this->dataPtr->name = empty;
+  this->dataPtr->required = empty;
+  this->dataPtr->description = emptySharedString();
   this->dataPtr->copyChildren = false;
-  this->dataPtr->referenceSDF = "";
+  this->dataPtr->referenceSDF = empty;
+  this->dataPtr->path = emptySharedString();
+  this->dataPtr->originalVersion = empty;
   this->dataPtr->explicitlySetInFile = true;
 }
 
@@ -55,38 +74,45 @@ void Element::SetParent(const ElementPtr _parent)
   if (nullptr != _parent && (this->FilePath().empty() ||
       this->FilePath() == std::string(kSdfStringSource)))
   {
-    this->SetFilePath(_parent->FilePath());
+    this->dataPtr->path = _parent->dataPtr->path;
   }
 
   // If this element doesn't have an original version, get it from the parent
   if (nullptr != _parent && this->OriginalVersion().empty())
   {
-    this->SetOriginalVersion(_parent->OriginalVersion());
+    this->dataPtr->originalVersion = _parent->dataPtr->originalVersion;
   }
 }
 
 /////////////////////////////////////////////////
 void Element::SetName(const std::string &_name)
 {
-  this->dataPtr->name = _name;
+  this->dataPtr->name = InternString(_name);
+
+  // Keep the parent's child element index consistent with the new name
+  auto parent = this->dataPtr->parent.lock();
+  if (parent && !parent->dataPtr->elementIndex.empty())
+  {
+    parent->dataPtr->RebuildElementIndex();
+  }
 }
 
 /////////////////////////////////////////////////
 const std::string &Element::GetName() const
 {
-  return this->dataPtr->name;
+  return *this->dataPtr->name;
 }
 
 /////////////////////////////////////////////////
 void Element::SetRequired(const std::string &_req)
 {
-  this->dataPtr->required = _req;
+  this->dataPtr->required = InternString(_req);
 }
 
 /////////////////////////////////////////////////
 const std::string &Element::GetRequired() const
 {
-  return this->dataPtr->required;
+  return *this->dataPtr->required;
 }
 
 /////////////////////////////////////////////////
@@ -123,13 +149,13 @@ bool Element::GetCopyChildren() const
 /////////////////////////////////////////////////
 void Element::SetReferenceSDF(const std::string &_value)
 {
-  this->dataPtr->referenceSDF = _value;
+  this->dataPtr->referenceSDF = InternString(_value);
 }
 
 /////////////////////////////////////////////////
 std::string Element::ReferenceSDF() const
 {
-  return this->dataPtr->referenceSDF;
+  return *this->dataPtr->referenceSDF;
 }
 
 /////////////////////////////////////////////////
@@ -139,7 +165,7 @@ void Element::AddValue(const std::string &_type,
                        const std::string &_description)
 {
   sdf::Errors errors;
-  this->dataPtr->value = this->CreateParam(this->dataPtr->name,
+  this->dataPtr->value = this->CreateParam(*this->dataPtr->name,
       _type, _defaultValue, _required, errors, _description);
   sdf::throwOrPrintErrors(errors);
 }
@@ -151,7 +177,7 @@ void Element::AddValue(const std::string &_type,
                        sdf::Errors &_errors,
                        const std::string &_description)
 {
-  this->dataPtr->value = this->CreateParam(this->dataPtr->name,
+  this->dataPtr->value = this->CreateParam(*this->dataPtr->name,
       _type, _defaultValue, _required, _errors, _description);
 }
 
@@ -179,7 +205,7 @@ void Element::AddValue(const std::string &_type,
                        const std::string &_description)
 {
   this->dataPtr->value =
-      std::make_shared<Param>(this->dataPtr->name, _type, _defaultValue,
+      makeDocumentShared<Param>(*this->dataPtr->name, _type, _defaultValue,
                               _required, _minValue, _maxValue, _errors,
                               _description);
   SDF_ASSERT(this->dataPtr->value->SetParentElement(shared_from_this()),
@@ -194,7 +220,7 @@ ParamPtr Element::CreateParam(const std::string &_key,
                               sdf::Errors &_errors,
                               const std::string &_description)
 {
-  ParamPtr param = std::make_shared<Param>(
+  ParamPtr param = makeDocumentShared<Param>(
       _key, _type, _defaultValue, _required, _errors, _description);
   SDF_ASSERT(param->SetParentElement(shared_from_this()),
       "Cannot set parent Element of created Param to itself.");
@@ -239,7 +265,7 @@ ElementPtr Element::Clone() const
 /////////////////////////////////////////////////
 ElementPtr Element::Clone(sdf::Errors &_errors) const
 {
-  ElementPtr clone(new Element);
+  ElementPtr clone = makeDocumentShared<Element>();
   clone->dataPtr->description = this->dataPtr->description;
   clone->dataPtr->name = this->dataPtr->name;
   clone->dataPtr->required = this->dataPtr->required;
@@ -262,18 +288,19 @@ ElementPtr Element::Clone(sdf::Errors &_errors) const
     clone->dataPtr->attributes.push_back(clonedAttribute);
   }
 
-  ElementPtr_V::const_iterator eiter;
-  for (eiter = this->dataPtr->elementDescriptions.begin();
-      eiter != this->dataPtr->elementDescriptions.end(); ++eiter)
-  {
-    clone->dataPtr->elementDescriptions.push_back((*eiter)->Clone(_errors));
-  }
+  // Element descriptions are immutable schema nodes, so they are shared
+  // with the clone rather than copied.
+  clone->dataPtr->elementDescriptions = this->dataPtr->elementDescriptions;
+  clone->dataPtr->elementDescriptionIndex =
+      this->dataPtr->elementDescriptionIndex;
 
+  ElementPtr_V::const_iterator eiter;
   for (eiter = this->dataPtr->elements.begin();
        eiter != this->dataPtr->elements.end(); ++eiter)
   {
-    clone->dataPtr->elements.push_back((*eiter)->Clone(_errors));
-    clone->dataPtr->elements.back()->SetParent(clone);
+    ElementPtr elem = (*eiter)->Clone(_errors);
+    elem->SetParent(clone);
+    clone->dataPtr->PushElement(elem);
   }
 
   if (this->dataPtr->value)
@@ -304,13 +331,13 @@ void Element::Copy(const ElementPtr _elem)
 void Element::Copy(const ElementPtr _elem, sdf::Errors &_errors)
 {
 
-  this->dataPtr->name = _elem->GetName();
-  this->dataPtr->description = _elem->GetDescription();
-  this->dataPtr->required = _elem->GetRequired();
+  this->dataPtr->name = _elem->dataPtr->name;
+  this->dataPtr->description = _elem->dataPtr->description;
+  this->dataPtr->required = _elem->dataPtr->required;
   this->dataPtr->copyChildren = _elem->GetCopyChildren();
-  this->dataPtr->referenceSDF = _elem->ReferenceSDF();
-  this->dataPtr->originalVersion = _elem->OriginalVersion();
-  this->dataPtr->path = _elem->FilePath();
+  this->dataPtr->referenceSDF = _elem->dataPtr->referenceSDF;
+  this->dataPtr->originalVersion = _elem->dataPtr->originalVersion;
+  this->dataPtr->path = _elem->dataPtr->path;
   this->dataPtr->lineNumber = _elem->LineNumber();
   this->dataPtr->xmlPath = _elem->XmlPath();
   this->dataPtr->explicitlySetInFile = _elem->GetExplicitlySetInFile();
@@ -342,15 +369,12 @@ void Element::Copy(const ElementPtr _elem, sdf::Errors &_errors)
         "Cannot set parent Element of copied value Param to itself.");
   }
 
-  this->dataPtr->elementDescriptions.clear();
-  for (ElementPtr_V::const_iterator iter =
-       _elem->dataPtr->elementDescriptions.begin();
-       iter != _elem->dataPtr->elementDescriptions.end(); ++iter)
-  {
-    this->dataPtr->elementDescriptions.push_back((*iter)->Clone(_errors));
-  }
+  this->dataPtr->elementDescriptions = _elem->dataPtr->elementDescriptions;
+  this->dataPtr->elementDescriptionIndex =
+      _elem->dataPtr->elementDescriptionIndex;
 
   this->dataPtr->elements.clear();
+  this->dataPtr->elementIndex.clear();
   for (ElementPtr_V::iterator iter = _elem->dataPtr->elements.begin();
        iter != _elem->dataPtr->elements.end(); ++iter)
   {
@@ -358,7 +382,7 @@ void Element::Copy(const ElementPtr _elem, sdf::Errors &_errors)
     elem = (*iter)->Clone(_errors);
     elem->Copy(*iter, _errors);
     elem->SetParent(shared_from_this());
-    this->dataPtr->elements.push_back(elem);
+    this->dataPtr->PushElement(elem);
   }
 
   if (_elem->dataPtr->includeElement)
@@ -388,8 +412,8 @@ void Element::PrintDescription(const std::string &_prefix) const
 void Element::PrintDescription(sdf::Errors &_errors,
                                const std::string &_prefix) const
 {
-  std::cout << _prefix << "<element name ='" << this->dataPtr->name
-            << "' required ='" << this->dataPtr->required << "'";
+  std::cout << _prefix << "<element name ='" << *this->dataPtr->name
+            << "' required ='" << *this->dataPtr->required << "'";
 
   if (this->dataPtr->value)
   {
@@ -414,7 +438,7 @@ void Element::PrintDescription(sdf::Errors &_errors,
   std::cout << ">\n";
 
   std::cout << _prefix << "  <description><![CDATA["
-            << this->dataPtr->description
+            << *this->dataPtr->description
             << "]]></description>\n";
 
   Param_V::iterator aiter;
@@ -470,17 +494,17 @@ void Element::PrintDocRightPane(std::string &_html, int _spacing,
     (*eiter)->PrintDocRightPane(childHTML, _spacing + 4, _index);
   }
 
-  stream << "<a name=\"" << this->dataPtr->name << start
-         << "\">&lt" << this->dataPtr->name << "&gt</a>";
+  stream << "<a name=\"" << *this->dataPtr->name << start
+         << "\">&lt" << *this->dataPtr->name << "&gt</a>";
 
   stream << "<div style='padding-left:" << _spacing << "px;'>\n";
 
   stream << "<div style='background-color: #ffffff'>\n";
 
   stream << "<font style='font-weight:bold'>Description: </font>";
-  if (!this->dataPtr->description.empty())
+  if (!this->dataPtr->description->empty())
   {
-    stream << this->dataPtr->description << "<br>\n";
+    stream << *this->dataPtr->description << "<br>\n";
   }
   else
   {
@@ -488,7 +512,7 @@ void Element::PrintDocRightPane(std::string &_html, int _spacing,
   }
 
   stream << "<font style='font-weight:bold'>Required: </font>"
-         << this->dataPtr->required << "&nbsp;&nbsp;&nbsp;\n";
+         << *this->dataPtr->required << "&nbsp;&nbsp;&nbsp;\n";
 
   stream << "<font style='font-weight:bold'>Type: </font>";
   if (this->dataPtr->value)
@@ -567,8 +591,8 @@ void Element::PrintDocLeftPane(std::string &_html, int _spacing,
   }
 
   stream << "<a id='" << start << "' onclick='highlight(" << start
-         << ");' href=\"#" << this->dataPtr->name << start
-         << "\">&lt" << this->dataPtr->name << "&gt</a>";
+         << ");' href=\"#" << *this->dataPtr->name << start
+         << "\">&lt" << *this->dataPtr->name << "&gt</a>";
 
   stream << "<div style='padding-left:" << _spacing << "px;'>\n";
 
@@ -591,7 +615,7 @@ void Element::PrintValuesImpl(sdf::Errors &_errors,
   }
   else if (this->GetExplicitlySetInFile() || _includeDefaultElements)
   {
-    _out << _prefix << "<" << this->dataPtr->name;
+    _out << _prefix << "<" << *this->dataPtr->name;
 
     this->dataPtr->PrintAttributes(
         _errors, _includeDefaultAttributes, _config, _out);
@@ -610,14 +634,14 @@ void Element::PrintValuesImpl(sdf::Errors &_errors,
                            _includeDefaultAttributes,
                            _config);
       }
-      _out << _prefix << "</" << this->dataPtr->name << ">\n";
+      _out << _prefix << "</" << *this->dataPtr->name << ">\n";
     }
     else
     {
       if (this->dataPtr->value)
       {
         _out << ">" << this->dataPtr->value->GetAsString(_errors, _config)
-             << "</" << this->dataPtr->name << ">\n";
+             << "</" << *this->dataPtr->name << ">\n";
       }
       else
       {
@@ -627,6 +651,62 @@ void Element::PrintValuesImpl(sdf::Errors &_errors,
   }
 }
 
+/////////////////////////////////////////////////
+void *ElementPrivate::operator new(std::size_t _size)
+{
+  return documentArenaNew(_size);
+}
+
+/////////////////////////////////////////////////
+void ElementPrivate::operator delete(void *_ptr) noexcept
+{
+  documentArenaDelete(_ptr);
+}
+
+/////////////////////////////////////////////////
+void ElementPrivate::PushElement(const ElementPtr &_elem)
+{
+  this->elements.push_back(_elem);
+  _elem->dataPtr->indexInParent = this->elements.size() - 1;
+
+  if (!this->elementIndex.empty())
+  {
+    // emplace keeps an existing entry, which is the first child by that name
+    this->elementIndex.emplace(_elem->GetName(), _elem);
+  }
+  else if (this->elements.size() == kElementIndexThreshold)
+  {
+    this->RebuildElementIndex();
+  }
+}
+
+/////////////////////////////////////////////////
+void ElementPrivate::EraseElement(ElementPtr_V::const_iterator _iter)
+{
+  std::size_t index = this->elements.erase(_iter) - this->elements.begin();
+  for (; index < this->elements.size(); ++index)
+  {
+    this->elements[index]->dataPtr->indexInParent = index;
+  }
+  this->RebuildElementIndex();
+}
+
+/////////////////////////////////////////////////
+void ElementPrivate::RebuildElementIndex()
+{
+  this->elementIndex.clear();
+  if (this->elements.size() < kElementIndexThreshold)
+  {
+    return;
+  }
+
+  this->elementIndex.reserve(this->elements.size());
+  for (const auto &elem : this->elements)
+  {
+    this->elementIndex.emplace(elem->GetName(), elem);
+  }
+}
+
 /////////////////////////////////////////////////
 void ElementPrivate::PrintAttributes(bool _includeDefaultAttributes,
                                      const PrintConfig &_config,
@@ -649,7 +729,7 @@ void ElementPrivate::PrintAttributes(sdf::Errors &_errors,
   // modifications to an Attribute by a PrintConfig will overwrite the original
   // existing Attribute when this Element is printed.
   std::set<std::string> attributeExceptions;
-  if (this->name == "pose")
+  if (*this->name == "pose")
   {
     if (_config.RotationInDegrees() || _config.RotationSnapToDegrees())
     {
@@ -903,13 +983,12 @@ ElementPtr Element::GetElementDescription(unsigned int _index) const
 /////////////////////////////////////////////////
 ElementPtr Element::GetElementDescription(const std::string &_key) const
 {
-  ElementPtr_V::const_iterator iter;
-  for (iter = this->dataPtr->elementDescriptions.begin();
-       iter != this->dataPtr->elementDescriptions.end(); ++iter)
+  if (this->dataPtr->elementDescriptionIndex)
   {
-    if ((*iter)->GetName() == _key)
+    auto it = this->dataPtr->elementDescriptionIndex->find(_key);
+    if (it != this->dataPtr->elementDescriptionIndex->end())
     {
-      return (*iter);
+      return it->second;
     }
   }
 
@@ -931,6 +1010,16 @@ bool Element::HasElement(const std::string &_name) const
 /////////////////////////////////////////////////
 ElementPtr Element::GetElementImpl(const std::string &_name) const
 {
+  if (!this->dataPtr->elementIndex.empty())
+  {
+    auto it = this->dataPtr->elementIndex.find(_name);
+    if (it != this->dataPtr->elementIndex.end())
+    {
+      return it->second;
+    }
+    return ElementPtr();
+  }
+
   ElementPtr_V::const_iterator iter;
   for (iter = this->dataPtr->elements.begin();
        iter != this->dataPtr->elements.end(); ++iter)
@@ -961,51 +1050,53 @@ ElementPtr Element::GetFirstElement() const
 ElementPtr Element::GetNextElement(const std::string &_name) const
 {
   auto parent = this->dataPtr->parent.lock();
-  if (parent)
+  if (!parent)
   {
-    ElementPtr_V::const_iterator iter;
-    iter = std::find(parent->dataPtr->elements.begin(),
-        parent->dataPtr->elements.end(), shared_from_this());
+    return ElementPtr();
+  }
 
-    if (iter == parent->dataPtr->elements.end())
+  const ElementPtr_V &siblings = parent->dataPtr->elements;
+  std::size_t index = this->dataPtr->indexInParent;
+  if (index >= siblings.size() || siblings[index].get() != this)
+  {
+    // The stored position is stale, e.g. if this element was also inserted
+    // into another parent, so search for this element instead.
+    auto iter = std::find_if(siblings.begin(), siblings.end(),
+        [this](const ElementPtr &_sibling)
+        {
+          return _sibling.get() == this;
+        });
+    if (iter == siblings.end())
     {
       return ElementPtr();
     }
+    index = iter - siblings.begin();
+  }
 
-    ++iter;
-    if (iter == parent->dataPtr->elements.end())
-    {
-      return ElementPtr();
-    }
-    else if (_name.empty())
-    {
-      return *(iter);
-    }
-    else
+  for (++index; index < siblings.size(); ++index)
+  {
+    if (_name.empty() || siblings[index]->GetName() == _name)
     {
-      for (; iter != parent->dataPtr->elements.end(); ++iter)
-      {
-        if ((*iter)->GetName() == _name)
-        {
-          return (*iter);
-        }
-      }
+      return siblings[index];
     }
   }
 
   return ElementPtr();
 }
 
+/////////////////////////////////////////////////
+ElementRange Element::Children(const std::string &_name) const
+{
+  return ElementRange(&this->dataPtr->elements, _name);
+}
+
 /////////////////////////////////////////////////
 std::set<std::string> Element::GetElementTypeNames() const
 {
   std::set<std::string> result;
-  auto elem = this->GetFirstElement();
-  while (elem)
+  for (const auto &elem : this->dataPtr->elements)
   {
-    std::string typeName = elem->GetName();
-    result.insert(typeName);
-    elem = elem->GetNextElement();
+    result.insert(elem->GetName());
   }
   return result;
 }
@@ -1087,17 +1178,7 @@ std::map<std::string, std::size_t> Element::CountNamedElements(
 {
   std::map<std::string, std::size_t> result;
 
-  sdf::ElementPtr elem;
-  if (_type.empty())
-  {
-    elem = this->GetFirstElement();
-  }
-  else
-  {
-    elem = this->GetElementImpl(_type);
-  }
-
-  while (elem)
+  for (const auto &elem : this->Children(_type))
   {
     auto ignoreIt = std::find(_ignoreElements.begin(), _ignoreElements.end(),
                               elem->GetName());
@@ -1117,8 +1198,6 @@ std::map<std::string, std::size_t> Element::CountNamedElements(
         ++result[childNameAttributeValue];
       }
     }
-
-    elem = elem->GetNextElement(_type);
   }
 
   return result;
@@ -1160,7 +1239,7 @@ ElementConstPtr Element::FindElement(const std::string &_name) const
 /////////////////////////////////////////////////
 void Element::InsertElement(ElementPtr _elem)
 {
-  this->dataPtr->elements.push_back(_elem);
+  this->dataPtr->PushElement(_elem);
 }
 
 /////////////////////////////////////////////////
@@ -1168,7 +1247,7 @@ void Element::InsertElement(ElementPtr _elem,  bool _setParentToSelf)
 {
   if (_setParentToSelf)
     _elem->SetParent(shared_from_this());
-  this->dataPtr->elements.push_back(_elem);
+  this->dataPtr->PushElement(_elem);
 }
 
 /////////////////////////////////////////////////
@@ -1192,26 +1271,24 @@ ElementPtr Element::AddElement(const std::string &_name, sdf::Errors &_errors)
   // if this element is a reference sdf and does not have any element
   // descriptions then get them from its parent
   auto parent = this->dataPtr->parent.lock();
-  if (!this->dataPtr->referenceSDF.empty() &&
+  if (!this->dataPtr->referenceSDF->empty() &&
       this->dataPtr->elementDescriptions.empty() && parent &&
-      parent->GetName() == this->dataPtr->name)
+      parent->dataPtr->name == this->dataPtr->name)
   {
-    for (unsigned int i = 0; i < parent->GetElementDescriptionCount(); ++i)
-    {
-      this->dataPtr->elementDescriptions.push_back(
-        parent->GetElementDescription(i)->Clone(_errors));
-    }
+    this->dataPtr->elementDescriptions = parent->dataPtr->elementDescriptions;
+    this->dataPtr->elementDescriptionIndex =
+        parent->dataPtr->elementDescriptionIndex;
   }
 
   ElementPtr_V::const_iterator iter, iter2;
   for (iter = this->dataPtr->elementDescriptions.begin();
       iter != this->dataPtr->elementDescriptions.end(); ++iter)
   {
-    if ((*iter)->dataPtr->name == _name)
+    if (*(*iter)->dataPtr->name == _name)
     {
       ElementPtr elem = (*iter)->Clone(_errors);
       elem->SetParent(shared_from_this());
-      this->dataPtr->elements.push_back(elem);
+      this->dataPtr->PushElement(elem);
 
       // Add all child elements.
       for (iter2 = elem->dataPtr->elementDescriptions.begin();
@@ -1220,7 +1297,7 @@ ElementPtr Element::AddElement(const std::string &_name, sdf::Errors &_errors)
         // Add only required child element
         if ((*iter2)->GetRequired() == "1")
         {
-          elem->AddElement((*iter2)->dataPtr->name, _errors);
+          elem->AddElement(*(*iter2)->dataPtr->name, _errors);
         }
       }
       return this->dataPtr->elements.back();
@@ -1236,8 +1313,8 @@ ElementPtr Element::AddElement(const std::string &_name, sdf::Errors &_errors)
 void Element::Clear()
 {
   this->ClearElements();
-  this->dataPtr->originalVersion.clear();
-  this->dataPtr->path.clear();
+  this->dataPtr->originalVersion = InternString("");
+  this->dataPtr->path = emptySharedString();
   this->dataPtr->lineNumber = std::nullopt;
   this->dataPtr->xmlPath.clear();
 }
@@ -1252,6 +1329,7 @@ void Element::ClearElements()
   }
 
   this->dataPtr->elements.clear();
+  this->dataPtr->elementIndex.clear();
 }
 
 
@@ -1297,17 +1375,13 @@ void Element::Reset()
     (*iter).reset();
   }
 
-  for (ElementPtr_V::iterator iter = this->dataPtr->elementDescriptions.begin();
-      iter != this->dataPtr->elementDescriptions.end(); ++iter)
-  {
-    if (*iter)
-    {
-      (*iter)->Reset();
-    }
-    (*iter).reset();
-  }
   this->dataPtr->elements.clear();
+  this->dataPtr->elementIndex.clear();
+
+  // Element descriptions may be shared with other elements, so only drop
+  // the references to them.
   this->dataPtr->elementDescriptions.clear();
+  this->dataPtr->elementDescriptionIndex.reset();
 
   this->dataPtr->value.reset();
 
@@ -1318,6 +1392,20 @@ void Element::Reset()
 void Element::AddElementDescription(ElementPtr _elem)
 {
   this->dataPtr->elementDescriptions.push_back(_elem);
+
+  // The index may be shared with other elements, in which case it is copied
+  // so that they are not affected. Otherwise it is modified in place.
+  auto &index = this->dataPtr->elementDescriptionIndex;
+  if (!index)
+  {
+    index = std::make_shared<std::unordered_map<std::string, ElementPtr>>();
+  }
+  else if (index.use_count() > 1)
+  {
+    index = std::make_shared<std::unordered_map<std::string, ElementPtr>>(
+        *index);
+  }
+  index->emplace(_elem->GetName(), _elem);
 }
 
 /////////////////////////////////////////////////
@@ -1335,13 +1423,14 @@ sdf::ElementPtr Element::GetIncludeElement() const
 /////////////////////////////////////////////////
 void Element::SetFilePath(const std::string &_path)
 {
-  this->dataPtr->path = _path;
+  this->dataPtr->path = _path.empty() ? emptySharedString() :
+      std::make_shared<const std::string>(_path);
 }
 
 /////////////////////////////////////////////////
 const std::string &Element::FilePath() const
 {
-  return this->dataPtr->path;
+  return *this->dataPtr->path;
 }
 
 /////////////////////////////////////////////////
@@ -1371,25 +1460,26 @@ const std::string &Element::XmlPath() const
 /////////////////////////////////////////////////
 void Element::SetOriginalVersion(const std::string &_version)
 {
-  this->dataPtr->originalVersion = _version;
+  this->dataPtr->originalVersion = InternString(_version);
 }
 
 /////////////////////////////////////////////////
 const std::string &Element::OriginalVersion() const
 {
-  return this->dataPtr->originalVersion;
+  return *this->dataPtr->originalVersion;
 }
 
 /////////////////////////////////////////////////
 std::string Element::GetDescription() const
 {
-  return this->dataPtr->description;
+  return *this->dataPtr->description;
 }
 
 /////////////////////////////////////////////////
 void Element::SetDescription(const std::string &_desc)
 {
-  this->dataPtr->description = _desc;
+  this->dataPtr->description = _desc.empty() ? emptySharedString() :
+      std::make_shared<const std::string>(_desc);
 }
 
 /////////////////////////////////////////////////
@@ -1404,7 +1494,7 @@ void Element::RemoveFromParent()
 
     if (iter != parent->dataPtr->elements.end())
     {
-      parent->dataPtr->elements.erase(iter);
+      parent->dataPtr->EraseElement(iter);
       parent.reset();
     }
   }
@@ -1430,7 +1520,7 @@ void Element::RemoveChild(ElementPtr _child, sdf::Errors &)
   if (iter != this->dataPtr->elements.end())
   {
     _child->SetParent(ElementPtr());
-    this->dataPtr->elements.erase(iter);
+    this->dataPtr->EraseElement(iter);
   }
 }
 
@@ -1497,3 +1587,106 @@ std::vector<std::string> Element::NameUniquenessExceptions()
   // We make exception for "plugin" when checking for name uniqueness.
   return {"plugin"};
 }
+
+/////////////////////////////////////////////////
+ElementIterator::ElementIterator(const ElementPtr_V *_elements,
+                                 std::size_t _index, const std::string &_name)
+  : elements(_elements), index(_index), name(_name)
+{
+  this->SkipToMatch();
+}
+
+/////////////////////////////////////////////////
+ElementIterator::reference ElementIterator::operator*() const
+{
+  return (*this->elements)[this->index];
+}
+
+/////////////////////////////////////////////////
+ElementIterator::pointer ElementIterator::operator->() const
+{
+  return &(*this->elements)[this->index];
+}
+
+/////////////////////////////////////////////////
+ElementIterator &ElementIterator::operator++()
+{
+  ++this->index;
+  this->SkipToMatch();
+  return *this;
+}
+
+/////////////////////////////////////////////////
+ElementIterator ElementIterator::operator++(int)
+{
+  ElementIterator result = *this;
+  ++(*this);
+  return result;
+}
+
+/////////////////////////////////////////////////
+bool ElementIterator::operator==(const ElementIterator &_other) const
+{
+  const bool atEnd = !this->elements ||
+      this->index >= this->elements->size();
+  const bool otherAtEnd = !_other.elements ||
+      _other.index >= _other.elements->size();
+  if (atEnd || otherAtEnd)
+  {
+    return atEnd == otherAtEnd;
+  }
+  return this->elements == _other.elements && this->index == _other.index;
+}
+
+/////////////////////////////////////////////////
+bool ElementIterator::operator!=(const ElementIterator &_other) const
+{
+  return !(*this == _other);
+}
+
+/////////////////////////////////////////////////
+void ElementIterator::SkipToMatch()
+{
+  if (!this->elements || this->name.empty())
+  {
+    return;
+  }
+
+  // Element names are interned, so once one child element matches the
+  // others are compared by the address of their name.
+  for (; this->index < this->elements->size(); ++this->index)
+  {
+    const std::string &elemName = (*this->elements)[this->index]->GetName();
+    if (this->internedName ? &elemName == this->internedName :
+        elemName == this->name)
+    {
+      this->internedName = &elemName;
+      return;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+ElementRange::ElementRange(const ElementPtr_V *_elements,
+                           const std::string &_name)
+  : elements(_elements), name(_name)
+{
+}
+
+/////////////////////////////////////////////////
+ElementIterator ElementRange::begin() const
+{
+  return ElementIterator(this->elements, 0, this->name);
+}
+
+/////////////////////////////////////////////////
+ElementIterator ElementRange::end() const
+{
+  return ElementIterator();
+}
+
+/////////////////////////////////////////////////
+bool ElementRange::empty() const
+{
+  return this->begin() == this->end();
+}
@@ -15,6 +15,9 @@
  *
  */
 
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "sdf/Element.hh"
@@ -445,6 +448,41 @@ TEST(Element, Clone)
   EXPECT_EQ(newelem, clonedAttribs[0]->GetParentElement());
 }
 
+/////////////////////////////////////////////////
+TEST(Element, CloneSharesElementDescriptions)
+{
+  sdf::ElementPtr parent = std::make_shared<sdf::Element>();
+  sdf::ElementPtr desc = std::make_shared<sdf::Element>();
+  desc->SetName("child");
+  desc->AddAttribute("name", "string", "", true, "name");
+  parent->SetName("parent");
+  parent->AddElementDescription(desc);
+
+  sdf::ElementPtr clone = parent->Clone();
+  ASSERT_EQ(1UL, clone->GetElementDescriptionCount());
+  EXPECT_EQ(desc, clone->GetElementDescription(0));
+
+  // Adding a child instantiates the description without changing it
+  sdf::ElementPtr child = clone->AddElement("child");
+  ASSERT_NE(nullptr, child);
+  EXPECT_NE(desc, child);
+  child->GetAttribute("name")->SetFromString("foo");
+  EXPECT_EQ("", desc->GetAttribute("name")->GetAsString());
+
+  // Adding a description only affects the element it is added to
+  sdf::ElementPtr otherDesc = std::make_shared<sdf::Element>();
+  otherDesc->SetName("other");
+  clone->AddElementDescription(otherDesc);
+  EXPECT_EQ(2UL, clone->GetElementDescriptionCount());
+  EXPECT_EQ(1UL, parent->GetElementDescriptionCount());
+
+  // Resetting an element does not reset the shared descriptions
+  clone->Reset();
+  EXPECT_EQ(0UL, clone->GetElementDescriptionCount());
+  EXPECT_EQ(1UL, parent->GetElementDescriptionCount());
+  EXPECT_EQ(1UL, desc->GetAttributeCount());
+}
+
 /////////////////////////////////////////////////
 TEST(Element, ClearElements)
 {
@@ -922,6 +960,111 @@ TEST(Element, GetNextElementMultiple)
   ASSERT_EQ(child2->GetNextElement(""), nullptr);
 }
 
+/////////////////////////////////////////////////
+TEST(Element, GetNextElementAfterRemoval)
+{
+  sdf::ElementPtr parent = std::make_shared<sdf::Element>();
+  std::vector<sdf::ElementPtr> children;
+  for (int i = 0; i < 4; ++i)
+  {
+    sdf::ElementPtr child = std::make_shared<sdf::Element>();
+    child->SetName(i % 2 == 0 ? "even" : "odd");
+    parent->InsertElement(child, true);
+    children.push_back(child);
+  }
+
+  EXPECT_EQ(children[1], children[0]->GetNextElement());
+  EXPECT_EQ(children[2], children[0]->GetNextElement("even"));
+  EXPECT_EQ(nullptr, children[2]->GetNextElement("even"));
+
+  parent->RemoveChild(children[1]);
+  EXPECT_EQ(children[2], children[0]->GetNextElement());
+  EXPECT_EQ(children[3], children[2]->GetNextElement());
+  EXPECT_EQ(nullptr, children[1]->GetNextElement());
+
+  // An element that is also a child of another element
+  sdf::ElementPtr other = std::make_shared<sdf::Element>();
+  other->InsertElement(children[2]);
+  EXPECT_EQ(children[3], children[2]->GetNextElement());
+}
+
+/////////////////////////////////////////////////
+TEST(Element, ChildElementIndex)
+{
+  sdf::ElementPtr parent = std::make_shared<sdf::Element>();
+  parent->SetName("parent");
+
+  // Enough children for the child element index to be used
+  std::vector<sdf::ElementPtr> children;
+  for (int i = 0; i < 20; ++i)
+  {
+    sdf::ElementPtr child = std::make_shared<sdf::Element>();
+    child->SetName("child" + std::to_string(i % 10));
+    parent->InsertElement(child, true);
+    children.push_back(child);
+  }
+
+  // Lookups return the first child with a given name
+  EXPECT_EQ(children[0], parent->FindElement("child0"));
+  EXPECT_EQ(children[9], parent->FindElement("child9"));
+  EXPECT_FALSE(parent->HasElement("child10"));
+
+  // Removing a child makes the next child with that name the first one
+  parent->RemoveChild(children[0]);
+  EXPECT_EQ(children[10], parent->FindElement("child0"));
+  children[10]->RemoveFromParent();
+  EXPECT_FALSE(parent->HasElement("child0"));
+
+  // Renaming a child is reflected in the index
+  children[1]->SetName("renamed");
+  EXPECT_EQ(children[1], parent->FindElement("renamed"));
+  EXPECT_EQ(children[11], parent->FindElement("child1"));
+
+  // Clones and copies have an index consistent with their children
+  sdf::ElementPtr clone = parent->Clone();
+  ASSERT_NE(nullptr, clone->FindElement("renamed"));
+  EXPECT_NE(children[1], clone->FindElement("renamed"));
+  EXPECT_FALSE(clone->HasElement("child0"));
+  sdf::ElementPtr copy = std::make_shared<sdf::Element>();
+  copy->Copy(parent);
+  ASSERT_NE(nullptr, copy->FindElement("child5"));
+  EXPECT_EQ(copy, copy->FindElement("child5")->GetParent());
+
+  parent->ClearElements();
+  EXPECT_FALSE(parent->HasElement("renamed"));
+  EXPECT_EQ(nullptr, parent->GetFirstElement());
+  sdf::ElementPtr child = std::make_shared<sdf::Element>();
+  child->SetName("renamed");
+  parent->InsertElement(child, true);
+  EXPECT_EQ(child, parent->FindElement("renamed"));
+}
+
+/////////////////////////////////////////////////
+TEST(Element, ElementDescriptionIndex)
+{
+  sdf::ElementPtr parent = std::make_shared<sdf::Element>();
+  for (int i = 0; i < 3; ++i)
+  {
+    sdf::ElementPtr desc = std::make_shared<sdf::Element>();
+    desc->SetName("desc" + std::to_string(i));
+    desc->AddValue("int", std::to_string(i), false, "description");
+    parent->AddElementDescription(desc);
+  }
+
+  EXPECT_TRUE(parent->HasElementDescription("desc1"));
+  EXPECT_FALSE(parent->HasElementDescription("desc3"));
+  EXPECT_EQ(2, parent->Get<int>("desc2"));
+
+  // Adding a description to a clone does not change the original's index
+  sdf::ElementPtr clone = parent->Clone();
+  sdf::ElementPtr desc = std::make_shared<sdf::Element>();
+  desc->SetName("desc3");
+  clone->AddElementDescription(desc);
+  EXPECT_TRUE(clone->HasElementDescription("desc3"));
+  EXPECT_FALSE(parent->HasElementDescription("desc3"));
+  EXPECT_TRUE(clone->HasElementDescription("desc0"));
+}
+
 /////////////////////////////////////////////////
 /// Helper function to add child elements without having to create descriptions
 sdf::ElementPtr addChildElement(sdf::ElementPtr _parent,
@@ -941,6 +1084,49 @@ sdf::ElementPtr addChildElement(sdf::ElementPtr _parent,
   return child;
 }
 
+/////////////////////////////////////////////////
+TEST(Element, Children)
+{
+  sdf::ElementPtr parent = std::make_shared<sdf::Element>();
+  EXPECT_TRUE(parent->Children().empty());
+  EXPECT_TRUE(parent->Children("link").empty());
+
+  addChildElement(parent, "link", true, "link1");
+  addChildElement(parent, "joint", true, "joint1");
+  addChildElement(parent, "link", true, "link2");
+  addChildElement(parent, "frame", true, "frame1");
+
+  std::vector<std::string> names;
+  for (const auto &child : parent->Children())
+  {
+    names.push_back(child->Get<std::string>("name"));
+  }
+  EXPECT_EQ((std::vector<std::string>{"link1", "joint1", "link2", "frame1"}),
+            names);
+
+  names.clear();
+  for (const auto &link : parent->Children("link"))
+  {
+    names.push_back(link->Get<std::string>("name"));
+  }
+  EXPECT_EQ((std::vector<std::string>{"link1", "link2"}), names);
+
+  EXPECT_FALSE(parent->Children("frame").empty());
+  EXPECT_TRUE(parent->Children("model").empty());
+
+  // Child elements inserted while iterating are visited
+  int count = 0;
+  for (const auto &link : parent->Children("link"))
+  {
+    if (link->Get<std::string>("name") == "link1")
+    {
+      addChildElement(parent, "link", true, "link3");
+    }
+    ++count;
+  }
+  EXPECT_EQ(3, count);
+}
+
 /////////////////////////////////////////////////
 TEST(Element, CountNamedElements)
 {
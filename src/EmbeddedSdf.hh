@@ -18,6 +18,8 @@
 #ifndef SDF_EMBEDDEDSDF_HH_
 #define SDF_EMBEDDEDSDF_HH_
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <string>
 
@@ -35,6 +37,133 @@ namespace sdf
   /// directory such as "1.8/root.sdf", and the values are the contents of
   /// that source file.
   const std::map<std::string, std::string> &GetEmbeddedSdf();
+
+  /// \internal
+  /// \brief An attribute of an element in the embedded schema tables.
+  struct EmbeddedSchemaAttribute
+  {
+    /// \brief Name of the attribute.
+    const char *name;
+
+    /// \brief Type of the attribute.
+    const char *type;
+
+    /// \brief Default value of the attribute.
+    const char *defaultValue;
+
+    /// \brief True if the attribute is required.
+    bool required;
+
+    /// \brief Description of the attribute.
+    const char *description;
+  };
+
+  /// \internal
+  /// \brief A child element description in the embedded schema tables.
+  struct EmbeddedSchemaChild
+  {
+    /// \brief Index of the child in EmbeddedSchema::elements.
+    std::uint16_t element;
+
+    /// \brief Description that replaces the description of the child, as
+    /// given by an <include> of the spec, or nullptr.
+    const char *description;
+  };
+
+  /// \internal
+  /// \brief An element description in the embedded schema tables. This
+  /// holds everything initXml reads from an <element> of the spec.
+  struct EmbeddedSchemaElement
+  {
+    /// \brief Name of the element.
+    const char *name;
+
+    /// \brief Required string of the element, such as "1" or "*".
+    const char *required;
+
+    /// \brief Name of the referenced element, or nullptr.
+    const char *referenceSdf;
+
+    /// \brief Type of the value of the element, or nullptr if the element
+    /// has no value.
+    const char *type;
+
+    /// \brief Default value of the element, if it has a value.
+    const char *defaultValue;
+
+    /// \brief True if the value of the element is required.
+    bool valueRequired;
+
+    /// \brief Minimum value of the element, if it has a value.
+    const char *minValue;
+
+    /// \brief Maximum value of the element, if it has a value.
+    const char *maxValue;
+
+    /// \brief Description of the element, or nullptr.
+    const char *description;
+
+    /// \brief True if the children of the element are copied.
+    bool copyChildren;
+
+    /// \brief Index of the first attribute in EmbeddedSchema::attributes.
+    std::uint16_t firstAttribute;
+
+    /// \brief Number of attributes.
+    std::uint16_t attributeCount;
+
+    /// \brief Index of the first child in EmbeddedSchema::children.
+    std::uint16_t firstChild;
+
+    /// \brief Number of children.
+    std::uint16_t childCount;
+  };
+
+  /// \internal
+  /// \brief A spec file in the embedded schema tables.
+  struct EmbeddedSchemaFile
+  {
+    /// \brief Name of the file, such as "model.sdf".
+    const char *name;
+
+    /// \brief Index of the root element of the file in
+    /// EmbeddedSchema::elements.
+    std::uint16_t element;
+  };
+
+  /// \internal
+  /// \brief Schema tables generated at build time from the spec files of
+  /// one SDFormat version. Each <element> of the spec appears once, and
+  /// includes refer to the root element of the included file, so the
+  /// parser can build element descriptions without parsing any XML.
+  struct EmbeddedSchema
+  {
+    /// \brief SDFormat version of the tables, such as "1.12".
+    const char *version;
+
+    /// \brief Element descriptions. The first one is the root of root.sdf.
+    const EmbeddedSchemaElement *elements;
+
+    /// \brief Number of element descriptions.
+    std::size_t elementCount;
+
+    /// \brief Attributes of all the elements.
+    const EmbeddedSchemaAttribute *attributes;
+
+    /// \brief Children of all the elements.
+    const EmbeddedSchemaChild *children;
+
+    /// \brief Spec files, sorted by name.
+    const EmbeddedSchemaFile *files;
+
+    /// \brief Number of spec files.
+    std::size_t fileCount;
+  };
+
+  /// \internal
+  /// \brief Get the schema tables of the latest SDFormat version, which are
+  /// generated from the same spec files as GetEmbeddedSdf().
+  const EmbeddedSchema &GetEmbeddedSchema();
 }
 }
 #endif
@@ -0,0 +1,244 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "sdf/Filesystem.hh"
+#include "sdf/FindFileCache.hh"
+#include "sdf/SDFImpl.hh"
+
+using namespace sdf;
+
+namespace
+{
+/// \brief The path found for a URI with one combination of search flags.
+struct FindFileCacheEntry
+{
+  /// \brief True if the entry holds a lookup.
+  bool valid = false;
+
+  /// \brief Path that was found, or an empty string.
+  std::string path;
+
+  /// \brief Errors reported by the lookup.
+  Errors errors;
+
+  /// \brief SDFormat version when the lookup was made.
+  std::string version;
+
+  /// \brief Working directory when the lookup was made. Relative file names
+  /// and local searches are resolved against it.
+  std::string workingDirectory;
+
+  /// \brief Time when the lookup was made.
+  std::chrono::steady_clock::time_point inserted;
+
+  /// \brief Number of probes made by the lookup.
+  uint64_t probes = 0;
+};
+
+/// \brief Lookups of a URI, indexed by flagIndex.
+using FindFileCacheEntries = std::array<FindFileCacheEntry, 4>;
+}
+
+/// \brief Private data for FindFileCache.
+class sdf::FindFileCache::Implementation
+{
+  /// \brief Mutex that protects the members below.
+  public: mutable std::mutex mutex;
+
+  /// \brief Cached lookups, by URI.
+  public: std::unordered_map<std::string, FindFileCacheEntries> entries;
+
+  /// \brief Number of cached lookups.
+  public: uint64_t size = 0;
+
+  /// \brief Time after which entries are discarded, or zero.
+  public: std::chrono::steady_clock::duration timeToLive{0};
+
+  /// \brief Number of lookups that returned a cached path.
+  public: uint64_t hits = 0;
+
+  /// \brief Number of lookups that did not return a cached path.
+  public: uint64_t misses = 0;
+
+  /// \brief Number of probes made by lookups added to the cache.
+  public: uint64_t probes = 0;
+
+  /// \brief Number of probes avoided by cache hits.
+  public: uint64_t probesSaved = 0;
+};
+
+/////////////////////////////////////////////////
+/// \brief Get the index of a combination of search flags.
+/// \param[in] _searchLocalPath True if the working directory is searched.
+/// \param[in] _useCallback True if the find file callback is used.
+/// \return Index into FindFileCacheEntries.
+static std::size_t flagIndex(bool _searchLocalPath, bool _useCallback)
+{
+  return (_searchLocalPath ? 2u : 0u) + (_useCallback ? 1u : 0u);
+}
+
+/////////////////////////////////////////////////
+FindFileCache::FindFileCache()
+  : dataPtr(gz::utils::MakeUniqueImpl<Implementation>())
+{
+}
+
+/////////////////////////////////////////////////
+void FindFileCache::SetTimeToLive(
+    std::chrono::steady_clock::duration _timeToLive)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->timeToLive = _timeToLive;
+}
+
+/////////////////////////////////////////////////
+std::chrono::steady_clock::duration FindFileCache::TimeToLive() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->timeToLive;
+}
+
+/////////////////////////////////////////////////
+bool FindFileCache::Find(const std::string &_uri, bool _searchLocalPath,
+                         bool _useCallback, std::string &_path,
+                         sdf::Errors &_errors)
+{
+  const std::string workingDirectory = sdf::filesystem::current_path();
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  auto it = this->dataPtr->entries.find(_uri);
+  if (it != this->dataPtr->entries.end())
+  {
+    FindFileCacheEntry &entry =
+        it->second[flagIndex(_searchLocalPath, _useCallback)];
+    if (entry.valid)
+    {
+      const bool expired =
+          this->dataPtr->timeToLive.count() > 0 &&
+          std::chrono::steady_clock::now() - entry.inserted >
+          this->dataPtr->timeToLive;
+      if (!expired && entry.version == SDF::Version() &&
+          entry.workingDirectory == workingDirectory)
+      {
+        _path = entry.path;
+        _errors.insert(_errors.end(), entry.errors.begin(),
+                       entry.errors.end());
+        ++this->dataPtr->hits;
+        this->dataPtr->probesSaved += entry.probes;
+        return true;
+      }
+
+      entry = FindFileCacheEntry();
+      --this->dataPtr->size;
+    }
+  }
+
+  ++this->dataPtr->misses;
+  return false;
+}
+
+/////////////////////////////////////////////////
+void FindFileCache::Insert(const std::string &_uri, bool _searchLocalPath,
+                           bool _useCallback, const std::string &_path,
+                           const sdf::Errors &_errors, uint64_t _probes)
+{
+  FindFileCacheEntry newEntry;
+  newEntry.valid = true;
+  newEntry.path = _path;
+  newEntry.errors = _errors;
+  newEntry.version = SDF::Version();
+  newEntry.workingDirectory = sdf::filesystem::current_path();
+  newEntry.inserted = std::chrono::steady_clock::now();
+  newEntry.probes = _probes;
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  FindFileCacheEntry &entry =
+      this->dataPtr->entries[_uri][flagIndex(_searchLocalPath, _useCallback)];
+  if (!entry.valid)
+    ++this->dataPtr->size;
+  entry = std::move(newEntry);
+  this->dataPtr->probes += _probes;
+}
+
+/////////////////////////////////////////////////
+bool FindFileCache::Invalidate(const std::string &_uri)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  auto it = this->dataPtr->entries.find(_uri);
+  if (it == this->dataPtr->entries.end())
+    return false;
+
+  bool found = false;
+  for (const FindFileCacheEntry &entry : it->second)
+  {
+    if (entry.valid)
+    {
+      --this->dataPtr->size;
+      found = true;
+    }
+  }
+  this->dataPtr->entries.erase(it);
+  return found;
+}
+
+/////////////////////////////////////////////////
+void FindFileCache::Clear()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->entries.clear();
+  this->dataPtr->size = 0;
+}
+
+/////////////////////////////////////////////////
+uint64_t FindFileCache::Size() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->size;
+}
+
+/////////////////////////////////////////////////
+uint64_t FindFileCache::Hits() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->hits;
+}
+
+/////////////////////////////////////////////////
+uint64_t FindFileCache::Misses() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->misses;
+}
+
+/////////////////////////////////////////////////
+uint64_t FindFileCache::Probes() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->probes;
+}
+
+/////////////////////////////////////////////////
+uint64_t FindFileCache::ProbesSaved() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->probesSaved;
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "sdf/FindFileCache.hh"
+#include "sdf/ParserConfig.hh"
+#include "sdf/SDFImpl.hh"
+
+/////////////////////////////////////////////////
+TEST(FindFileCache, FindInsert)
+{
+  sdf::FindFileCache cache;
+  EXPECT_EQ(0, cache.TimeToLive().count());
+
+  std::string path;
+  sdf::Errors errors;
+  EXPECT_FALSE(cache.Find("model://box", true, true, path, errors));
+  EXPECT_EQ(1u, cache.Misses());
+
+  cache.Insert("model://box", true, true, "/models/box", {}, 5);
+  cache.Insert("model://missing", true, true, "",
+               {{sdf::ErrorCode::FILE_READ, "not found"}}, 7);
+  EXPECT_EQ(2u, cache.Size());
+  EXPECT_EQ(12u, cache.Probes());
+
+  EXPECT_TRUE(cache.Find("model://box", true, true, path, errors));
+  EXPECT_EQ("/models/box", path);
+  EXPECT_TRUE(errors.empty());
+  EXPECT_EQ(5u, cache.ProbesSaved());
+
+  // Lookups that failed are cached too, along with their errors
+  EXPECT_TRUE(cache.Find("model://missing", true, true, path, errors));
+  EXPECT_TRUE(path.empty());
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_EQ("not found", errors[0].Message());
+  EXPECT_EQ(12u, cache.ProbesSaved());
+
+  // Each combination of search flags is cached separately
+  EXPECT_FALSE(cache.Find("model://box", false, true, path, errors));
+  EXPECT_FALSE(cache.Find("model://box", true, false, path, errors));
+  cache.Insert("model://box", false, true, "/models/box", {}, 4);
+  EXPECT_EQ(3u, cache.Size());
+
+  EXPECT_EQ(2u, cache.Hits());
+  EXPECT_EQ(3u, cache.Misses());
+
+  EXPECT_TRUE(cache.Invalidate("model://box"));
+  EXPECT_FALSE(cache.Invalidate("model://box"));
+  EXPECT_EQ(1u, cache.Size());
+  EXPECT_FALSE(cache.Find("model://box", true, true, path, errors));
+
+  cache.Clear();
+  EXPECT_EQ(0u, cache.Size());
+  EXPECT_FALSE(cache.Find("model://missing", true, true, path, errors));
+}
+
+/////////////////////////////////////////////////
+TEST(FindFileCache, TimeToLive)
+{
+  sdf::FindFileCache cache;
+  cache.SetTimeToLive(std::chrono::milliseconds(1));
+  EXPECT_EQ(std::chrono::milliseconds(1), cache.TimeToLive());
+
+  cache.Insert("model://box", true, true, "/models/box", {}, 1);
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+  std::string path;
+  sdf::Errors errors;
+  EXPECT_FALSE(cache.Find("model://box", true, true, path, errors));
+  EXPECT_EQ(0u, cache.Size());
+}
+
+/////////////////////////////////////////////////
+TEST(FindFileCache, WorkingDirectory)
+{
+  sdf::FindFileCache cache;
+  cache.Insert("box.sdf", true, false, "/models/box.sdf", {}, 1);
+
+  // Lookups from another working directory are not cached
+  const std::filesystem::path workingDirectory =
+      std::filesystem::current_path();
+  std::filesystem::current_path(workingDirectory.parent_path());
+  std::string path;
+  sdf::Errors errors;
+  const bool found = cache.Find("box.sdf", true, false, path, errors);
+  std::filesystem::current_path(workingDirectory);
+  EXPECT_FALSE(found);
+  EXPECT_EQ(0u, cache.Size());
+
+  cache.Insert("box.sdf", true, false, "/models/box.sdf", {}, 1);
+  EXPECT_TRUE(cache.Find("box.sdf", true, false, path, errors));
+  EXPECT_EQ("/models/box.sdf", path);
+}
+
+/////////////////////////////////////////////////
+TEST(FindFileCache, FindFile)
+{
+  int callbackCount = 0;
+  sdf::ParserConfig config;
+  config.SetFindCallback([&callbackCount](const std::string &_uri)
+  {
+    ++callbackCount;
+    return "/found/" + _uri;
+  });
+
+  auto cache = std::make_shared<sdf::FindFileCache>();
+  config.SetFindFileCache(cache);
+  EXPECT_EQ(cache, config.FindFileCache());
+
+  sdf::Errors errors;
+  const std::string uri = "sdf_find_file_cache_test://no_such_model";
+  EXPECT_EQ("/found/" + uri, sdf::findFile(errors, uri, true, true, config));
+  EXPECT_EQ("/found/" + uri, sdf::findFile(errors, uri, true, true, config));
+  EXPECT_TRUE(errors.empty());
+  EXPECT_EQ(1, callbackCount);
+  EXPECT_EQ(1u, cache->Misses());
+  EXPECT_EQ(1u, cache->Hits());
+  EXPECT_GT(cache->Probes(), 1u);
+  EXPECT_EQ(cache->Probes(), cache->ProbesSaved());
+
+  // Changing how files are found clears the cache
+  config.SetFindCallback([](const std::string &)
+  {
+    return std::string("/other");
+  });
+  EXPECT_EQ(0u, cache->Size());
+  EXPECT_EQ("/other", sdf::findFile(errors, uri, true, true, config));
+
+  config.AddURIPath("sdf_find_file_cache_test://", "/");
+  EXPECT_EQ(0u, cache->Size());
+}
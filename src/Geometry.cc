@@ -190,9 +190,7 @@ Errors Geometry::Load(ElementPtr _sdf, const ParserConfig &_config)
   {
     this->dataPtr->type = GeometryType::POLYLINE;
 
-    for (auto polylineElem = _sdf->GetElement("polyline", errors);
-         polylineElem != nullptr;
-         polylineElem = polylineElem->GetNextElement("polyline"))
+    for (const auto &polylineElem : _sdf->Children("polyline"))
     {
       sdf::Polyline polyline;
       auto err = polyline.Load(polylineElem);
@@ -0,0 +1,227 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <filesystem>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "sdf/IncludeCache.hh"
+#include "sdf/SDFImpl.hh"
+#include "DocumentArena.hh"
+
+using namespace sdf;
+
+namespace
+{
+/// \brief An element tree read from a file.
+struct IncludeCacheEntry
+{
+  /// \brief Every file the element tree was read from, which includes the
+  /// files of nested includes, with its modification time when it was read.
+  std::vector<std::pair<std::string, std::filesystem::file_time_type>> files;
+
+  /// \brief SDFormat version the file was converted to.
+  std::string version;
+
+  /// \brief Root element read from the file.
+  ElementPtr root;
+
+  /// \brief Errors reported when the file was read.
+  Errors errors;
+};
+}
+
+/// \brief Private data for IncludeCache.
+class sdf::IncludeCache::Implementation
+{
+  /// \brief Mutex that protects the entries and counters.
+  public: mutable std::mutex mutex;
+
+  /// \brief Cached files, by resolved path.
+  public: std::unordered_map<std::string, IncludeCacheEntry> entries;
+
+  /// \brief Number of lookups that returned a cached element tree.
+  public: uint64_t hits = 0;
+
+  /// \brief Number of lookups that did not return a cached element tree.
+  public: uint64_t misses = 0;
+};
+
+/////////////////////////////////////////////////
+/// \brief Get the modification time of a file.
+/// \param[in] _path Path of the file.
+/// \param[out] _modified Modification time of the file.
+/// \return True if the modification time was read.
+static bool modificationTime(const std::string &_path,
+    std::filesystem::file_time_type &_modified)
+{
+  std::error_code ec;
+  _modified = std::filesystem::last_write_time(_path, ec);
+  return !ec;
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the paths of the files an element tree was read from.
+/// \param[in] _elem Root of the element tree.
+/// \param[in,out] _paths Paths of the files are added to this set.
+static void filePaths(const ElementPtr &_elem, std::set<std::string> &_paths)
+{
+  if (!_elem->FilePath().empty())
+    _paths.insert(_elem->FilePath());
+  for (ElementPtr child = _elem->GetFirstElement(); child;
+       child = child->GetNextElement())
+  {
+    filePaths(child, _paths);
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Check that none of the files of an entry has been modified since
+/// the entry was added.
+/// \param[in] _entry The entry.
+/// \return True if every file has the modification time it was read with.
+static bool filesUnchanged(const IncludeCacheEntry &_entry)
+{
+  for (const auto &[path, modified] : _entry.files)
+  {
+    std::filesystem::file_time_type current;
+    if (!modificationTime(path, current) || current != modified)
+      return false;
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+IncludeCache::IncludeCache()
+  : dataPtr(gz::utils::MakeUniqueImpl<Implementation>())
+{
+}
+
+/////////////////////////////////////////////////
+ElementPtr IncludeCache::Find(const std::string &_path, sdf::Errors &_errors)
+{
+  IncludeCacheEntry entry;
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    auto it = this->dataPtr->entries.find(_path);
+    if (it != this->dataPtr->entries.end())
+      entry = it->second;
+  }
+
+  // The files are checked without holding the lock, so that threads reading
+  // other includes are not held up by file system calls.
+  const bool valid = entry.root && entry.version == SDF::Version() &&
+      filesUnchanged(entry);
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    if (valid)
+    {
+      ++this->dataPtr->hits;
+    }
+    else
+    {
+      ++this->dataPtr->misses;
+      auto it = this->dataPtr->entries.find(_path);
+      if (entry.root && it != this->dataPtr->entries.end() &&
+          it->second.root == entry.root)
+      {
+        this->dataPtr->entries.erase(it);
+      }
+    }
+  }
+  if (!valid)
+    return nullptr;
+
+  _errors.insert(_errors.end(), entry.errors.begin(), entry.errors.end());
+
+  // Cached trees are never modified, so they can be cloned without holding
+  // the lock. The clone is placed in the arena of the document being parsed.
+  return entry.root->Clone();
+}
+
+/////////////////////////////////////////////////
+void IncludeCache::Insert(const std::string &_path, const ElementPtr &_root,
+                          const sdf::Errors &_errors)
+{
+  IncludeCacheEntry entry;
+  std::filesystem::file_time_type modified;
+  if (!_root || !modificationTime(_path, modified))
+    return;
+  entry.files.emplace_back(_path, modified);
+
+  // Nested includes are expanded into the tree, so it is stale as soon as
+  // any of the files its elements were read from changes. Paths that are
+  // not files, such as that of a string, can not change.
+  std::set<std::string> paths;
+  filePaths(_root, paths);
+  for (const std::string &path : paths)
+  {
+    if (path != _path && modificationTime(path, modified))
+      entry.files.emplace_back(path, modified);
+  }
+
+  {
+    // The cache outlives the document being parsed, so keep the stored tree
+    // out of the document's arena.
+    DocumentArenaScope heapScope(nullptr);
+    entry.root = _root->Clone();
+  }
+  entry.version = SDF::Version();
+  entry.errors = _errors;
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->entries[_path] = std::move(entry);
+}
+
+/////////////////////////////////////////////////
+bool IncludeCache::Invalidate(const std::string &_path)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->entries.erase(_path) > 0;
+}
+
+/////////////////////////////////////////////////
+void IncludeCache::Clear()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->entries.clear();
+}
+
+/////////////////////////////////////////////////
+uint64_t IncludeCache::Size() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->entries.size();
+}
+
+/////////////////////////////////////////////////
+uint64_t IncludeCache::Hits() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->hits;
+}
+
+/////////////////////////////////////////////////
+uint64_t IncludeCache::Misses() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->misses;
+}
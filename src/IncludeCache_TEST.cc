@@ -0,0 +1,162 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/Element.hh"
+#include "sdf/IncludeCache.hh"
+
+/////////////////////////////////////////////////
+/// \brief Create a file in the temporary directory.
+/// \param[in] _name Name of the file.
+/// \return Path of the file.
+static std::string tempFile(const std::string &_name)
+{
+  const std::filesystem::path path =
+      std::filesystem::temp_directory_path() / _name;
+  std::ofstream(path) << "<sdf/>";
+  return path.string();
+}
+
+/////////////////////////////////////////////////
+TEST(IncludeCache, FindInsert)
+{
+  const std::string path = tempFile("sdf_include_cache_find.sdf");
+
+  sdf::IncludeCache cache;
+  sdf::Errors errors;
+  EXPECT_EQ(nullptr, cache.Find(path, errors));
+  EXPECT_EQ(0u, cache.Hits());
+  EXPECT_EQ(1u, cache.Misses());
+
+  auto root = std::make_shared<sdf::Element>();
+  root->SetName("sdf");
+  auto model = std::make_shared<sdf::Element>();
+  model->SetName("model");
+  root->InsertElement(model, true);
+  cache.Insert(path, root, {{sdf::ErrorCode::WARNING, "reported once"}});
+  EXPECT_EQ(1u, cache.Size());
+
+  // The cache holds its own copy of the tree
+  root->SetName("changed");
+
+  sdf::ElementPtr found = cache.Find(path, errors);
+  ASSERT_NE(nullptr, found);
+  EXPECT_EQ("sdf", found->GetName());
+  EXPECT_NE(nullptr, found->GetFirstElement());
+  EXPECT_EQ(1u, cache.Hits());
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_EQ("reported once", errors[0].Message());
+
+  // Every lookup returns a new clone
+  found->SetName("modified");
+  sdf::ElementPtr second = cache.Find(path, errors);
+  ASSERT_NE(nullptr, second);
+  EXPECT_NE(found, second);
+  EXPECT_EQ("sdf", second->GetName());
+  EXPECT_EQ(2u, cache.Hits());
+  EXPECT_EQ(1u, cache.Misses());
+
+  // Files that do not exist are not cached
+  cache.Insert(path + ".missing", root, {});
+  EXPECT_EQ(1u, cache.Size());
+
+  std::filesystem::remove(path);
+}
+
+/////////////////////////////////////////////////
+TEST(IncludeCache, Invalidate)
+{
+  const std::string path = tempFile("sdf_include_cache_invalidate.sdf");
+
+  sdf::IncludeCache cache;
+  auto root = std::make_shared<sdf::Element>();
+  root->SetName("sdf");
+  cache.Insert(path, root, {});
+  EXPECT_EQ(1u, cache.Size());
+
+  EXPECT_TRUE(cache.Invalidate(path));
+  EXPECT_FALSE(cache.Invalidate(path));
+  EXPECT_EQ(0u, cache.Size());
+
+  sdf::Errors errors;
+  EXPECT_EQ(nullptr, cache.Find(path, errors));
+
+  cache.Insert(path, root, {});
+  EXPECT_NE(nullptr, cache.Find(path, errors));
+
+  // Modifying the file invalidates its entry
+  std::filesystem::last_write_time(path,
+      std::filesystem::last_write_time(path) + std::chrono::hours(1));
+  EXPECT_EQ(nullptr, cache.Find(path, errors));
+  EXPECT_EQ(0u, cache.Size());
+
+  cache.Insert(path, root, {});
+  cache.Clear();
+  EXPECT_EQ(0u, cache.Size());
+  EXPECT_EQ(nullptr, cache.Find(path, errors));
+  EXPECT_TRUE(errors.empty());
+
+  EXPECT_EQ(1u, cache.Hits());
+  EXPECT_EQ(3u, cache.Misses());
+
+  std::filesystem::remove(path);
+}
+
+/////////////////////////////////////////////////
+TEST(IncludeCache, NestedFiles)
+{
+  const std::string path = tempFile("sdf_include_cache_outer.sdf");
+  const std::string nestedPath = tempFile("sdf_include_cache_nested.sdf");
+
+  // A tree with an element read from a nested include
+  sdf::IncludeCache cache;
+  auto root = std::make_shared<sdf::Element>();
+  root->SetName("sdf");
+  root->SetFilePath(path);
+  auto model = std::make_shared<sdf::Element>();
+  model->SetName("model");
+  model->SetFilePath(nestedPath);
+  root->InsertElement(model, true);
+  cache.Insert(path, root, {});
+
+  sdf::Errors errors;
+  EXPECT_NE(nullptr, cache.Find(path, errors));
+
+  // Modifying the nested file invalidates the entry of the outer file
+  std::filesystem::last_write_time(nestedPath,
+      std::filesystem::last_write_time(nestedPath) + std::chrono::hours(1));
+  EXPECT_EQ(nullptr, cache.Find(path, errors));
+  EXPECT_EQ(0u, cache.Size());
+
+  // Paths that are not files do not prevent caching
+  model->SetFilePath("data-string");
+  cache.Insert(path, root, {});
+  EXPECT_NE(nullptr, cache.Find(path, errors));
+
+  EXPECT_EQ(2u, cache.Hits());
+  EXPECT_EQ(1u, cache.Misses());
+
+  std::filesystem::remove(path);
+  std::filesystem::remove(nestedPath);
+}
@@ -294,7 +294,7 @@ Errors Model::Load(sdf::ElementPtr _sdf, const ParserConfig &_config)
     }
   }
 
-  for (auto elem = _sdf->GetFirstElement(); elem; elem = elem->GetNextElement())
+  for (const auto &elem : _sdf->Children())
   {
     const std::string &elementName = elem->GetName();
     if (elementName == "model")
@@ -0,0 +1,426 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <gz/utils/Environment.hh>
+
+#include "sdf/Filesystem.hh"
+#include "sdf/ModelIndex.hh"
+#include "sdf/ParserConfig.hh"
+#include "sdf/SDFImpl.hh"
+#include "sdf/parser.hh"
+
+using namespace sdf;
+
+/// \brief First line of a saved index.
+static const char kIndexHeader[] = "sdformat_model_index 1";
+
+namespace
+{
+/// \brief An indexed directory.
+struct ModelIndexDirectory
+{
+  /// \brief Modification time of the directory when it was scanned.
+  std::filesystem::file_time_type modified;
+
+  /// \brief Names of the entries of the directory.
+  std::unordered_set<std::string> entries;
+
+  /// \brief Model files, by the name of their model directory.
+  std::unordered_map<std::string, std::string> modelFiles;
+};
+}
+
+/// \brief Private data for ModelIndex.
+class sdf::ModelIndex::Implementation
+{
+  /// \brief Mutex that protects the members below.
+  public: mutable std::shared_mutex mutex;
+
+  /// \brief SDFormat version for which model files were chosen.
+  public: std::string version = SDF::Version();
+
+  /// \brief Indexed directories, by path.
+  public: std::unordered_map<std::string, ModelIndexDirectory> directories;
+
+  /// \brief Model files, by the path of their model directory.
+  public: std::unordered_map<std::string, std::string> modelFiles;
+
+  /// \brief Add a directory to the index, replacing any previous version of
+  /// it. The mutex must be locked.
+  /// \param[in] _path Path of the directory.
+  /// \param[in] _directory The directory.
+  public: void Insert(const std::string &_path,
+                      ModelIndexDirectory _directory);
+};
+
+/////////////////////////////////////////////////
+void ModelIndex::Implementation::Insert(const std::string &_path,
+                                        ModelIndexDirectory _directory)
+{
+  auto it = this->directories.find(_path);
+  if (it != this->directories.end())
+  {
+    for (const auto &[name, modelFile] : it->second.modelFiles)
+      this->modelFiles.erase(sdf::filesystem::append(_path, name));
+  }
+
+  for (const auto &[name, modelFile] : _directory.modelFiles)
+    this->modelFiles[sdf::filesystem::append(_path, name)] = modelFile;
+  this->directories[_path] = std::move(_directory);
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the directories searched by sdf::findFile that may be indexed.
+/// \param[in] _config Parser configuration.
+/// \return The URI paths of the configuration, followed by the directories
+/// of SDF_PATH, without duplicates.
+static std::vector<std::string> searchDirectories(const ParserConfig &_config)
+{
+  std::vector<std::string> directories;
+  auto add = [&directories](const std::string &_path)
+  {
+    if (!_path.empty() && std::find(directories.begin(), directories.end(),
+                                    _path) == directories.end())
+    {
+      directories.push_back(_path);
+    }
+  };
+
+  for (const auto &[uriScheme, paths] : _config.URIPathMap())
+  {
+    for (const auto &path : paths)
+      add(path);
+  }
+
+  std::string sdfPathEnv;
+  if (gz::utils::env("SDF_PATH", sdfPathEnv))
+  {
+    for (const auto &path : sdf::split(sdfPathEnv, ":"))
+      add(path);
+  }
+  return directories;
+}
+
+/////////////////////////////////////////////////
+ModelIndex::ModelIndex()
+  : dataPtr(gz::utils::MakeUniqueImpl<Implementation>())
+{
+}
+
+/////////////////////////////////////////////////
+sdf::Errors ModelIndex::Build(const ParserConfig &_config,
+                              unsigned int _threadCount)
+{
+  sdf::Errors errors;
+
+  // An entry of a scanned directory, which may be a model directory.
+  struct ModelDirectory
+  {
+    std::string path;
+    std::string name;
+    ModelIndexDirectory *directory;
+  };
+
+  std::vector<std::pair<std::string, ModelIndexDirectory>> scanned;
+  std::vector<ModelDirectory> models;
+  {
+    // Model files chosen for another version are not used, so every
+    // directory is scanned again.
+    std::unique_lock<std::shared_mutex> lock(this->dataPtr->mutex);
+    if (this->dataPtr->version != SDF::Version())
+    {
+      this->dataPtr->version = SDF::Version();
+      this->dataPtr->directories.clear();
+      this->dataPtr->modelFiles.clear();
+    }
+  }
+
+  const std::vector<std::string> directories = searchDirectories(_config);
+  scanned.reserve(directories.size());
+  for (const std::string &path : directories)
+  {
+    std::error_code ec;
+    const auto modified = std::filesystem::last_write_time(path, ec);
+    if (ec || !std::filesystem::is_directory(path, ec))
+      continue;
+
+    {
+      std::shared_lock<std::shared_mutex> lock(this->dataPtr->mutex);
+      auto it = this->dataPtr->directories.find(path);
+      if (it != this->dataPtr->directories.end() &&
+          it->second.modified == modified)
+      {
+        continue;
+      }
+    }
+
+    ModelIndexDirectory directory;
+    directory.modified = modified;
+    bool indexable = true;
+    for (std::filesystem::directory_iterator entry(path, ec), end;
+         !ec && entry != end; entry.increment(ec))
+    {
+      const std::string name = entry->path().filename().string();
+
+      // Such names can not be saved, so the directory is searched as usual.
+      if (name.find_first_of("\t\n") != std::string::npos)
+      {
+        indexable = false;
+        break;
+      }
+      directory.entries.insert(name);
+    }
+
+    if (ec)
+    {
+      errors.push_back({ErrorCode::FILE_READ,
+          "Unable to read directory [" + path + "]: " + ec.message()});
+      continue;
+    }
+    if (indexable)
+      scanned.emplace_back(path, std::move(directory));
+  }
+
+  for (auto &[path, directory] : scanned)
+  {
+    for (const std::string &name : directory.entries)
+    {
+      models.push_back(
+          {sdf::filesystem::append(path, name), name, &directory});
+    }
+  }
+
+  // Find and read the model.config files of the entries, which is the
+  // expensive part of the scan. Each model file is written to its own slot,
+  // and added to its directory afterwards.
+  std::vector<std::string> modelFiles(models.size());
+  std::atomic<std::size_t> nextModel{0};
+  auto readModels = [&]()
+  {
+    for (std::size_t i = nextModel++; i < models.size(); i = nextModel++)
+    {
+      const std::string &modelPath = models[i].path;
+      if (!sdf::filesystem::exists(
+              sdf::filesystem::append(modelPath, "model.config")) &&
+          !sdf::filesystem::exists(
+              sdf::filesystem::append(modelPath, "manifest.xml")))
+      {
+        continue;
+      }
+
+      // Models with errors or warnings, such as a deprecated manifest.xml,
+      // are not indexed, so that they are reported when they are included.
+      sdf::Errors modelErrors;
+      std::string modelFile = getModelFilePath(modelErrors, modelPath);
+      if (modelErrors.empty() &&
+          modelFile.find_first_of("\t\n") == std::string::npos)
+      {
+        modelFiles[i] = std::move(modelFile);
+      }
+    }
+  };
+
+  const std::size_t threadCount =
+      std::min<std::size_t>(std::max(_threadCount, 1u), models.size());
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < threadCount; ++i)
+    threads.emplace_back(readModels);
+  readModels();
+  for (auto &thread : threads)
+    thread.join();
+
+  for (std::size_t i = 0; i < models.size(); ++i)
+  {
+    if (!modelFiles[i].empty())
+      models[i].directory->modelFiles[models[i].name] = modelFiles[i];
+  }
+
+  std::unique_lock<std::shared_mutex> lock(this->dataPtr->mutex);
+  for (auto &[path, directory] : scanned)
+    this->dataPtr->Insert(path, std::move(directory));
+  return errors;
+}
+
+/////////////////////////////////////////////////
+sdf::Errors ModelIndex::Save(const std::string &_filename) const
+{
+  std::ofstream out(_filename);
+  if (!out)
+  {
+    return {{ErrorCode::FILE_READ,
+        "Unable to open model index file [" + _filename + "] for writing."}};
+  }
+
+  std::shared_lock<std::shared_mutex> lock(this->dataPtr->mutex);
+  out << kIndexHeader << "\n"
+      << "version\t" << this->dataPtr->version << "\n";
+  for (const auto &[path, directory] : this->dataPtr->directories)
+  {
+    out << "directory\t" << directory.modified.time_since_epoch().count()
+        << "\t" << path << "\n";
+    for (const std::string &name : directory.entries)
+    {
+      auto it = directory.modelFiles.find(name);
+      if (it == directory.modelFiles.end())
+        out << "entry\t" << name << "\n";
+      else
+        out << "model\t" << name << "\t" << it->second << "\n";
+    }
+  }
+
+  if (!out)
+  {
+    return {{ErrorCode::FILE_READ,
+        "Unable to write model index file [" + _filename + "]."}};
+  }
+  return {};
+}
+
+/////////////////////////////////////////////////
+sdf::Errors ModelIndex::Load(const std::string &_filename)
+{
+  std::ifstream in(_filename);
+  if (!in)
+  {
+    return {{ErrorCode::FILE_READ,
+        "Unable to open model index file [" + _filename + "]."}};
+  }
+
+  std::string line;
+  if (!std::getline(in, line) || line != kIndexHeader)
+  {
+    return {{ErrorCode::PARSING_ERROR,
+        "File [" + _filename + "] is not a model index."}};
+  }
+
+  const std::string versionLine = "version\t" + SDF::Version();
+  if (!std::getline(in, line) || line != versionLine)
+  {
+    return {{ErrorCode::PARSING_ERROR,
+        "Model index [" + _filename + "] was not saved for SDFormat version " +
+        SDF::Version() + "."}};
+  }
+
+  std::unordered_map<std::string, ModelIndexDirectory> directories;
+  ModelIndexDirectory *directory = nullptr;
+  int lineNumber = 2;
+  while (std::getline(in, line))
+  {
+    ++lineNumber;
+    const std::vector<std::string> fields = sdf::split(line, "\t");
+    if (fields.size() == 3 && fields[0] == "directory")
+    {
+      directory = &directories[fields[2]];
+      try
+      {
+        directory->modified = std::filesystem::file_time_type(
+            std::filesystem::file_time_type::duration(std::stoll(fields[1])));
+        continue;
+      }
+      catch (const std::exception &)
+      {
+      }
+    }
+    else if (directory && fields.size() == 2 && fields[0] == "entry")
+    {
+      directory->entries.insert(fields[1]);
+      continue;
+    }
+    else if (directory && fields.size() == 3 && fields[0] == "model")
+    {
+      directory->entries.insert(fields[1]);
+      directory->modelFiles[fields[1]] = fields[2];
+      continue;
+    }
+
+    return {{ErrorCode::PARSING_ERROR,
+        "Invalid line in model index [" + _filename + "]", _filename,
+        lineNumber}};
+  }
+
+  std::unique_lock<std::shared_mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->version = SDF::Version();
+  this->dataPtr->directories.clear();
+  this->dataPtr->modelFiles.clear();
+  for (auto &[path, loaded] : directories)
+    this->dataPtr->Insert(path, std::move(loaded));
+  return {};
+}
+
+/////////////////////////////////////////////////
+void ModelIndex::Clear()
+{
+  std::unique_lock<std::shared_mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->version = SDF::Version();
+  this->dataPtr->directories.clear();
+  this->dataPtr->modelFiles.clear();
+}
+
+/////////////////////////////////////////////////
+bool ModelIndex::IsIndexed(const std::string &_directory) const
+{
+  std::shared_lock<std::shared_mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->directories.count(_directory) > 0;
+}
+
+/////////////////////////////////////////////////
+bool ModelIndex::Contains(const std::string &_directory,
+                          const std::string &_name) const
+{
+  std::shared_lock<std::shared_mutex> lock(this->dataPtr->mutex);
+  auto it = this->dataPtr->directories.find(_directory);
+  return it != this->dataPtr->directories.end() &&
+         it->second.entries.count(_name) > 0;
+}
+
+/////////////////////////////////////////////////
+std::string ModelIndex::ModelFile(const std::string &_modelDirectory) const
+{
+  std::shared_lock<std::shared_mutex> lock(this->dataPtr->mutex);
+  if (this->dataPtr->version != SDF::Version())
+    return std::string();
+
+  auto it = this->dataPtr->modelFiles.find(_modelDirectory);
+  return it == this->dataPtr->modelFiles.end() ? std::string() : it->second;
+}
+
+/////////////////////////////////////////////////
+uint64_t ModelIndex::DirectoryCount() const
+{
+  std::shared_lock<std::shared_mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->directories.size();
+}
+
+/////////////////////////////////////////////////
+uint64_t ModelIndex::ModelCount() const
+{
+  std::shared_lock<std::shared_mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->modelFiles.size();
+}
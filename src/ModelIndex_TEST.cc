@@ -0,0 +1,183 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/Filesystem.hh"
+#include "sdf/ModelIndex.hh"
+#include "sdf/ParserConfig.hh"
+#include "sdf/SDFImpl.hh"
+
+/////////////////////////////////////////////////
+/// \brief Write a model directory.
+/// \param[in] _dir Directory of the model.
+/// \param[in] _configName Name of the model configuration file.
+static void writeModel(const std::filesystem::path &_dir,
+                       const std::string &_configName)
+{
+  std::filesystem::create_directories(_dir);
+  std::ofstream(_dir / _configName)
+    << "<?xml version='1.0'?>\n"
+    << "<model>\n"
+    << "  <name>model</name>\n"
+    << "  <sdf version='1.9'>model.sdf</sdf>\n"
+    << "</model>\n";
+  std::ofstream(_dir / "model.sdf") << "<sdf version='1.9'/>";
+}
+
+/////////////////////////////////////////////////
+/// \brief Create a directory of models in the temporary directory.
+/// \param[in] _name Name of the directory.
+/// \return Path of the directory.
+static std::string modelDirectory(const std::string &_name)
+{
+  const std::filesystem::path root =
+      std::filesystem::temp_directory_path() / _name;
+  std::filesystem::remove_all(root);
+  writeModel(root / "box", "model.config");
+  writeModel(root / "legacy", "manifest.xml");
+  std::filesystem::create_directories(root / "meshes");
+  std::ofstream(root / "readme.txt") << "models";
+  return root.string();
+}
+
+/////////////////////////////////////////////////
+TEST(ModelIndex, Build)
+{
+  const std::string root = modelDirectory("sdf_model_index_build");
+  sdf::ParserConfig config;
+  config.AddURIPath("model://", root);
+
+  sdf::ModelIndex index;
+  EXPECT_FALSE(index.IsIndexed(root));
+  sdf::Errors errors = index.Build(config, 4);
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  EXPECT_TRUE(index.IsIndexed(root));
+  EXPECT_GE(index.DirectoryCount(), 1u);
+  EXPECT_TRUE(index.Contains(root, "box"));
+  EXPECT_TRUE(index.Contains(root, "legacy"));
+  EXPECT_TRUE(index.Contains(root, "meshes"));
+  EXPECT_TRUE(index.Contains(root, "readme.txt"));
+  EXPECT_FALSE(index.Contains(root, "missing"));
+
+  const std::string box = sdf::filesystem::append(root, "box");
+  EXPECT_EQ(sdf::filesystem::append(box, "model.sdf"), index.ModelFile(box));
+
+  // Models whose configuration has warnings are read when they are included
+  EXPECT_TRUE(
+      index.ModelFile(sdf::filesystem::append(root, "legacy")).empty());
+  EXPECT_TRUE(
+      index.ModelFile(sdf::filesystem::append(root, "meshes")).empty());
+
+  // Directories are scanned again once their modification time changes
+  writeModel(std::filesystem::path(root) / "sphere", "model.config");
+  std::filesystem::last_write_time(root,
+      std::filesystem::last_write_time(root) + std::chrono::hours(1));
+  EXPECT_FALSE(index.Contains(root, "sphere"));
+  errors = index.Build(config);
+  EXPECT_TRUE(errors.empty()) << errors;
+  EXPECT_TRUE(index.Contains(root, "sphere"));
+  EXPECT_FALSE(
+      index.ModelFile(sdf::filesystem::append(root, "sphere")).empty());
+
+  index.Clear();
+  EXPECT_EQ(0u, index.DirectoryCount());
+  EXPECT_EQ(0u, index.ModelCount());
+  EXPECT_TRUE(index.ModelFile(box).empty());
+
+  std::filesystem::remove_all(root);
+}
+
+/////////////////////////////////////////////////
+TEST(ModelIndex, SaveLoad)
+{
+  const std::string root = modelDirectory("sdf_model_index_save");
+  const std::string file =
+      (std::filesystem::temp_directory_path() / "sdf_model_index.txt").string();
+  sdf::ParserConfig config;
+  config.AddURIPath("model://", root);
+
+  sdf::ModelIndex index;
+  EXPECT_TRUE(index.Build(config).empty());
+  sdf::Errors errors = index.Save(file);
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  sdf::ModelIndex loaded;
+  errors = loaded.Load(file);
+  EXPECT_TRUE(errors.empty()) << errors;
+  EXPECT_EQ(index.DirectoryCount(), loaded.DirectoryCount());
+  EXPECT_EQ(index.ModelCount(), loaded.ModelCount());
+  EXPECT_TRUE(loaded.Contains(root, "readme.txt"));
+  const std::string box = sdf::filesystem::append(root, "box");
+  EXPECT_EQ(index.ModelFile(box), loaded.ModelFile(box));
+
+  // Loaded directories whose modification time did not change are not
+  // scanned again
+  const auto modified = std::filesystem::last_write_time(root);
+  std::filesystem::remove(std::filesystem::path(root) / "readme.txt");
+  std::filesystem::last_write_time(root, modified);
+  sdf::ModelIndex reloaded;
+  EXPECT_TRUE(reloaded.Load(file).empty());
+  EXPECT_TRUE(reloaded.Build(config).empty());
+  EXPECT_TRUE(reloaded.Contains(root, "readme.txt"));
+
+  std::ofstream(file) << "not an index";
+  errors = loaded.Load(file);
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_EQ(sdf::ErrorCode::PARSING_ERROR, errors[0].Code());
+  EXPECT_TRUE(loaded.Contains(root, "box"));
+
+  errors = loaded.Load(file + ".missing");
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_EQ(sdf::ErrorCode::FILE_READ, errors[0].Code());
+
+  std::filesystem::remove(file);
+  std::filesystem::remove_all(root);
+}
+
+/////////////////////////////////////////////////
+TEST(ModelIndex, FindFile)
+{
+  const std::string root = modelDirectory("sdf_model_index_find");
+  sdf::ParserConfig config;
+  config.AddURIPath("model://", root);
+
+  auto index = std::make_shared<sdf::ModelIndex>();
+  EXPECT_TRUE(index->Build(config).empty());
+  config.SetModelIndex(index);
+  EXPECT_EQ(index, config.ModelIndex());
+
+  const std::string box = sdf::filesystem::append(root, "box");
+  EXPECT_EQ(box, sdf::findFile("model://box", true, false, config));
+  EXPECT_EQ(sdf::filesystem::append(box, "model.sdf"),
+            sdf::findFile("model://box/model.sdf", true, false, config));
+  EXPECT_TRUE(sdf::findFile("model://sdf_model_index_missing", true, false,
+                            config).empty());
+
+  // Entries of indexed directories are found without probing the filesystem
+  std::filesystem::remove_all(box);
+  EXPECT_EQ(box, sdf::findFile("model://box", true, false, config));
+
+  std::filesystem::remove_all(root);
+}
@@ -23,14 +23,19 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <limits>
+#include <string_view>
+#include <type_traits>
 
-#include <locale.h>
 #include <math.h>
 
 #include "sdf/Assert.hh"
 #include "sdf/Param.hh"
 #include "sdf/Types.hh"
 #include "sdf/Element.hh"
+#include "DocumentArena.hh"
+#include "StringPool.hh"
+#include "ValueParsing.hh"
 
 using namespace sdf;
 
@@ -355,7 +360,7 @@ void Param::Update(sdf::Errors &_errors)
   {
     try
     {
-      std::any newValue = this->dataPtr->updateFunc();
+      std::any newValue = (*this->dataPtr->updateFunc)();
       std::visit([&](auto &&arg)
         {
           using T = std::decay_t<decltype(arg)>;
@@ -366,7 +371,7 @@ void Param::Update(sdf::Errors &_errors)
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
           "Unable to set value using Update for key["
-          + this->dataPtr->key + "]"});
+          + *this->dataPtr->descriptor->key + "]"});
     }
   }
   else
@@ -393,7 +398,7 @@ std::string Param::GetAsString(sdf::Errors &_errors,
   std::string valueStr;
   if (this->GetSet() &&
       this->dataPtr->StringFromValueImpl(_config,
-                                         this->dataPtr->typeName,
+                                         this->dataPtr->descriptor->valueType,
                                          this->dataPtr->value,
                                          valueStr,
                                          _errors))
@@ -421,8 +426,8 @@ std::string Param::GetDefaultAsString(sdf::Errors &_errors,
   std::string defaultStr;
   if (this->dataPtr->StringFromValueImpl(
         _config,
-        this->dataPtr->typeName,
-        this->dataPtr->defaultValue,
+        this->dataPtr->descriptor->valueType,
+        this->dataPtr->descriptor->defaultValue,
         defaultStr,
         _errors))
   {
@@ -434,7 +439,8 @@ std::string Param::GetDefaultAsString(sdf::Errors &_errors,
       "using ParamStreamer instead."});
 
   StringStreamClassicLocale ss;
-  ss << ParamStreamer{ this->dataPtr->defaultValue, _config.OutPrecision() };
+  ss << ParamStreamer{ this->dataPtr->descriptor->defaultValue,
+                       _config.OutPrecision() };
   return ss.str();
 }
 
@@ -454,12 +460,13 @@ std::optional<std::string> Param::GetMinValueAsString(
     sdf::Errors &_errors,
     const PrintConfig &_config) const
 {
-  if (this->dataPtr->minValue.has_value())
+  const ParamDescriptor &desc = *this->dataPtr->descriptor;
+  if (desc.minValue.has_value())
   {
     std::string valueStr;
     if (!this->dataPtr->StringFromValueImpl(_config,
-                                            this->dataPtr->typeName,
-                                            this->dataPtr->minValue.value(),
+                                            desc.valueType,
+                                            desc.minValue.value(),
                                             valueStr,
                                             _errors))
     {
@@ -489,12 +496,13 @@ std::optional<std::string> Param::GetMaxValueAsString(
     sdf::Errors &_errors,
     const PrintConfig &_config) const
 {
-  if (this->dataPtr->maxValue.has_value())
+  const ParamDescriptor &desc = *this->dataPtr->descriptor;
+  if (desc.maxValue.has_value())
   {
     std::string valueStr;
     if (!this->dataPtr->StringFromValueImpl(_config,
-                                            this->dataPtr->typeName,
-                                            this->dataPtr->maxValue.value(),
+                                            desc.valueType,
+                                            desc.maxValue.value(),
                                             valueStr,
                                             _errors))
     {
@@ -534,6 +542,81 @@ bool ParseUsingStringStream(const std::string &_input, const std::string &_key,
   return true;
 }
 
+//////////////////////////////////////////////////
+/// \brief Read whitespace separated numbers from the start of a string the
+/// way std::istream extraction would, but without allocating. Characters
+/// after the last number are ignored.
+/// \param[in] _input Input string.
+/// \param[out] _values The parsed values.
+/// \return True if all values were read.
+template <typename T, std::size_t N>
+bool ScanNumbers(std::string_view _input, std::array<T, N> &_values)
+{
+  for (T &value : _values)
+  {
+    const std::size_t begin = _input.find_first_not_of(" \t\n\v\f\r");
+    if (begin == std::string_view::npos)
+      return false;
+    _input.remove_prefix(begin);
+
+    std::size_t length = 0;
+    ParseNumberResult result;
+    if constexpr (std::is_same_v<T, double>)
+    {
+      // Streams do not read infinity or NaN.
+      result = parseReal(_input, false, value, length);
+      if (result == ParseNumberResult::OK && !std::isfinite(value))
+        return false;
+    }
+    else if constexpr (std::is_same_v<T, int>)
+    {
+      result = parseInt(_input, 10, value, length);
+    }
+    else
+    {
+      result = parseUnsigned(_input, 10, std::numeric_limits<T>::max(),
+                             value, length);
+    }
+
+    if (result != ParseNumberResult::OK)
+      return false;
+    _input.remove_prefix(length);
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// \brief Helper function for Param::ValueFromString for types made of a
+/// fixed number of numbers, such as vectors. The numbers are read the same
+/// way as ParseUsingStringStream would read them, without allocating.
+/// \param[in] _input Input string.
+/// \param[in] _key Key of the parameter, used for error message.
+/// \param[out] _value This will be set with the parsed value.
+/// \param[out] _errors Vector of errors.
+/// \return True if parsing succeeded.
+template <typename T, typename Scalar, std::size_t N>
+bool ParseNumbers(std::string_view _input, const std::string &_key,
+                  ParamPrivate::ParamVariant &_value,
+                  sdf::Errors &_errors)
+{
+  std::array<Scalar, N> values;
+  if (!ScanNumbers(_input, values))
+  {
+    _errors.push_back({ErrorCode::PARAMETER_ERROR,
+        "Unknown error. Unable to set value [" + std::string(_input)
+        + " ] for key[" + _key + "]"});
+    return false;
+  }
+
+  if constexpr (N == 1)
+    _value = T(values[0]);
+  else if constexpr (N == 2)
+    _value = T(values[0], values[1]);
+  else
+    _value = T(values[0], values[1], values[2]);
+  return true;
+}
+
 //////////////////////////////////////////////////
 /// \brief Helper function for Param::ValueFromString for parsing colors
 /// This checks the color components specified in _input are rgb or rgba
@@ -544,41 +627,42 @@ bool ParseUsingStringStream(const std::string &_input, const std::string &_key,
 /// \param[out] _value This will be set with the parsed value.
 /// \param[out] _errors Vector of errors.
 /// \return True if parsing colors succeeded.
-bool ParseColorUsingStringStream(const std::string &_input,
+bool ParseColor(std::string_view _input,
     const std::string &_key, ParamPrivate::ParamVariant &_value,
     sdf::Errors &_errors)
 {
-  StringStreamClassicLocale ss(_input);
-  std::string token;
-  std::vector<float> colors;
+  std::string_view rest = _input;
+  std::string_view token;
+  std::array<float, 4> colors;
+  std::size_t colorSize = 0;
   float c;  // r,g,b,a values
   bool isValidColor = true;
-  while (ss >> token)
+  while (nextToken(rest, token))
   {
-    try
-    {
-      c = std::stof(token);
-      colors.push_back(c);
-    }
-    // Catch invalid argument exception from std::stof
-    catch(std::invalid_argument &)
+    std::size_t length = 0;
+    const ParseNumberResult result = parseReal(token, c, length);
+    if (result == ParseNumberResult::INVALID_ARGUMENT)
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
-          "Invalid argument. Unable to set value [" + token
+          "Invalid argument. Unable to set value [" + std::string(token)
           + "] for key [" + _key + "]."});
       isValidColor = false;
       break;
     }
-    // Catch out of range exception from std::stof
-    catch(std::out_of_range &)
+    else if (result == ParseNumberResult::OUT_OF_RANGE)
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
-          "Out of range. Unable to set value [" + token
+          "Out of range. Unable to set value [" + std::string(token)
           + "] for key [" + _key + "]."});
       isValidColor = false;
       break;
     }
 
+    // Extra values are counted, so that they are reported below.
+    if (colorSize < colors.size())
+      colors[colorSize] = c;
+    ++colorSize;
+
     if (c < 0.0f || c > 1.0f)
     {
       isValidColor = false;
@@ -586,11 +670,15 @@ bool ParseColorUsingStringStream(const std::string &_input,
     }
   }
 
-  size_t colorSize = colors.size();
   if (isValidColor && colorSize == 3u)
-    colors.push_back(1.0f);
+  {
+    colors[3] = 1.0f;
+    colorSize = 4u;
+  }
   else if (colorSize != 4u)
+  {
     isValidColor = false;
+  }
 
   if (isValidColor)
   {
@@ -599,7 +687,8 @@ bool ParseColorUsingStringStream(const std::string &_input,
   else
   {
     _errors.push_back({ErrorCode::PARAMETER_ERROR,
-        "The value <" + _key + ">" + _input + "</" + _key + "> is invalid."});
+        "The value <" + _key + ">" + std::string(_input) + "</" + _key
+        + "> is invalid."});
   }
 
   return isValidColor;
@@ -616,7 +705,7 @@ bool ParseColorUsingStringStream(const std::string &_input,
 /// \param[out] _value This will be set with the parsed value.
 /// \param[out] _errors Vector of errors.
 /// \return True if parsing pose succeeded.
-bool ParsePoseUsingStringStream(const std::string &_input,
+bool ParsePose(std::string_view _input,
     const std::string &_key, const Param_V &_attributes,
     ParamPrivate::ParamVariant &_value,
     sdf::Errors &_errors)
@@ -632,7 +721,7 @@ bool ParsePoseUsingStringStream(const std::string &_input,
 
   for (const auto &p : _attributes)
   {
-    const std::string key = p->GetKey();
+    const std::string &key = p->GetKey();
 
     if (key == "degrees")
     {
@@ -646,7 +735,9 @@ bool ParsePoseUsingStringStream(const std::string &_input,
     }
     else if (key == "rotation_format")
     {
-      rotationFormat = p->GetAsString(_errors);
+      // Get copies the stored string instead of printing it, like
+      // GetAsString would.
+      p->Get<std::string>(rotationFormat, _errors);
 
       if (rotationFormat == "euler_rpy")
       {
@@ -681,32 +772,28 @@ bool ParsePoseUsingStringStream(const std::string &_input,
     return true;
   }
 
-  StringStreamClassicLocale ss(_input);
-  std::string token;
+  std::string_view rest = _input;
+  std::string_view token;
   std::array<double, 7> values;
   std::size_t valueIndex = 0;
   double v;
   bool isValidPose = true;
-  while (ss >> token)
+  while (nextToken(rest, token))
   {
-    try
-    {
-      v = std::stod(token);
-    }
-    // Catch invalid argument exception from std::stod
-    catch(std::invalid_argument &)
+    std::size_t length = 0;
+    const ParseNumberResult result = parseReal(token, true, v, length);
+    if (result == ParseNumberResult::INVALID_ARGUMENT)
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
-          "Invalid argument. Unable to set value [" + _input
+          "Invalid argument. Unable to set value [" + std::string(_input)
           + "] for key [" + _key + "]."});
       isValidPose = false;
       break;
     }
-    // Catch out of range exception from std::stod
-    catch(std::out_of_range &)
+    else if (result == ParseNumberResult::OUT_OF_RANGE)
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
-          "Out of range. Unable to set value [" + token
+          "Out of range. Unable to set value [" + std::string(token)
           + "] for key [" + _key + "]."});
       isValidPose = false;
       break;
@@ -725,7 +812,8 @@ bool ParsePoseUsingStringStream(const std::string &_input,
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
           "The value for //pose[@rotation_format='" + rotationFormat
           + "'] must have " + std::to_string(desiredSize)
-          + " values, but more than that were found in '" + _input + "'."});
+          + " values, but more than that were found in '"
+          + std::string(_input) + "'."});
       isValidPose = false;
       break;
     }
@@ -742,7 +830,7 @@ bool ParsePoseUsingStringStream(const std::string &_input,
         "The value for //pose[@rotation_format='" + rotationFormat
         + "'] must have " + std::to_string(desiredSize) + " values, but "
         + std::to_string(valueIndex) + " were found instead in '"
-        + _input + "'."});
+        + std::string(_input) + "'."});
     return false;
   }
 
@@ -768,48 +856,91 @@ bool ParsePoseUsingStringStream(const std::string &_input,
   return true;
 }
 
+//////////////////////////////////////////////////
+/// \brief Report a number that could not be parsed, with the same messages
+/// as the exceptions of std::stoi and std::stod used to produce.
+/// \param[in] _result Why the number could not be parsed.
+/// \param[in] _valueStr The value as a string.
+/// \param[in] _key Key of the parameter, used for error message.
+/// \param[out] _errors Vector of errors.
+void ReportNumberError(ParseNumberResult _result, std::string_view _valueStr,
+                       const std::string &_key, sdf::Errors &_errors)
+{
+  if (_result == ParseNumberResult::INVALID_ARGUMENT)
+  {
+    _errors.push_back({ErrorCode::PARAMETER_ERROR,
+        "Invalid argument. Unable to set value ["
+        + std::string(_valueStr) + "] for key["
+        + _key + "]."});
+  }
+  else
+  {
+    _errors.push_back({ErrorCode::PARAMETER_ERROR,
+        "Out of range. Unable to set value ["
+        + std::string(_valueStr) + " ] for key["
+        + _key + "]."});
+  }
+}
+
+//////////////////////////////////////////////////
+void *ParamPrivate::operator new(std::size_t _size)
+{
+  return documentArenaNew(_size);
+}
+
+//////////////////////////////////////////////////
+void ParamPrivate::operator delete(void *_ptr) noexcept
+{
+  documentArenaDelete(_ptr);
+}
+
 //////////////////////////////////////////////////
 void ParamPrivate::Init(const std::string &_key, const std::string &_typeName,
              const std::string &_default, bool _required,
              sdf::Errors &_errors,
              const std::string &_description)
 {
-  this->key = _key;
-  this->required = _required;
-  this->typeName = _typeName;
-  this->description = _description;
+  this->Init(_key, _typeName, _default, _required, "", "", _errors,
+             _description);
+}
+
+//////////////////////////////////////////////////
+void ParamPrivate::Init(const std::string &_key, const std::string &_typeName,
+             const std::string &_default, bool _required,
+             const std::string &_minValue, const std::string &_maxValue,
+             sdf::Errors &_errors,
+             const std::string &_description)
+{
+  auto desc = std::make_shared<ParamDescriptor>();
+  desc->key = InternString(_key);
+  desc->required = _required;
+  desc->typeName = InternString(_typeName);
+  desc->valueType = ValueTypeFromString(_typeName);
+  desc->description = _description;
+  desc->defaultStrValue = _default;
+  this->descriptor = desc;
   this->set = false;
   this->ignoreParentAttributes = false;
-  this->defaultStrValue = _default;
+  this->strValue = std::nullopt;
 
   if(!(this->ValueFromStringImpl(
-          this->typeName,
+          desc->valueType,
           _default,
-          this->defaultValue,
+          desc->defaultValue,
           _errors)))
   {
     _errors.push_back({ErrorCode::PARAMETER_ERROR,
                      "Invalid parameter"});
     return;
   }
-  this->value = this->defaultValue;
-  this->strValue = std::nullopt;
-}
+  this->value = desc->defaultValue;
 
-//////////////////////////////////////////////////
-void ParamPrivate::Init(const std::string &_key, const std::string &_typeName,
-             const std::string &_default, bool _required,
-             const std::string &_minValue, const std::string &_maxValue,
-             sdf::Errors &_errors,
-             const std::string &_description)
-{
-  this->Init(_key, _typeName, _default, _required, _errors, _description);
   if (!_minValue.empty())
   {
     if (!(this->ValueFromStringImpl(
-            this->typeName,
+            desc->valueType,
             _minValue,
-            this->minValue.emplace(),
+            desc->minValue.emplace(),
             _errors)))
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
@@ -821,9 +952,9 @@ void ParamPrivate::Init(const std::string &_key, const std::string &_typeName,
   if (!_maxValue.empty())
   {
     if(!(this->ValueFromStringImpl(
-            this->typeName,
+            desc->valueType,
             _maxValue,
-            this->maxValue.emplace(),
+            desc->maxValue.emplace(),
             _errors)))
 
     {
@@ -834,52 +965,109 @@ void ParamPrivate::Init(const std::string &_key, const std::string &_typeName,
   }
 }
 
+//////////////////////////////////////////////////
+ParamPrivate::ValueType ParamPrivate::ValueTypeFromString(
+    const std::string &_typeName)
+{
+  if (_typeName == "bool")
+    return ValueType::BOOL;
+  else if (_typeName == "char")
+    return ValueType::CHAR;
+  else if (_typeName == "std::string" || _typeName == "string")
+    return ValueType::STRING;
+  else if (_typeName == "int")
+    return ValueType::INT;
+  else if (_typeName == "uint64_t")
+    return ValueType::UINT64;
+  else if (_typeName == "unsigned int")
+    return ValueType::UNSIGNED_INT;
+  else if (_typeName == "double")
+    return ValueType::DOUBLE;
+  else if (_typeName == "float")
+    return ValueType::FLOAT;
+  else if (_typeName == "sdf::Time" || _typeName == "time")
+    return ValueType::TIME;
+  else if (_typeName == "gz::math::Angle" || _typeName == "angle")
+    return ValueType::ANGLE;
+  else if (_typeName == "gz::math::Color" || _typeName == "color")
+    return ValueType::COLOR;
+  else if (_typeName == "gz::math::Vector2i" || _typeName == "vector2i")
+    return ValueType::VECTOR2I;
+  else if (_typeName == "gz::math::Vector2d" || _typeName == "vector2d")
+    return ValueType::VECTOR2D;
+  else if (_typeName == "gz::math::Vector3d" || _typeName == "vector3")
+    return ValueType::VECTOR3D;
+  else if (_typeName == "gz::math::Quaterniond" || _typeName == "quaternion")
+    return ValueType::QUATERNION;
+  else if (_typeName == "gz::math::Pose3d" || _typeName == "pose" ||
+           _typeName == "Pose")
+    return ValueType::POSE;
+  return ValueType::UNKNOWN;
+}
+
 //////////////////////////////////////////////////
 bool ParamPrivate::ValueFromStringImpl(const std::string &_typeName,
                                        const std::string &_valueStr,
                                        ParamVariant &_valueToSet,
                                        sdf::Errors &_errors) const
 {
-  // Under some circumstances, latin locales (es_ES or pt_BR) will return a
-  // comma for decimal position instead of a dot, making the conversion
-  // to fail. See bug #60 for more information. Force to use always C
-  setlocale(LC_NUMERIC, "C");
-  std::string trimmed = sdf::trim(_valueStr);
-  std::string tmp(trimmed);
-  std::string lowerTmp = lowercase(trimmed);
+  const ValueType type = ValueTypeFromString(_typeName);
+  if (type == ValueType::UNKNOWN)
+  {
+    _errors.push_back({ErrorCode::UNKNOWN_PARAMETER_TYPE,
+        "Unknown parameter type[" + _typeName + "]"});
+    return false;
+  }
+  return this->ValueFromStringImpl(type, _valueStr, _valueToSet, _errors);
+}
+
+//////////////////////////////////////////////////
+bool ParamPrivate::ValueFromStringImpl(ValueType _type,
+                                       std::string_view _valueStr,
+                                       ParamVariant &_valueToSet,
+                                       sdf::Errors &_errors) const
+{
+  // Values are parsed without consulting the global C or C++ locale, so
+  // latin locales (es_ES or pt_BR) that use a comma as decimal separator do
+  // not affect parsing. See bug #60 for more information.
+  const std::string_view trimmed = trimView(_valueStr);
+  std::string_view tmp = trimmed;
 
   // "true" and "false" doesn't work properly (except for string)
-  if (_typeName != "string" && _typeName != "std::string")
+  if (_type != ValueType::STRING)
   {
-    if (lowerTmp == "true")
+    if (equalsIgnoreCase(trimmed, "true"))
     {
       tmp = "1";
     }
-    else if (lowerTmp == "false")
+    else if (equalsIgnoreCase(trimmed, "false"))
     {
       tmp = "0";
     }
   }
 
-  bool isHex = lowerTmp.compare(0, 2, "0x") == 0;
+  bool isHex = trimmed.size() >= 2 && trimmed[0] == '0' &&
+      (trimmed[1] == 'x' || trimmed[1] == 'X');
 
-  try
+  // Integers and scalar floating point values are parsed with the same
+  // rules as std::stoi, std::stoul, std::stod and std::stof, without
+  // allocating or depending on the locale.
+  int numericBase = 10;
+  if (isHex)
   {
-    // Try to use stoi and stoul for integers, and
-    // stof and stod for scalar floating point values.
-    int numericBase = 10;
-    if (isHex)
-    {
-      numericBase = 16;
-    }
+    numericBase = 16;
+  }
 
-    if (_typeName == "bool")
-    {
-      if (lowerTmp == "true" || lowerTmp == "1")
+  ParseNumberResult result = ParseNumberResult::OK;
+  std::size_t length = 0;
+  switch (_type)
+  {
+    case ValueType::BOOL:
+      if (equalsIgnoreCase(trimmed, "true") || trimmed == "1")
       {
         _valueToSet = true;
       }
-      else if (lowerTmp == "false" || lowerTmp == "0")
+      else if (equalsIgnoreCase(trimmed, "false") || trimmed == "0")
       {
         _valueToSet = false;
       }
@@ -889,115 +1077,90 @@ bool ParamPrivate::ValueFromStringImpl(const std::string &_typeName,
             "Invalid boolean value"});
         return false;
       }
-    }
-    else if (_typeName == "char")
-    {
-      _valueToSet = tmp[0];
-    }
-    else if (_typeName == "std::string" ||
-             _typeName == "string")
-    {
-      _valueToSet = tmp;
-    }
-    else if (_typeName == "int")
-    {
-      _valueToSet = std::stoi(tmp, nullptr, numericBase);
-    }
-    else if (_typeName == "uint64_t")
-    {
-      return ParseUsingStringStream<std::uint64_t>(tmp, this->key,
-                                                   _valueToSet, _errors);
-    }
-    else if (_typeName == "unsigned int")
-    {
-      _valueToSet = static_cast<unsigned int>(
-          std::stoul(tmp, nullptr, numericBase));
-    }
-    else if (_typeName == "double")
-    {
-      _valueToSet = std::stod(tmp);
-    }
-    else if (_typeName == "float")
-    {
-      _valueToSet = std::stof(tmp);
-    }
-    else if (_typeName == "sdf::Time" ||
-             _typeName == "time")
-    {
-      return ParseUsingStringStream<sdf::Time>(tmp, this->key,
-                                               _valueToSet, _errors);
-    }
-    else if (_typeName == "gz::math::Angle" ||
-             _typeName == "angle")
-    {
-      return ParseUsingStringStream<gz::math::Angle>(
-          tmp, this->key, _valueToSet, _errors);
-    }
-    else if (_typeName == "gz::math::Color" ||
-             _typeName == "color")
+      break;
+    case ValueType::CHAR:
+      _valueToSet = tmp.empty() ? '\0' : tmp[0];
+      break;
+    case ValueType::STRING:
+      _valueToSet = std::string(tmp);
+      break;
+    case ValueType::INT:
     {
-      return ParseColorUsingStringStream(tmp, this->key, _valueToSet, _errors);
+      int value = 0;
+      result = parseInt(tmp, numericBase, value, length);
+      if (result == ParseNumberResult::OK)
+        _valueToSet = value;
+      break;
     }
-    else if (_typeName == "gz::math::Vector2i" ||
-             _typeName == "vector2i")
-    {
-      return ParseUsingStringStream<gz::math::Vector2i>(
-          tmp, this->key, _valueToSet, _errors);
+    case ValueType::UINT64:
+      return ParseNumbers<std::uint64_t, std::uint64_t, 1>(
+          tmp, *this->descriptor->key, _valueToSet, _errors);
+    case ValueType::UNSIGNED_INT:
+    {
+      // Parsed as an unsigned long and then truncated, like std::stoul.
+      std::uint64_t value = 0;
+      result = parseUnsigned(tmp, numericBase,
+          std::numeric_limits<unsigned long>::max(), value, length);
+      if (result == ParseNumberResult::OK)
+        _valueToSet = static_cast<unsigned int>(value);
+      break;
     }
-    else if (_typeName == "gz::math::Vector2d" ||
-             _typeName == "vector2d")
+    case ValueType::DOUBLE:
     {
-      return ParseUsingStringStream<gz::math::Vector2d>(
-          tmp, this->key, _valueToSet, _errors);
+      double value = 0;
+      result = parseReal(tmp, true, value, length);
+      if (result == ParseNumberResult::OK)
+        _valueToSet = value;
+      break;
     }
-    else if (_typeName == "gz::math::Vector3d" ||
-             _typeName == "vector3")
+    case ValueType::FLOAT:
     {
-      return ParseUsingStringStream<gz::math::Vector3d>(
-          tmp, this->key, _valueToSet, _errors);
+      float value = 0;
+      result = parseReal(tmp, value, length);
+      if (result == ParseNumberResult::OK)
+        _valueToSet = value;
+      break;
     }
-    else if (_typeName == "gz::math::Pose3d" ||
-             _typeName == "pose" ||
-             _typeName == "Pose")
+    case ValueType::TIME:
+      return ParseUsingStringStream<sdf::Time>(
+          std::string(tmp), *this->descriptor->key, _valueToSet, _errors);
+    case ValueType::ANGLE:
+      return ParseNumbers<gz::math::Angle, double, 1>(
+          tmp, *this->descriptor->key, _valueToSet, _errors);
+    case ValueType::COLOR:
+      return ParseColor(tmp, *this->descriptor->key, _valueToSet, _errors);
+    case ValueType::VECTOR2I:
+      return ParseNumbers<gz::math::Vector2i, int, 2>(
+          tmp, *this->descriptor->key, _valueToSet, _errors);
+    case ValueType::VECTOR2D:
+      return ParseNumbers<gz::math::Vector2d, double, 2>(
+          tmp, *this->descriptor->key, _valueToSet, _errors);
+    case ValueType::VECTOR3D:
+      return ParseNumbers<gz::math::Vector3d, double, 3>(
+          tmp, *this->descriptor->key, _valueToSet, _errors);
+    case ValueType::POSE:
     {
       const ElementPtr p = this->parentElement.lock();
       if (!this->ignoreParentAttributes && p)
       {
-        return ParsePoseUsingStringStream(
-            tmp, this->key, p->GetAttributes(), _valueToSet, _errors);
+        return ParsePose(tmp, *this->descriptor->key, p->GetAttributes(),
+                         _valueToSet, _errors);
       }
-      return ParsePoseUsingStringStream(
-          tmp, this->key, {}, _valueToSet, _errors);
+      return ParsePose(tmp, *this->descriptor->key, {}, _valueToSet, _errors);
     }
-    else if (_typeName == "gz::math::Quaterniond" ||
-             _typeName == "quaternion")
-    {
+    case ValueType::QUATERNION:
       return ParseUsingStringStream<gz::math::Quaterniond>(
-          tmp, this->key, _valueToSet, _errors);
-    }
-    else
-    {
+          std::string(tmp), *this->descriptor->key, _valueToSet, _errors);
+    case ValueType::UNKNOWN:
+    default:
       _errors.push_back({ErrorCode::UNKNOWN_PARAMETER_TYPE,
-          "Unknown parameter type[" + _typeName + "]"});
+          "Unknown parameter type[" + *this->descriptor->typeName + "]"});
       return false;
-    }
-  }
-  // Catch invalid argument exception from std::stoi/stoul/stod/stof
-  catch(std::invalid_argument &)
-  {
-    _errors.push_back({ErrorCode::PARAMETER_ERROR,
-        "Invalid argument. Unable to set value ["
-        + _valueStr + "] for key["
-        + this->key + "]."});
-    return false;
   }
-  // Catch out of range exception from std::stoi/stoul/stod/stof
-  catch(std::out_of_range &)
+
+  if (result != ParseNumberResult::OK)
   {
-    _errors.push_back({ErrorCode::PARAMETER_ERROR,
-        "Out of range. Unable to set value ["
-        + _valueStr + " ] for key["
-        + this->key + "]."});
+    ReportNumberError(result, _valueStr, *this->descriptor->key, _errors);
     return false;
   }
 
@@ -1189,9 +1352,21 @@ bool ParamPrivate::StringFromValueImpl(
     const ParamVariant &_value,
     std::string &_valueStr,
     sdf::Errors &_errors) const
+{
+  return this->StringFromValueImpl(_config, ValueTypeFromString(_typeName),
+                                   _value, _valueStr, _errors);
+}
+
+/////////////////////////////////////////////////
+bool ParamPrivate::StringFromValueImpl(
+    const PrintConfig &_config,
+    ValueType _type,
+    const ParamVariant &_value,
+    std::string &_valueStr,
+    sdf::Errors &_errors) const
 {
   // This will be handled in a type specific manner
-  if (_typeName == "bool")
+  if (_type == ValueType::BOOL)
   {
     const bool *val = std::get_if<bool>(&_value);
     if (!val)
@@ -1204,9 +1379,7 @@ bool ParamPrivate::StringFromValueImpl(
     _valueStr = *val ? "true" : "false";
     return true;
   }
-  else if (_typeName == "gz::math::Pose3d" ||
-      _typeName == "pose" ||
-      _typeName == "Pose")
+  else if (_type == ValueType::POSE)
   {
     const ElementPtr p = this->parentElement.lock();
     if (!this->ignoreParentAttributes && p)
@@ -1242,9 +1415,9 @@ bool Param::SetFromString(const std::string &_value,
                           sdf::Errors &_errors)
 {
   this->dataPtr->ignoreParentAttributes = _ignoreParentAttributes;
-  std::string str = sdf::trim(_value.c_str());
+  const std::string_view str = trimView(_value);
 
-  if (str.empty() && this->dataPtr->required)
+  if (str.empty() && this->dataPtr->descriptor->required)
   {
     _errors.push_back({ErrorCode::PARAMETER_ERROR,
         "Empty string used when setting a required parameter. Key["
@@ -1253,13 +1426,13 @@ bool Param::SetFromString(const std::string &_value,
   }
   else if (str.empty())
   {
-    this->dataPtr->value = this->dataPtr->defaultValue;
+    this->dataPtr->value = this->dataPtr->descriptor->defaultValue;
     this->dataPtr->strValue = str;
     return true;
   }
 
   auto oldValue = this->dataPtr->value;
-  if (!this->dataPtr->ValueFromStringImpl(this->dataPtr->typeName,
+  if (!this->dataPtr->ValueFromStringImpl(this->dataPtr->descriptor->valueType,
                                           str,
                                           this->dataPtr->value,
                                           _errors))
@@ -1329,7 +1502,7 @@ bool Param::SetParentElement(ElementPtr _parentElement, sdf::Errors &_errors)
 //////////////////////////////////////////////////
 void Param::Reset()
 {
-  this->dataPtr->value = this->dataPtr->defaultValue;
+  this->dataPtr->value = this->dataPtr->descriptor->defaultValue;
   this->dataPtr->strValue = std::nullopt;
   this->dataPtr->set = false;
 }
@@ -1352,13 +1525,20 @@ bool Param::Reparse(sdf::Errors &_errors)
   {
     strToReparse = this->dataPtr->strValue.value();
   }
+  // A value set directly from its own type ignores parent attributes, so
+  // there is nothing to reparse.
+  else if (this->dataPtr->set)
+  {
+    return true;
+  }
   // A default PrintConfig can be used here, as Reparse() is not called in the
   // code path from the 'gz sdf -p' command.
-  else if (!this->dataPtr->StringFromValueImpl(PrintConfig(),
-                                               this->dataPtr->typeName,
-                                               this->dataPtr->defaultValue,
-                                               strToReparse,
-                                               _errors))
+  else if (!this->dataPtr->StringFromValueImpl(
+               PrintConfig(),
+               this->dataPtr->descriptor->valueType,
+               this->dataPtr->descriptor->defaultValue,
+               strToReparse,
+               _errors))
   {
     _errors.push_back({ErrorCode::PARAMETER_ERROR,
         "Failed to obtain string from default value during reparsing."});
@@ -1366,7 +1546,8 @@ bool Param::Reparse(sdf::Errors &_errors)
   }
 
   if (!this->dataPtr->ValueFromStringImpl(
-      this->dataPtr->typeName, strToReparse, this->dataPtr->value, _errors))
+      this->dataPtr->descriptor->valueType, strToReparse, this->dataPtr->value,
+      _errors))
   {
     if (const auto parentElement = this->dataPtr->parentElement.lock())
     {
@@ -1391,7 +1572,7 @@ bool Param::Reparse(sdf::Errors &_errors)
   // should be, so if strToReparse is empty, assign the correct default value.
   if (strToReparse.empty())
   {
-    this->dataPtr->value = this->dataPtr->defaultValue;
+    this->dataPtr->value = this->dataPtr->descriptor->defaultValue;
   }
   return true;
 }
@@ -1399,37 +1580,40 @@ bool Param::Reparse(sdf::Errors &_errors)
 //////////////////////////////////////////////////
 ParamPtr Param::Clone() const
 {
-  return std::make_shared<Param>(*this);
+  return makeDocumentShared<Param>(*this);
 }
 
 //////////////////////////////////////////////////
 const std::string &Param::GetTypeName() const
 {
-  return this->dataPtr->typeName;
+  return *this->dataPtr->descriptor->typeName;
 }
 
 /////////////////////////////////////////////////
 void Param::SetDescription(const std::string &_desc)
 {
-  this->dataPtr->description = _desc;
+  // The descriptor may be shared with other parameters, so it is replaced.
+  auto desc = std::make_shared<ParamDescriptor>(*this->dataPtr->descriptor);
+  desc->description = _desc;
+  this->dataPtr->descriptor = std::move(desc);
 }
 
 /////////////////////////////////////////////////
 std::string Param::GetDescription() const
 {
-  return this->dataPtr->description;
+  return this->dataPtr->descriptor->description;
 }
 
 /////////////////////////////////////////////////
 const std::string &Param::GetKey() const
 {
-  return this->dataPtr->key;
+  return *this->dataPtr->descriptor->key;
 }
 
 /////////////////////////////////////////////////
 bool Param::GetRequired() const
 {
-  return this->dataPtr->required;
+  return this->dataPtr->descriptor->required;
 }
 
 /////////////////////////////////////////////////
@@ -1458,6 +1642,13 @@ bool Param::ValidateValue() const
 /////////////////////////////////////////////////
 bool Param::ValidateValue(sdf::Errors &_errors) const
 {
+  // Most parameters have no range, so skip visiting the value entirely.
+  if (!this->dataPtr->descriptor->minValue.has_value() &&
+      !this->dataPtr->descriptor->maxValue.has_value())
+  {
+    return true;
+  }
+
   return std::visit(
       [this, &_errors](const auto &_val) -> bool
       {
@@ -1466,9 +1657,9 @@ bool Param::ValidateValue(sdf::Errors &_errors) const
         // cppcheck-suppress unmatchedSuppression
         if constexpr (std::is_scalar_v<T>)
         {
-          if (this->dataPtr->minValue.has_value())
+          if (this->dataPtr->descriptor->minValue.has_value())
           {
-            if (_val < std::get<T>(*this->dataPtr->minValue))
+            if (_val < std::get<T>(*this->dataPtr->descriptor->minValue))
             {
               std::ostringstream oss;
               oss << "The value [" << _val
@@ -1479,9 +1670,9 @@ bool Param::ValidateValue(sdf::Errors &_errors) const
               return false;
             }
           }
-          if (this->dataPtr->maxValue.has_value())
+          if (this->dataPtr->descriptor->maxValue.has_value())
           {
-            if (_val > std::get<T>(*this->dataPtr->maxValue))
+            if (_val > std::get<T>(*this->dataPtr->descriptor->maxValue))
             {
               std::ostringstream oss;
               oss << "The value [" << _val
@@ -306,16 +306,14 @@ ElementPtr getElementByName(const ElementPtr _elem,
   ElementPtr elem = _elem->GetElement(elemName);
   if (_xml->Attribute("name"))
   {
-    while (elem != nullptr)
+    for (const auto &child : _elem->Children(elemName))
     {
-      if (elem->HasAttribute("name") &&
-          elem->Get<std::string>("name")
+      if (child->HasAttribute("name") &&
+          child->Get<std::string>("name")
             == std::string(_xml->Attribute("name")))
       {
-        return elem;
+        return child;
       }
-
-      elem = elem->GetNextElement(elemName);
     }
 
     // if reached here then element was not found
@@ -461,7 +459,8 @@ void handleIndividualChildActions(const ParserConfig &_config,
       continue;
     }
 
-    ElementPtr elemChild = elemDesc->GetElementDescription(elemName);
+    // Descriptions are shared schema nodes, so read into a copy
+    ElementPtr elemChild = elemDesc->GetElementDescription(elemName)->Clone();
 
     if (!xmlToSdf(_config, _source, xmlChild, elemChild, _errors))
     {
@@ -18,6 +18,7 @@
 #include <any>
 #include <cstdint>
 #include <limits>
+#include <string>
 
 #include <gtest/gtest.h>
 
@@ -553,6 +554,90 @@ TEST(Param, SetTemplate)
   EXPECT_DOUBLE_EQ(value, 25.456);
 }
 
+////////////////////////////////////////////////////
+TEST(Param, SetTemplateStoresValue)
+{
+  // Values of the parameter's type are stored without a round trip through
+  // their string form, so nothing is lost.
+  sdf::Param doubleParam("key", "double", "1.0", false, "description");
+  const double third = 1.0 / 3.0;
+  EXPECT_TRUE(doubleParam.Set<double>(third));
+  double value;
+  EXPECT_TRUE(doubleParam.Get<double>(value));
+  EXPECT_EQ(third, value);
+  EXPECT_TRUE(doubleParam.GetSet());
+
+  // The string form is generated when it is asked for
+  EXPECT_EQ(third, std::stod(doubleParam.GetAsString()));
+
+  using Pose = gz::math::Pose3d;
+  const Pose pose(gz::math::Vector3d(0.1, 0.2, 0.3),
+                  gz::math::Quaterniond(0.5, 0.5, -0.5, 0.5));
+  sdf::Param poseParam("key", "pose", "0 0 0 0 0 0", false, "description");
+  EXPECT_TRUE(poseParam.Set<Pose>(pose));
+  Pose poseValue;
+  EXPECT_TRUE(poseParam.Get<Pose>(poseValue));
+  EXPECT_EQ(pose.Pos(), poseValue.Pos());
+  EXPECT_EQ(pose.Rot().W(), poseValue.Rot().W());
+  EXPECT_EQ(pose.Rot().X(), poseValue.Rot().X());
+  EXPECT_EQ(pose.Rot().Y(), poseValue.Rot().Y());
+  EXPECT_EQ(pose.Rot().Z(), poseValue.Rot().Z());
+
+  // Values that could not have been parsed are still rejected
+  sdf::Errors errors;
+  EXPECT_FALSE(poseParam.Set<Pose>(
+      Pose(std::numeric_limits<double>::infinity(), 0, 0, 0, 0, 0), errors));
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_EQ(sdf::ErrorCode::PARAMETER_ERROR, errors[0].Code());
+  EXPECT_TRUE(poseParam.Get<Pose>(poseValue));
+  EXPECT_EQ(pose.Pos(), poseValue.Pos());
+
+  // Other types are converted through their string form
+  EXPECT_TRUE(doubleParam.Set<int>(3));
+  EXPECT_TRUE(doubleParam.Get<double>(value));
+  EXPECT_DOUBLE_EQ(3.0, value);
+  EXPECT_TRUE(doubleParam.Set("4.5"));
+  EXPECT_TRUE(doubleParam.Get<double>(value));
+  EXPECT_DOUBLE_EQ(4.5, value);
+
+  // Reset and reparsing restore the default
+  doubleParam.Reset();
+  EXPECT_FALSE(doubleParam.GetSet());
+  EXPECT_TRUE(doubleParam.Reparse());
+  EXPECT_TRUE(doubleParam.Get<double>(value));
+  EXPECT_DOUBLE_EQ(1.0, value);
+}
+
+////////////////////////////////////////////////////
+TEST(Param, GetDefaultTemplate)
+{
+  sdf::Param doubleParam("key", "double", "0.25", false, "description");
+  EXPECT_TRUE(doubleParam.Set<double>(2.0));
+
+  double value = 0;
+  EXPECT_TRUE(doubleParam.GetDefault<double>(value));
+  EXPECT_DOUBLE_EQ(0.25, value);
+
+  // Other types are converted through their string form
+  std::string str;
+  EXPECT_TRUE(doubleParam.GetDefault<std::string>(str));
+  EXPECT_EQ("0.25", str);
+
+  sdf::Param poseParam("key", "pose", "1 2 3 0 0 0", false, "description");
+  gz::math::Pose3d pose;
+  sdf::Errors errors;
+  EXPECT_TRUE(poseParam.GetDefault<gz::math::Pose3d>(pose, errors));
+  EXPECT_TRUE(errors.empty());
+  EXPECT_EQ(gz::math::Pose3d(1, 2, 3, 0, 0, 0), pose);
+
+  // String defaults are read up to the first whitespace
+  sdf::Param stringParam("key", "string", "first second", false,
+                         "description");
+  EXPECT_TRUE(stringParam.GetDefault<std::string>(str));
+  EXPECT_EQ("first", str);
+  EXPECT_EQ("first second", stringParam.GetDefaultAsString());
+}
+
 ////////////////////////////////////////////////////
 TEST(Param, MinMaxViolation)
 {
@@ -575,6 +660,42 @@ TEST(Param, MinMaxViolation)
   }
 }
 
+//////////////////////////////////////////////////
+TEST(Param, CopiesShareDescription)
+{
+  sdf::Param doubleParam("key", "double", "1.0", false, "0", "10.0",
+                         "description");
+  ASSERT_TRUE(doubleParam.Set<double>(2.0));
+
+  sdf::ParamPtr clone = doubleParam.Clone();
+  EXPECT_EQ("key", clone->GetKey());
+  EXPECT_EQ("double", clone->GetTypeName());
+  EXPECT_EQ("description", clone->GetDescription());
+  EXPECT_EQ("1", clone->GetDefaultAsString());
+  EXPECT_EQ("0", clone->GetMinValueAsString().value_or(""));
+  EXPECT_EQ("10", clone->GetMaxValueAsString().value_or(""));
+
+  // Values are not shared
+  double value;
+  EXPECT_TRUE(clone->Get<double>(value));
+  EXPECT_DOUBLE_EQ(2.0, value);
+  EXPECT_TRUE(clone->Set<double>(3.0));
+  EXPECT_FALSE(clone->Set<double>(11.0));
+  EXPECT_TRUE(doubleParam.Get<double>(value));
+  EXPECT_DOUBLE_EQ(2.0, value);
+
+  // Changing the description of a copy leaves the others unchanged
+  clone->SetDescription("changed");
+  EXPECT_EQ("changed", clone->GetDescription());
+  EXPECT_EQ("description", doubleParam.GetDescription());
+  EXPECT_FALSE(clone->Set<double>(11.0));
+
+  sdf::Param copy(doubleParam);
+  doubleParam.SetDescription("original");
+  EXPECT_EQ("description", copy.GetDescription());
+  EXPECT_EQ("original", doubleParam.GetDescription());
+}
+
 //////////////////////////////////////////////////
 TEST(Param, SettingParentElement)
 {
@@ -983,3 +1104,30 @@ TEST(Param, PoseWithDefaultValue)
   EXPECT_EQ(Pose(1, 0, 0, 0, 0, 0), poseElemClone->Get<Pose>());
   EXPECT_STREQ(expectedString.c_str(), poseElemClone->ToString("").c_str());
 }
+
+/////////////////////////////////////////////////
+TEST(Param, ValueTypeFromString)
+{
+  using ValueType = sdf::ParamPrivate::ValueType;
+  EXPECT_EQ(ValueType::BOOL, sdf::ParamPrivate::ValueTypeFromString("bool"));
+  EXPECT_EQ(ValueType::STRING,
+            sdf::ParamPrivate::ValueTypeFromString("std::string"));
+  EXPECT_EQ(ValueType::STRING,
+            sdf::ParamPrivate::ValueTypeFromString("string"));
+  EXPECT_EQ(ValueType::VECTOR3D,
+            sdf::ParamPrivate::ValueTypeFromString("vector3"));
+  EXPECT_EQ(ValueType::POSE, sdf::ParamPrivate::ValueTypeFromString("Pose"));
+  EXPECT_EQ(ValueType::POSE,
+            sdf::ParamPrivate::ValueTypeFromString("gz::math::Pose3d"));
+  EXPECT_EQ(ValueType::UNKNOWN,
+            sdf::ParamPrivate::ValueTypeFromString("vector4"));
+
+  EXPECT_EQ(ValueType::DOUBLE, sdf::ParamPrivate::TypeToValueType<double>());
+  EXPECT_EQ(ValueType::UNKNOWN, sdf::ParamPrivate::TypeToValueType<long>());
+
+  // Unknown types are still reported when parsing
+  sdf::Errors errors;
+  sdf::Param param("key", "vector4", "0 0 0 0", false, errors);
+  ASSERT_FALSE(errors.empty());
+  EXPECT_EQ(sdf::ErrorCode::UNKNOWN_PARAMETER_TYPE, errors[0].Code());
+}
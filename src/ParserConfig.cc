@@ -15,9 +15,13 @@
  *
  */
 
+#include <memory>
 #include <optional>
+#include <utility>
 
 #include "sdf/ParserConfig.hh"
+#include "sdf/ConversionCache.hh"
+#include "sdf/FindFileCache.hh"
 #include "sdf/Filesystem.hh"
 #include "sdf/Types.hh"
 #include "sdf/CustomInertiaCalcProperties.hh"
@@ -66,6 +70,31 @@ class sdf::ParserConfig::Implementation
 
   /// \brief Flag to expand URIs where possible store the resolved paths
   public: bool storeResolvedURIs = false;
+
+  /// \brief Flag to place parsed documents into a per-document arena.
+  public: bool useDocumentArena = false;
+
+  /// \brief Cache of files read through <include> tags, shared by copies
+  /// of the configuration.
+  public: std::shared_ptr<sdf::IncludeCache> includeCache;
+
+  /// \brief Cache of paths found by sdf::findFile, shared by copies of the
+  /// configuration.
+  public: std::shared_ptr<sdf::FindFileCache> findFileCache;
+
+  /// \brief Index of the model directories in the search paths, shared by
+  /// copies of the configuration.
+  public: std::shared_ptr<sdf::ModelIndex> modelIndex;
+
+  /// \brief Cache on disk of converted files, shared by copies of the
+  /// configuration.
+  public: std::shared_ptr<sdf::ConversionCache> conversionCache;
+
+  /// \brief Number of threads used to read included files.
+  public: unsigned int includeWorkerCount = 0;
+
+  /// \brief Whether documents are read with a streaming reader.
+  public: bool useStreamingReader = false;
 };
 
 
@@ -95,6 +124,8 @@ void ParserConfig::SetFindCallback(
     std::function<std::string(const std::string &)> _cb)
 {
   this->dataPtr->findFileCB = _cb;
+  if (this->dataPtr->findFileCache)
+    this->dataPtr->findFileCache->Clear();
 }
 
 /////////////////////////////////////////////////
@@ -122,6 +153,9 @@ void ParserConfig::AddURIPath(const std::string &_uri, const std::string &_path)
       this->dataPtr->uriPathMap[_uri].push_back(part);
     }
   }
+
+  if (this->dataPtr->findFileCache)
+    this->dataPtr->findFileCache->Clear();
 }
 
 /////////////////////////////////////////////////
@@ -235,3 +269,88 @@ bool ParserConfig::StoreResolvedURIs() const
 {
   return this->dataPtr->storeResolvedURIs;
 }
+
+/////////////////////////////////////////////////
+void ParserConfig::SetUseDocumentArena(bool _useArena)
+{
+  this->dataPtr->useDocumentArena = _useArena;
+}
+
+/////////////////////////////////////////////////
+bool ParserConfig::UseDocumentArena() const
+{
+  return this->dataPtr->useDocumentArena;
+}
+
+/////////////////////////////////////////////////
+void ParserConfig::SetIncludeCache(std::shared_ptr<sdf::IncludeCache> _cache)
+{
+  this->dataPtr->includeCache = std::move(_cache);
+}
+
+/////////////////////////////////////////////////
+std::shared_ptr<sdf::IncludeCache> ParserConfig::IncludeCache() const
+{
+  return this->dataPtr->includeCache;
+}
+
+/////////////////////////////////////////////////
+void ParserConfig::SetFindFileCache(std::shared_ptr<sdf::FindFileCache> _cache)
+{
+  this->dataPtr->findFileCache = std::move(_cache);
+}
+
+/////////////////////////////////////////////////
+std::shared_ptr<sdf::FindFileCache> ParserConfig::FindFileCache() const
+{
+  return this->dataPtr->findFileCache;
+}
+
+/////////////////////////////////////////////////
+void ParserConfig::SetModelIndex(std::shared_ptr<sdf::ModelIndex> _index)
+{
+  this->dataPtr->modelIndex = std::move(_index);
+}
+
+/////////////////////////////////////////////////
+std::shared_ptr<sdf::ModelIndex> ParserConfig::ModelIndex() const
+{
+  return this->dataPtr->modelIndex;
+}
+
+/////////////////////////////////////////////////
+void ParserConfig::SetConversionCache(
+    std::shared_ptr<sdf::ConversionCache> _cache)
+{
+  this->dataPtr->conversionCache = std::move(_cache);
+}
+
+/////////////////////////////////////////////////
+std::shared_ptr<sdf::ConversionCache> ParserConfig::ConversionCache() const
+{
+  return this->dataPtr->conversionCache;
+}
+
+/////////////////////////////////////////////////
+void ParserConfig::SetIncludeWorkerCount(unsigned int _count)
+{
+  this->dataPtr->includeWorkerCount = _count;
+}
+
+/////////////////////////////////////////////////
+unsigned int ParserConfig::IncludeWorkerCount() const
+{
+  return this->dataPtr->includeWorkerCount;
+}
+
+/////////////////////////////////////////////////
+void ParserConfig::SetUseStreamingReader(bool _use)
+{
+  this->dataPtr->useStreamingReader = _use;
+}
+
+/////////////////////////////////////////////////
+bool ParserConfig::UseStreamingReader() const
+{
+  return this->dataPtr->useStreamingReader;
+}
@@ -15,9 +15,13 @@
  *
  */
 
+#include <memory>
+
 #include <gtest/gtest.h>
 
+#include "sdf/ConversionCache.hh"
 #include "sdf/Filesystem.hh"
+#include "sdf/IncludeCache.hh"
 #include "sdf/ParserConfig.hh"
 #include "sdf/SDFImpl.hh"
 #include "test_config.hh"
@@ -70,6 +74,36 @@ TEST(ParserConfig, Construction)
 
   EXPECT_FALSE(config.URDFPreserveFixedJoint());
   EXPECT_FALSE(config.StoreResolvedURIs());
+
+  EXPECT_FALSE(config.UseDocumentArena());
+  config.SetUseDocumentArena(true);
+  EXPECT_TRUE(config.UseDocumentArena());
+
+  EXPECT_EQ(nullptr, config.IncludeCache());
+  auto cache = std::make_shared<sdf::IncludeCache>();
+  config.SetIncludeCache(cache);
+  EXPECT_EQ(cache, config.IncludeCache());
+
+  // Copies share the cache
+  sdf::ParserConfig copy(config);
+  EXPECT_EQ(cache, copy.IncludeCache());
+  config.SetIncludeCache(nullptr);
+  EXPECT_EQ(nullptr, config.IncludeCache());
+  EXPECT_EQ(cache, copy.IncludeCache());
+
+  EXPECT_EQ(nullptr, config.ConversionCache());
+  auto conversionCache = std::make_shared<sdf::ConversionCache>("cache");
+  config.SetConversionCache(conversionCache);
+  EXPECT_EQ(conversionCache, config.ConversionCache());
+  EXPECT_EQ(conversionCache, sdf::ParserConfig(config).ConversionCache());
+
+  EXPECT_EQ(0u, config.IncludeWorkerCount());
+  config.SetIncludeWorkerCount(4);
+  EXPECT_EQ(4u, config.IncludeWorkerCount());
+
+  EXPECT_FALSE(config.UseStreamingReader());
+  config.SetUseStreamingReader(true);
+  EXPECT_TRUE(config.UseStreamingReader());
 }
 
 /////////////////////////////////////////////////
@@ -409,8 +409,7 @@ Errors Pbr::Load(sdf::ElementPtr _sdf)
   }
 
   // load all workflows
-  sdf::ElementPtr workflowElem = _sdf->GetFirstElement();
-  while (workflowElem)
+  for (const sdf::ElementPtr &workflowElem : _sdf->Children())
   {
     PbrWorkflow workflow;
     Errors workflowErrors = workflow.Load(workflowElem);
@@ -418,7 +417,6 @@ Errors Pbr::Load(sdf::ElementPtr _sdf)
       this->dataPtr->workflows[workflow.Type()] = workflow;
     else
       errors.insert(errors.end(), workflowErrors.begin(), workflowErrors.end());
-    workflowElem = workflowElem->GetNextElement();
   }
 
   return errors;
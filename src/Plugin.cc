@@ -127,8 +127,7 @@ Errors Plugin::Load(ElementPtr _sdf)
   }
 
   // Copy the contents of the plugin
-  for (sdf::ElementPtr innerElem = _sdf->GetFirstElement();
-       innerElem; innerElem = innerElem->GetNextElement(""))
+  for (const sdf::ElementPtr &innerElem : _sdf->Children())
   {
     this->dataPtr->contents.push_back(innerElem->Clone(errors));
   }
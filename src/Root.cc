@@ -277,8 +277,7 @@ Errors Root::Load(SDFPtr _sdf, const ParserConfig &_config)
   // Read all the worlds
   if (this->dataPtr->sdf->HasElement("world"))
   {
-    ElementPtr elem = this->dataPtr->sdf->GetElement("world");
-    while (elem)
+    for (const auto &elem : this->dataPtr->sdf->Children("world"))
     {
       World world;
 
@@ -306,7 +305,6 @@ Errors Root::Load(SDFPtr _sdf, const ParserConfig &_config)
       }
 
       this->dataPtr->worlds.push_back(std::move(world));
-      elem = elem->GetNextElement("world");
     }
   }
 
@@ -21,6 +21,7 @@
 #include <functional>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -29,10 +30,14 @@
 #include "sdf/Console.hh"
 #include "sdf/Error.hh"
 #include "sdf/Filesystem.hh"
+#include "sdf/FindFileCache.hh"
 #include "sdf/InstallationDirectories.hh"
+#include "sdf/ModelIndex.hh"
 #include "sdf/SDFImpl.hh"
 #include "SDFImplPrivate.hh"
 #include "sdf/sdf_config.h"
+#include "BinaryDocument.hh"
+#include "DocumentArena.hh"
 #include "EmbeddedSdf.hh"
 #include "Utils.hh"
 
@@ -99,10 +104,49 @@ std::string findFile(const std::string &_filename, bool _searchLocalPath,
 
 
 /////////////////////////////////////////////////
-std::string findFile(sdf::Errors &_errors, const std::string &_filename,
-                     bool _searchLocalPath, bool _useCallback,
-                     const ParserConfig &_config)
+/// \brief Get whether a name refers to an entry of a directory, rather than
+/// to a path with several components.
+/// \param[in] _name Name to check.
+/// \return True if the name is a single path component.
+static bool isEntryName(const std::string &_name)
+{
+  return !_name.empty() && _name != "." && _name != ".." &&
+         _name.find_first_of("/\\") == std::string::npos;
+}
+
+/////////////////////////////////////////////////
+/// \brief Search for a file without using the find file cache.
+/// \param[out] _errors Vector of errors.
+/// \param[in] _filename Name of the file to find.
+/// \param[in] _searchLocalPath True to search for the file in the current
+/// working path.
+/// \param[in] _useCallback True to find a file based on a registered
+/// callback if the file is not found via the normal mechanism.
+/// \param[in] _config Custom parser configuration.
+/// \param[out] _probes Incremented for every filesystem probe and call to
+/// the find file callback.
+/// \return File path. If no file is found, an empty string is returned.
+static std::string findFileUncached(sdf::Errors &_errors,
+    const std::string &_filename, bool _searchLocalPath, bool _useCallback,
+    const ParserConfig &_config, uint64_t &_probes)
 {
+  auto probe = [&_probes](const std::string &_path)
+  {
+    ++_probes;
+    return sdf::filesystem::exists(_path);
+  };
+
+  // Whether an entry exists in an indexed directory is known without
+  // probing the filesystem.
+  const std::shared_ptr<ModelIndex> modelIndex = _config.ModelIndex();
+  auto exists = [&](const std::string &_directory, const std::string &_name,
+                    const std::string &_path)
+  {
+    if (modelIndex && isEntryName(_name) && modelIndex->IsIndexed(_directory))
+      return modelIndex->Contains(_directory, _name);
+    return probe(_path);
+  };
+
   // Check to see if _filename is URI. If so, resolve the URI path.
   for (const auto &[uriScheme, paths] : _config.URIPathMap())
   {
@@ -122,7 +166,7 @@ std::string findFile(sdf::Errors &_errors, const std::string &_filename,
       {
         // Return the path string if the path + suffix exists.
         std::string pathSuffix = sdf::filesystem::append(path, suffix);
-        if (sdf::filesystem::exists(pathSuffix))
+        if (exists(path, suffix, pathSuffix))
         {
           return pathSuffix;
         }
@@ -144,7 +188,7 @@ std::string findFile(sdf::Errors &_errors, const std::string &_filename,
   {
     std::string path = sdf::filesystem::append(sdf::filesystem::current_path(),
                                                filename);
-    if (sdf::filesystem::exists(path))
+    if (probe(path))
     {
       return path;
     }
@@ -152,7 +196,7 @@ std::string findFile(sdf::Errors &_errors, const std::string &_filename,
 
   // Next check the install path.
   std::string path = sdf::filesystem::append(sdfSharePath(), filename);
-  if (sdf::filesystem::exists(path))
+  if (probe(path))
   {
     return path;
   }
@@ -162,14 +206,14 @@ std::string findFile(sdf::Errors &_errors, const std::string &_filename,
     "sdformat" + std::string(SDF_MAJOR_VERSION_STR),
     sdf::SDF::Version(), filename);
 
-  if (sdf::filesystem::exists(path))
+  if (probe(path))
   {
     return path;
   }
 
   // Finally check to see if the given file exists.
   path = filename;
-  if (sdf::filesystem::exists(path))
+  if (probe(path))
   {
     return path;
   }
@@ -182,7 +226,7 @@ std::string findFile(sdf::Errors &_errors, const std::string &_filename,
          iter != paths.end(); ++iter)
     {
       path = sdf::filesystem::append(*iter, filename);
-      if (sdf::filesystem::exists(path))
+      if (exists(*iter, filename, path))
       {
         return path;
       }
@@ -202,6 +246,7 @@ std::string findFile(sdf::Errors &_errors, const std::string &_filename,
     }
     else
     {
+      ++_probes;
       return _config.FindFileCallback()(_filename);
     }
   }
@@ -209,6 +254,32 @@ std::string findFile(sdf::Errors &_errors, const std::string &_filename,
   return std::string();
 }
 
+/////////////////////////////////////////////////
+std::string findFile(sdf::Errors &_errors, const std::string &_filename,
+                     bool _searchLocalPath, bool _useCallback,
+                     const ParserConfig &_config)
+{
+  uint64_t probes = 0;
+  const std::shared_ptr<FindFileCache> cache = _config.FindFileCache();
+  if (!cache)
+  {
+    return findFileUncached(_errors, _filename, _searchLocalPath,
+                            _useCallback, _config, probes);
+  }
+
+  std::string path;
+  if (cache->Find(_filename, _searchLocalPath, _useCallback, path, _errors))
+    return path;
+
+  sdf::Errors errors;
+  path = findFileUncached(errors, _filename, _searchLocalPath, _useCallback,
+                          _config, probes);
+  cache->Insert(_filename, _searchLocalPath, _useCallback, path, errors,
+                probes);
+  _errors.insert(_errors.end(), errors.begin(), errors.end());
+  return path;
+}
+
 /////////////////////////////////////////////////
 void addURIPath(const std::string &_uri, const std::string &_path)
 {
@@ -391,6 +462,37 @@ void SDF::Write(sdf::Errors &_errors, const std::string &_filename)
   out.close();
 }
 
+/////////////////////////////////////////////////
+void SDF::SaveBinary(sdf::Errors &_errors, const std::string &_filename) const
+{
+  BinaryDocument::Save(_filename, this->dataPtr->root, this->dataPtr->path,
+                       this->dataPtr->originalVersion, _errors);
+}
+
+/////////////////////////////////////////////////
+void SDF::LoadBinary(sdf::Errors &_errors, const std::string &_filename,
+                     const ParserConfig &_config)
+{
+  DocumentArenaScope arenaScope(
+      DocumentArena::ForDocument(_config.UseDocumentArena()));
+
+  SDFPtr schema(new SDF());
+  if (!init(_errors, schema, _config))
+    return;
+
+  std::string filePath;
+  std::string originalVersion;
+  if (!BinaryDocument::Load(_filename, schema->Root(), filePath,
+                            originalVersion, _config, _errors))
+  {
+    return;
+  }
+
+  this->dataPtr->root = schema->Root();
+  this->dataPtr->path = filePath;
+  this->dataPtr->originalVersion = originalVersion;
+}
+
 /////////////////////////////////////////////////
 std::string SDF::ToString(const PrintConfig &_config) const
 {
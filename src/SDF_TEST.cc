@@ -19,6 +19,8 @@
 
 #include <any>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
 
 #include <gz/math.hh>
 #include <gz/utils/Environment.hh>
@@ -712,6 +714,93 @@ TEST(SDF, ToStringAndParse)
   EXPECT_TRUE(sdf::readString(sdfToString, rootClone));
 }
 
+/////////////////////////////////////////////////
+TEST(SDF, SaveAndLoadBinary)
+{
+  std::string testModel = R"sdf(
+    <sdf version="1.12">
+      <model name="m">
+        <pose>1 2 3 0 0 0</pose>
+        <link name="l">
+          <inertial><mass>2.5</mass></inertial>
+        </link>
+        <custom:tag custom:attr="a">text</custom:tag>
+      </model>
+    </sdf>)sdf";
+
+  std::string tmpDir;
+  ASSERT_TRUE(sdf::testing::TestTmpPath(tmpDir));
+  const std::string binaryFile =
+      (std::filesystem::path(tmpDir) / "model.sdfb").string();
+
+  sdf::SDF sdfParsed;
+  sdfParsed.SetFromString(testModel);
+  sdfParsed.SetFilePath("/some/path");
+
+  sdf::Errors errors;
+  sdfParsed.SaveBinary(errors, binaryFile);
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  sdf::SDF sdfLoaded;
+  sdfLoaded.LoadBinary(errors, binaryFile);
+  EXPECT_TRUE(errors.empty()) << errors;
+  EXPECT_EQ(sdfParsed.ToString(), sdfLoaded.ToString());
+  EXPECT_EQ("/some/path", sdfLoaded.FilePath());
+
+  sdf::ElementPtr model = sdfLoaded.Root()->GetElement("model");
+  ASSERT_NE(nullptr, model);
+  EXPECT_EQ(gz::math::Pose3d(1, 2, 3, 0, 0, 0),
+            model->Get<gz::math::Pose3d>("pose"));
+  EXPECT_DOUBLE_EQ(2.5, model->GetElement("link")->GetElement("inertial")
+                   ->Get<double>("mass"));
+  ASSERT_TRUE(model->LineNumber().has_value());
+  EXPECT_EQ(3, model->LineNumber().value());
+  EXPECT_EQ("/sdf/model[@name=\"m\"]", model->XmlPath());
+  ASSERT_TRUE(model->HasElement("custom:tag"));
+  EXPECT_EQ("a", model->GetElement("custom:tag")->GetAttribute("custom:attr")
+            ->GetAsString());
+
+  // A missing file
+  sdf::SDF sdfMissing;
+  sdfMissing.LoadBinary(
+      errors, (std::filesystem::path(tmpDir) / "missing").string());
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_EQ(sdf::ErrorCode::FILE_READ, errors[0].Code());
+  errors.clear();
+
+  // A file that is not a binary document
+  const std::string textFile =
+      (std::filesystem::path(tmpDir) / "model.sdf").string();
+  sdfParsed.Write(textFile);
+  sdfLoaded.LoadBinary(errors, textFile);
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_EQ(sdf::ErrorCode::FILE_READ, errors[0].Code());
+  EXPECT_NE(std::string::npos,
+            errors[0].Message().find("is not a binary SDFormat document"));
+  errors.clear();
+
+  // The document is not changed on error
+  EXPECT_EQ(sdfParsed.ToString(), sdfLoaded.ToString());
+
+  // A truncated file
+  std::string data;
+  {
+    std::ifstream in(binaryFile, std::ios::binary);
+    data.assign(std::istreambuf_iterator<char>(in),
+                std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream out(binaryFile, std::ios::binary | std::ios::trunc);
+    out.write(data.data(), data.size() / 2);
+  }
+  sdfLoaded.LoadBinary(errors, binaryFile);
+  EXPECT_FALSE(errors.empty());
+  EXPECT_EQ(sdfParsed.ToString(), sdfLoaded.ToString());
+
+  std::remove(binaryFile.c_str());
+  std::remove(textFile.c_str());
+}
+
 #ifndef _WIN32
 bool create_new_temp_dir(std::string &_new_temp_path)
 {
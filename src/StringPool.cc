@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+#include "StringPool.hh"
+
+namespace sdf
+{
+inline namespace SDF_VERSION_NAMESPACE {
+
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief The string pool and the mutex that protects it.
+struct StringPool
+{
+  /// \brief Interned strings. Element addresses of an unordered_set are
+  /// stable across rehashing.
+  std::unordered_set<std::string> strings;
+
+  /// \brief Lookups take a shared lock, insertions an exclusive one.
+  std::shared_mutex mutex;
+};
+
+/////////////////////////////////////////////////
+/// \brief Get the process-wide string pool. It is intentionally leaked so
+/// that interned strings outlive Elements destroyed during static
+/// destruction.
+StringPool &pool()
+{
+  static StringPool *instance = new StringPool;
+  return *instance;
+}
+}
+
+/////////////////////////////////////////////////
+const std::string *InternString(const std::string &_str)
+{
+  StringPool &stringPool = pool();
+  {
+    std::shared_lock<std::shared_mutex> lock(stringPool.mutex);
+    auto it = stringPool.strings.find(_str);
+    if (it != stringPool.strings.end())
+    {
+      return &(*it);
+    }
+  }
+
+  std::unique_lock<std::shared_mutex> lock(stringPool.mutex);
+  return &(*stringPool.strings.insert(_str).first);
+}
+
+/////////////////////////////////////////////////
+std::size_t InternedStringCount()
+{
+  StringPool &stringPool = pool();
+  std::shared_lock<std::shared_mutex> lock(stringPool.mutex);
+  return stringPool.strings.size();
+}
+}
+}
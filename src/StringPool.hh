@@ -0,0 +1,51 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef SDFORMAT_STRINGPOOL_HH
+#define SDFORMAT_STRINGPOOL_HH
+
+#include <cstddef>
+#include <string>
+
+#include "sdf/sdf_config.h"
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  /// \internal
+  /// \brief Get the interned copy of a string from the process-wide string
+  /// pool, adding it to the pool if needed. Element and Param store their
+  /// names and types this way, because the same few thousand strings are
+  /// repeated in every element created from the schema.
+  ///
+  /// Interned strings are never released, so this must not be used for
+  /// strings that are unique to a document, such as values, file paths and
+  /// descriptions.
+  /// This function is thread-safe.
+  /// \param[in] _str String to intern.
+  /// \return Pointer to the interned string, which is valid for the lifetime
+  /// of the process. Equal strings always give the same pointer.
+  const std::string *InternString(const std::string &_str);
+
+  /// \internal
+  /// \brief Get the number of strings in the process-wide string pool.
+  /// \return Number of interned strings.
+  std::size_t InternedStringCount();
+  }
+}
+#endif
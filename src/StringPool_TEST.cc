@@ -0,0 +1,102 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "sdf/Element.hh"
+#include "sdf/Param.hh"
+#include "StringPool.hh"
+
+/////////////////////////////////////////////////
+TEST(StringPool, InternString)
+{
+  const std::string *empty = sdf::InternString("");
+  ASSERT_NE(nullptr, empty);
+  EXPECT_TRUE(empty->empty());
+
+  const std::string *link = sdf::InternString("link");
+  EXPECT_EQ("link", *link);
+  EXPECT_EQ(link, sdf::InternString(std::string("li") + "nk"));
+  EXPECT_NE(link, sdf::InternString("joint"));
+
+  // Interned strings do not move when more strings are added
+  const std::size_t count = sdf::InternedStringCount();
+  for (int i = 0; i < 1000; ++i)
+  {
+    sdf::InternString("StringPool_TEST_" + std::to_string(i));
+  }
+  EXPECT_EQ(count + 1000, sdf::InternedStringCount());
+  EXPECT_EQ(link, sdf::InternString("link"));
+  EXPECT_EQ("link", *link);
+}
+
+/////////////////////////////////////////////////
+TEST(StringPool, Concurrent)
+{
+  const int threadCount = 8;
+  std::vector<std::vector<const std::string *>> results(threadCount);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < threadCount; ++t)
+  {
+    threads.emplace_back([t, &results]()
+    {
+      for (int i = 0; i < 500; ++i)
+      {
+        results[t].push_back(
+            sdf::InternString("StringPool_Concurrent_" + std::to_string(i)));
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  for (int t = 1; t < threadCount; ++t)
+  {
+    EXPECT_EQ(results[0], results[t]);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(StringPool, DocumentStringsNotInterned)
+{
+  sdf::ElementPtr elem(new sdf::Element);
+  elem->SetName("link");
+  elem->AddAttribute("name", "string", "", true, "name of the link");
+  sdf::Param param("key", "string", "", false);
+
+  // File paths and descriptions are owned by the elements and parameters
+  const std::size_t count = sdf::InternedStringCount();
+  elem->SetFilePath("/StringPool_TEST/model.sdf");
+  elem->SetDescription("StringPool_TEST element description");
+  param.SetDescription("StringPool_TEST param description");
+  EXPECT_EQ(count, sdf::InternedStringCount());
+  EXPECT_EQ("/StringPool_TEST/model.sdf", elem->FilePath());
+  EXPECT_EQ("StringPool_TEST element description", elem->GetDescription());
+  EXPECT_EQ("StringPool_TEST param description", param.GetDescription());
+
+  // The file path is shared with child elements
+  sdf::ElementPtr child(new sdf::Element);
+  child->SetParent(elem);
+  EXPECT_EQ(&elem->FilePath(), &child->FilePath());
+  EXPECT_EQ(count, sdf::InternedStringCount());
+}
@@ -233,8 +233,7 @@ sdf::Errors loadIncludedInterfaceModels(sdf::ElementPtr _sdf,
     std::vector<std::pair<NestedInclude, InterfaceModelConstPtr>> &_models)
 {
   sdf::Errors allErrors;
-  for (auto includeElem = _sdf->GetElementImpl("include"); includeElem;
-       includeElem = includeElem->GetNextElement("include"))
+  for (const auto &includeElem : _sdf->Children("include"))
   {
     sdf::NestedInclude include;
     include.SetUri(includeElem->Get<std::string>("uri"));
@@ -109,44 +109,37 @@ namespace sdf
 
     std::vector<std::string> names;
 
-    // Check that an element exists.
-    if (_sdf->HasElement(_sdfName))
+    // Read all the elements.
+    for (const sdf::ElementPtr &elem : _sdf->Children(_sdfName))
     {
-      // Read all the elements.
-      sdf::ElementPtr elem = _sdf->GetElement(_sdfName);
-      while (elem)
-      {
-        Class obj;
-
-        // Load the model and capture the errors.
-        Errors loadErrors = obj.Load(elem, std::forward<Args>(_args)...);
+      Class obj;
 
-        // keep processing even if there are loadErrors
-        {
-          std::string name;
+      // Load the model and capture the errors.
+      Errors loadErrors = obj.Load(elem, std::forward<Args>(_args)...);
 
-          // Read the name for uniqueness checks. Don't report errors here.
-          // Errors are captured in obj.Load(elem) above.
-          sdf::loadName(elem, name);
+      // keep processing even if there are loadErrors
+      {
+        std::string name;
 
-          // Check that the name does not exist.
-          if (std::find(names.begin(), names.end(), name) != names.end())
-          {
-            errors.push_back({ErrorCode::DUPLICATE_NAME,
-                _sdfName + " with name[" + name + "] already exists."});
-          }
-          else
-          {
-            // Add the object to the result if no errors have been encountered.
-            _objs.push_back(std::move(obj));
-            names.push_back(name);
-          }
+        // Read the name for uniqueness checks. Don't report errors here.
+        // Errors are captured in obj.Load(elem) above.
+        sdf::loadName(elem, name);
 
-          // Add the load errors to the master error list.
-          errors.insert(errors.end(), loadErrors.begin(), loadErrors.end());
+        // Check that the name does not exist.
+        if (std::find(names.begin(), names.end(), name) != names.end())
+        {
+          errors.push_back({ErrorCode::DUPLICATE_NAME,
+              _sdfName + " with name[" + name + "] already exists."});
+        }
+        else
+        {
+          // Add the object to the result if no errors have been encountered.
+          _objs.push_back(std::move(obj));
+          names.push_back(name);
         }
 
-        elem = elem->GetNextElement(_sdfName);
+        // Add the load errors to the master error list.
+        errors.insert(errors.end(), loadErrors.begin(), loadErrors.end());
       }
     }
     // Do not add an error if the model tag is missing. This is an internal
@@ -171,27 +164,20 @@ namespace sdf
   {
     Errors errors;
 
-    // Check that an element exists.
-    if (_sdf->HasElement(_sdfName))
+    // Read all the elements.
+    for (const sdf::ElementPtr &elem : _sdf->Children(_sdfName))
     {
-      // Read all the elements.
-      sdf::ElementPtr elem = _sdf->GetElement(_sdfName);
-      while (elem)
-      {
-        Class obj;
+      Class obj;
 
-        // Load the model and capture the errors.
-        Errors loadErrors = obj.Load(elem, std::forward<Args>(_args)...);
-
-        {
-          // Add the load errors to the master error list.
-          errors.insert(errors.end(), loadErrors.begin(), loadErrors.end());
+      // Load the model and capture the errors.
+      Errors loadErrors = obj.Load(elem, std::forward<Args>(_args)...);
 
-          // but keep object anyway
-          _objs.push_back(std::move(obj));
-        }
+      {
+        // Add the load errors to the master error list.
+        errors.insert(errors.end(), loadErrors.begin(), loadErrors.end());
 
-        elem = elem->GetNextElement(_sdfName);
+        // but keep object anyway
+        _objs.push_back(std::move(obj));
       }
     }
     // Do not add an error if the model tag is missing. This is an internal
@@ -0,0 +1,363 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <charconv>
+#include <limits>
+#include <system_error>
+
+#include "ValueParsing.hh"
+
+// Floating point std::from_chars is not available in every standard library
+// yet. Elsewhere fall back to strtod_l with the C locale, which is also
+// locale-independent and allocation free.
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define SDFORMAT_FLOAT_FROM_CHARS 1
+#else
+#include <cerrno>
+#include <cstdlib>
+#include <locale.h>
+#include <string>
+#include <type_traits>
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+#endif
+
+namespace sdf
+{
+// Inline bracket to help doxygen filtering.
+inline namespace SDF_VERSION_NAMESPACE {
+
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Check for whitespace the way the classic locale does.
+/// \param[in] _c Character to check.
+/// \return True if _c is a space, tab, newline, vertical tab, form feed or
+/// carriage return.
+bool isSpace(char _c)
+{
+  return _c == ' ' || (_c >= '\t' && _c <= '\r');
+}
+
+/////////////////////////////////////////////////
+/// \brief Check for a hexadecimal digit independently of the locale.
+/// \param[in] _c Character to check.
+/// \return True if _c is a hexadecimal digit.
+bool isHexDigit(char _c)
+{
+  return (_c >= '0' && _c <= '9') || (_c >= 'a' && _c <= 'f') ||
+         (_c >= 'A' && _c <= 'F');
+}
+
+/////////////////////////////////////////////////
+/// \brief Check whether a string starts with a 0x prefix that is followed
+/// by a hexadecimal number.
+/// \param[in] _str The string to check.
+/// \param[in] _allowFraction True to accept a number that starts with a
+/// radix point, as in 0x.8.
+/// \return True if the string has a 0x prefix.
+bool hasHexPrefix(std::string_view _str, bool _allowFraction)
+{
+  if (_str.size() < 3 || _str[0] != '0' || (_str[1] != 'x' && _str[1] != 'X'))
+  {
+    return false;
+  }
+  return isHexDigit(_str[2]) ||
+      (_allowFraction && _str[2] == '.' && _str.size() > 3 &&
+       isHexDigit(_str[3]));
+}
+
+/////////////////////////////////////////////////
+/// \brief Parse the sign and magnitude of the integer at the start of a
+/// string, like std::strtoull.
+/// \param[in] _str The string.
+/// \param[in] _base The numeric base.
+/// \param[out] _negative True if the number has a minus sign.
+/// \param[out] _magnitude The magnitude of the number.
+/// \param[out] _length Number of characters used by the number.
+/// \return Whether a number was parsed.
+ParseNumberResult parseMagnitude(std::string_view _str, int _base,
+                                 bool &_negative, std::uint64_t &_magnitude,
+                                 std::size_t &_length)
+{
+  std::size_t pos = 0;
+  _negative = false;
+  if (!_str.empty() && (_str[0] == '+' || _str[0] == '-'))
+  {
+    _negative = _str[0] == '-';
+    ++pos;
+  }
+  if (_base == 16 && hasHexPrefix(_str.substr(pos), false))
+  {
+    pos += 2;
+  }
+
+  // from_chars does not accept signs for unsigned types, so a second sign
+  // is rejected here as well.
+  const char *begin = _str.data();
+  const auto [ptr, ec] = std::from_chars(
+      begin + pos, begin + _str.size(), _magnitude, _base);
+  if (ec == std::errc::invalid_argument)
+  {
+    return ParseNumberResult::INVALID_ARGUMENT;
+  }
+  _length = static_cast<std::size_t>(ptr - begin);
+  if (ec == std::errc::result_out_of_range)
+  {
+    return ParseNumberResult::OUT_OF_RANGE;
+  }
+  return ParseNumberResult::OK;
+}
+
+#ifndef SDFORMAT_FLOAT_FROM_CHARS
+/////////////////////////////////////////////////
+/// \brief Get the C locale used to parse numbers.
+/// \return The C locale.
+locale_t classicLocale()
+{
+  static locale_t locale = newlocale(LC_ALL_MASK, "C", locale_t(0));
+  return locale;
+}
+
+/////////////////////////////////////////////////
+/// \brief Parse a floating point number with strtod_l or strtof_l.
+/// \param[in] _str The string.
+/// \param[out] _value The parsed value.
+/// \param[out] _length Number of characters used by the number.
+/// \return Whether a number was parsed.
+template <typename T>
+ParseNumberResult strtoReal(std::string_view _str, T &_value,
+                            std::size_t &_length)
+{
+  // strtod needs a null terminated string. Numbers are short, so a copy on
+  // the stack is enough, except for pathological inputs.
+  char buffer[128];
+  std::string large;
+  const char *str = buffer;
+  if (_str.size() < sizeof(buffer))
+  {
+    _str.copy(buffer, _str.size());
+    buffer[_str.size()] = '\0';
+  }
+  else
+  {
+    large.assign(_str);
+    str = large.c_str();
+  }
+
+  char *end = nullptr;
+  errno = 0;
+  if constexpr (std::is_same_v<T, float>)
+  {
+    _value = strtof_l(str, &end, classicLocale());
+  }
+  else
+  {
+    _value = strtod_l(str, &end, classicLocale());
+  }
+  if (end == str)
+  {
+    return ParseNumberResult::INVALID_ARGUMENT;
+  }
+  _length = static_cast<std::size_t>(end - str);
+  if (errno == ERANGE)
+  {
+    return ParseNumberResult::OUT_OF_RANGE;
+  }
+  return ParseNumberResult::OK;
+}
+#endif
+
+/////////////////////////////////////////////////
+/// \brief Parse the floating point number at the start of a string.
+/// \param[in] _str The string.
+/// \param[in] _allowHex True to accept hexadecimal numbers.
+/// \param[out] _value The parsed value.
+/// \param[out] _length Number of characters used by the number.
+/// \return Whether a number was parsed.
+template <typename T>
+ParseNumberResult parseRealImpl(std::string_view _str, bool _allowHex,
+                                T &_value, std::size_t &_length)
+{
+  std::size_t pos = 0;
+  bool negative = false;
+  if (!_str.empty() && (_str[0] == '+' || _str[0] == '-'))
+  {
+    negative = _str[0] == '-';
+    ++pos;
+  }
+  if (pos == _str.size() || _str[pos] == '+' || _str[pos] == '-')
+  {
+    return ParseNumberResult::INVALID_ARGUMENT;
+  }
+
+  const bool hex = hasHexPrefix(_str.substr(pos), true);
+  if (hex && !_allowHex)
+  {
+    // Only the leading zero is a number.
+    _value = negative ? -T(0) : T(0);
+    _length = pos + 1;
+    return ParseNumberResult::OK;
+  }
+
+#ifdef SDFORMAT_FLOAT_FROM_CHARS
+  std::chars_format format = std::chars_format::general;
+  if (hex)
+  {
+    pos += 2;
+    format = std::chars_format::hex;
+  }
+
+  const char *begin = _str.data();
+  const auto [ptr, ec] = std::from_chars(
+      begin + pos, begin + _str.size(), _value, format);
+  if (ec == std::errc::invalid_argument)
+  {
+    return ParseNumberResult::INVALID_ARGUMENT;
+  }
+  _length = static_cast<std::size_t>(ptr - begin);
+  if (ec == std::errc::result_out_of_range)
+  {
+    return ParseNumberResult::OUT_OF_RANGE;
+  }
+  if (negative)
+  {
+    _value = -_value;
+  }
+  return ParseNumberResult::OK;
+#else
+  return strtoReal(_str, _value, _length);
+#endif
+}
+}
+
+/////////////////////////////////////////////////
+std::string_view trimView(std::string_view _in)
+{
+  const std::size_t begin = _in.find_first_not_of(" \t\n");
+  if (begin == std::string_view::npos)
+  {
+    return std::string_view();
+  }
+  const std::size_t end = _in.find_last_not_of(" \t\n");
+  return _in.substr(begin, end - begin + 1);
+}
+
+/////////////////////////////////////////////////
+bool equalsIgnoreCase(std::string_view _in, std::string_view _lower)
+{
+  if (_in.size() != _lower.size())
+  {
+    return false;
+  }
+  for (std::size_t i = 0; i < _in.size(); ++i)
+  {
+    const char c = (_in[i] >= 'A' && _in[i] <= 'Z') ?
+        static_cast<char>(_in[i] - 'A' + 'a') : _in[i];
+    if (c != _lower[i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool nextToken(std::string_view &_input, std::string_view &_token)
+{
+  std::size_t begin = 0;
+  while (begin < _input.size() && isSpace(_input[begin]))
+  {
+    ++begin;
+  }
+  std::size_t end = begin;
+  while (end < _input.size() && !isSpace(_input[end]))
+  {
+    ++end;
+  }
+
+  _token = _input.substr(begin, end - begin);
+  _input.remove_prefix(end);
+  return !_token.empty();
+}
+
+/////////////////////////////////////////////////
+ParseNumberResult parseInt(std::string_view _str, int _base, int &_value,
+                           std::size_t &_length)
+{
+  bool negative = false;
+  std::uint64_t magnitude = 0;
+  const ParseNumberResult result =
+      parseMagnitude(_str, _base, negative, magnitude, _length);
+  if (result != ParseNumberResult::OK)
+  {
+    return result;
+  }
+
+  const std::uint64_t limit = negative ?
+      static_cast<std::uint64_t>(std::numeric_limits<int>::max()) + 1u :
+      static_cast<std::uint64_t>(std::numeric_limits<int>::max());
+  if (magnitude > limit)
+  {
+    return ParseNumberResult::OUT_OF_RANGE;
+  }
+
+  _value = negative ?
+      static_cast<int>(-static_cast<std::int64_t>(magnitude)) :
+      static_cast<int>(magnitude);
+  return ParseNumberResult::OK;
+}
+
+/////////////////////////////////////////////////
+ParseNumberResult parseUnsigned(std::string_view _str, int _base,
+                                std::uint64_t _max, std::uint64_t &_value,
+                                std::size_t &_length)
+{
+  bool negative = false;
+  std::uint64_t magnitude = 0;
+  const ParseNumberResult result =
+      parseMagnitude(_str, _base, negative, magnitude, _length);
+  if (result != ParseNumberResult::OK)
+  {
+    return result;
+  }
+  if (magnitude > _max)
+  {
+    return ParseNumberResult::OUT_OF_RANGE;
+  }
+
+  // Negative values wrap around, as they do with strtoul.
+  _value = negative ? (0u - magnitude) & _max : magnitude;
+  return ParseNumberResult::OK;
+}
+
+/////////////////////////////////////////////////
+ParseNumberResult parseReal(std::string_view _str, bool _allowHex,
+                            double &_value, std::size_t &_length)
+{
+  return parseRealImpl(_str, _allowHex, _value, _length);
+}
+
+/////////////////////////////////////////////////
+ParseNumberResult parseReal(std::string_view _str, float &_value,
+                            std::size_t &_length)
+{
+  return parseRealImpl(_str, true, _value, _length);
+}
+}
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDFORMAT_VALUEPARSING_HH
+#define SDFORMAT_VALUEPARSING_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "sdf/sdf_config.h"
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  /// \internal
+  /// \brief Result of parsing a number.
+  enum class ParseNumberResult
+  {
+    /// \brief A number was parsed.
+    OK,
+
+    /// \brief The string does not start with a number.
+    INVALID_ARGUMENT,
+
+    /// \brief The number does not fit in the requested type.
+    OUT_OF_RANGE
+  };
+
+  /// \internal
+  /// \brief Remove leading and trailing spaces, tabs and newlines, like
+  /// sdf::trim, without copying the string.
+  /// \param[in] _in The string to trim.
+  /// \return View of the trimmed part of _in.
+  std::string_view trimView(std::string_view _in);
+
+  /// \internal
+  /// \brief Compare a string with a lowercase string, ignoring the case of
+  /// ASCII letters in the first one.
+  /// \param[in] _in The string to compare.
+  /// \param[in] _lower The lowercase string to compare to.
+  /// \return True if the strings are equal when ignoring case.
+  bool equalsIgnoreCase(std::string_view _in, std::string_view _lower);
+
+  /// \internal
+  /// \brief Extract the next whitespace separated token from a string, like
+  /// reading a std::string from a std::istream.
+  /// \param[in,out] _input The string to read from. The token and the
+  /// whitespace before it are removed from the front.
+  /// \param[out] _token The token.
+  /// \return False if there are no more tokens.
+  bool nextToken(std::string_view &_input, std::string_view &_token);
+
+  /// \internal
+  /// \brief Parse the integer at the start of a string with the same rules
+  /// as std::stoi: an optional sign, an optional 0x prefix in base 16, and
+  /// any characters after the number are ignored.
+  /// \param[in] _str The string, without leading whitespace.
+  /// \param[in] _base The numeric base, 10 or 16.
+  /// \param[out] _value The parsed value.
+  /// \param[out] _length Number of characters used by the number.
+  /// \return Whether a number was parsed.
+  ParseNumberResult parseInt(std::string_view _str, int _base, int &_value,
+                             std::size_t &_length);
+
+  /// \internal
+  /// \brief Parse the unsigned integer at the start of a string with the
+  /// same rules as std::strtoul, including the wrap around of negative
+  /// values.
+  /// \param[in] _str The string, without leading whitespace.
+  /// \param[in] _base The numeric base, 10 or 16.
+  /// \param[in] _max Largest value of the target type, which must be one less
+  /// than a power of two.
+  /// \param[out] _value The parsed value.
+  /// \param[out] _length Number of characters used by the number.
+  /// \return Whether a number was parsed.
+  ParseNumberResult parseUnsigned(std::string_view _str, int _base,
+                                  std::uint64_t _max, std::uint64_t &_value,
+                                  std::size_t &_length);
+
+  /// \internal
+  /// \brief Parse the floating point number at the start of a string,
+  /// independently of the current locale. With _allowHex set, the rules are
+  /// those of std::stod, otherwise hexadecimal numbers are read up to the x,
+  /// like std::istream extraction does.
+  /// \param[in] _str The string, without leading whitespace.
+  /// \param[in] _allowHex True to accept hexadecimal numbers.
+  /// \param[out] _value The parsed value.
+  /// \param[out] _length Number of characters used by the number.
+  /// \return Whether a number was parsed.
+  ParseNumberResult parseReal(std::string_view _str, bool _allowHex,
+                              double &_value, std::size_t &_length);
+
+  /// \internal
+  /// \brief Parse the floating point number at the start of a string,
+  /// independently of the current locale, with the same rules as
+  /// std::stof.
+  /// \param[in] _str The string, without leading whitespace.
+  /// \param[out] _value The parsed value.
+  /// \param[out] _length Number of characters used by the number.
+  /// \return Whether a number was parsed.
+  ParseNumberResult parseReal(std::string_view _str, float &_value,
+                              std::size_t &_length);
+  }
+}
+#endif
@@ -0,0 +1,230 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include "sdf/Element.hh"
+#include "sdf/Param.hh"
+#include "ValueParsing.hh"
+
+/// \brief Number of calls to the global operator new.
+static std::atomic<std::size_t> g_allocationCount{0};
+
+/////////////////////////////////////////////////
+void *operator new(std::size_t _size)
+{
+  ++g_allocationCount;
+  if (void *ptr = std::malloc(_size == 0 ? 1 : _size))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+/////////////////////////////////////////////////
+void operator delete(void *_ptr) noexcept
+{
+  std::free(_ptr);
+}
+
+/////////////////////////////////////////////////
+void operator delete(void *_ptr, std::size_t) noexcept
+{
+  std::free(_ptr);
+}
+
+using sdf::ParseNumberResult;
+
+/////////////////////////////////////////////////
+TEST(ValueParsing, Trim)
+{
+  EXPECT_EQ("a b", sdf::trimView(" \t a b\n "));
+  EXPECT_EQ("", sdf::trimView(" \t\n"));
+  EXPECT_EQ("", sdf::trimView(""));
+
+  EXPECT_TRUE(sdf::equalsIgnoreCase("TrUe", "true"));
+  EXPECT_FALSE(sdf::equalsIgnoreCase("true1", "true"));
+  EXPECT_FALSE(sdf::equalsIgnoreCase("tru", "true"));
+}
+
+/////////////////////////////////////////////////
+TEST(ValueParsing, Tokens)
+{
+  std::string_view input = "  1 22\t333\n";
+  std::string_view token;
+  ASSERT_TRUE(sdf::nextToken(input, token));
+  EXPECT_EQ("1", token);
+  ASSERT_TRUE(sdf::nextToken(input, token));
+  EXPECT_EQ("22", token);
+  ASSERT_TRUE(sdf::nextToken(input, token));
+  EXPECT_EQ("333", token);
+  EXPECT_FALSE(sdf::nextToken(input, token));
+}
+
+/////////////////////////////////////////////////
+TEST(ValueParsing, Int)
+{
+  int value = 0;
+  std::size_t length = 0;
+  EXPECT_EQ(ParseNumberResult::OK, sdf::parseInt("-12abc", 10, value, length));
+  EXPECT_EQ(-12, value);
+  EXPECT_EQ(3u, length);
+
+  EXPECT_EQ(ParseNumberResult::OK, sdf::parseInt("+7", 10, value, length));
+  EXPECT_EQ(7, value);
+
+  EXPECT_EQ(ParseNumberResult::OK, sdf::parseInt("0xff", 16, value, length));
+  EXPECT_EQ(255, value);
+
+  EXPECT_EQ(ParseNumberResult::OK,
+            sdf::parseInt("-2147483648", 10, value, length));
+  EXPECT_EQ(std::numeric_limits<int>::min(), value);
+  EXPECT_EQ(ParseNumberResult::OUT_OF_RANGE,
+            sdf::parseInt("2147483648", 10, value, length));
+
+  EXPECT_EQ(ParseNumberResult::INVALID_ARGUMENT,
+            sdf::parseInt("abc", 10, value, length));
+  EXPECT_EQ(ParseNumberResult::INVALID_ARGUMENT,
+            sdf::parseInt("--1", 10, value, length));
+}
+
+/////////////////////////////////////////////////
+TEST(ValueParsing, Unsigned)
+{
+  std::uint64_t value = 0;
+  std::size_t length = 0;
+  const std::uint64_t max32 = std::numeric_limits<std::uint32_t>::max();
+
+  EXPECT_EQ(ParseNumberResult::OK,
+            sdf::parseUnsigned("0x10", 16, max32, value, length));
+  EXPECT_EQ(16u, value);
+
+  // Negative values wrap around like they do with strtoul
+  EXPECT_EQ(ParseNumberResult::OK,
+            sdf::parseUnsigned("-1", 10, max32, value, length));
+  EXPECT_EQ(max32, value);
+
+  EXPECT_EQ(ParseNumberResult::OUT_OF_RANGE,
+            sdf::parseUnsigned("4294967296", 10, max32, value, length));
+}
+
+/////////////////////////////////////////////////
+TEST(ValueParsing, Real)
+{
+  double value = 0;
+  std::size_t length = 0;
+  EXPECT_EQ(ParseNumberResult::OK,
+            sdf::parseReal("0.125", true, value, length));
+  EXPECT_DOUBLE_EQ(0.125, value);
+  EXPECT_EQ(5u, length);
+
+  EXPECT_EQ(ParseNumberResult::OK,
+            sdf::parseReal("-1.5e2xyz", true, value, length));
+  EXPECT_DOUBLE_EQ(-150.0, value);
+  EXPECT_EQ(6u, length);
+
+  EXPECT_EQ(ParseNumberResult::OK, sdf::parseReal("+Inf", true, value, length));
+  EXPECT_TRUE(std::isinf(value));
+
+  EXPECT_EQ(ParseNumberResult::OK, sdf::parseReal("0X2A", true, value, length));
+  EXPECT_DOUBLE_EQ(42.0, value);
+
+  // Without hexadecimal numbers, only the leading zero is read
+  EXPECT_EQ(ParseNumberResult::OK,
+            sdf::parseReal("0X2A", false, value, length));
+  EXPECT_DOUBLE_EQ(0.0, value);
+  EXPECT_EQ(1u, length);
+
+  EXPECT_EQ(ParseNumberResult::OUT_OF_RANGE,
+            sdf::parseReal("1e1000", true, value, length));
+  EXPECT_EQ(ParseNumberResult::INVALID_ARGUMENT,
+            sdf::parseReal("abc", true, value, length));
+
+  float floatValue = 0;
+  EXPECT_EQ(ParseNumberResult::OK, sdf::parseReal("0.5", floatValue, length));
+  EXPECT_FLOAT_EQ(0.5f, floatValue);
+  EXPECT_EQ(ParseNumberResult::OUT_OF_RANGE,
+            sdf::parseReal("1e100", floatValue, length));
+}
+
+/////////////////////////////////////////////////
+/// \brief Set a parameter from a string repeatedly, and count the
+/// allocations made after the first time.
+/// \param[in] _param Parameter to set.
+/// \param[in] _value String to set the parameter from.
+/// \return Number of allocations.
+static std::size_t allocationsPerSet(sdf::Param &_param,
+                                     const std::string &_value)
+{
+  sdf::Errors errors;
+
+  // The first call may grow the stored string.
+  bool success = _param.SetFromString(_value, errors);
+  const std::size_t before = g_allocationCount;
+  for (int i = 0; i < 10; ++i)
+  {
+    success = _param.SetFromString(_value, errors) && success;
+  }
+  const std::size_t allocations = g_allocationCount - before;
+
+  EXPECT_TRUE(success) << _value;
+  EXPECT_TRUE(errors.empty()) << errors;
+  return allocations;
+}
+
+/////////////////////////////////////////////////
+TEST(ValueParsing, NoAllocations)
+{
+  const std::pair<std::string, std::string> values[] = {
+    {"bool", "true"},
+    {"int", "0x7fffffff"},
+    {"unsigned int", "4000000000"},
+    {"uint64_t", "18446744073709551615"},
+    {"double", "-1.2345678901234567e-8"},
+    {"float", "0.333333333333333"},
+    {"angle", "3.14159265358979323846"},
+    {"color", "0.123456789 0.234567891 0.345678912 0.456789123"},
+    {"vector2i", "-2147483648 2147483647"},
+    {"vector2d", "1.234567890123 9.876543210987"},
+    {"vector3", "1.234567890123 9.876543210987 -5.555555555555"},
+    {"pose", "1.234567890123 9.876543210987 -5.555555555555 "
+             "0.123456789012 0.234567890123 0.345678901234"},
+  };
+
+  for (const auto &[type, value] : values)
+  {
+    sdf::Param param("key", type, value, false);
+    EXPECT_EQ(0u, allocationsPerSet(param, value)) << type;
+  }
+
+  // Poses read the attributes of their parent element
+  sdf::ElementPtr pose(new sdf::Element);
+  pose->SetName("pose");
+  pose->AddAttribute("relative_to", "string", "", false);
+  pose->AddAttribute("degrees", "bool", "true", false);
+  pose->AddAttribute("rotation_format", "string", "euler_rpy", false);
+  pose->AddValue("pose", "0 0 0 0 0 0", true);
+  EXPECT_EQ(0u, allocationsPerSet(*pose->GetValue(),
+      "1.234567890123 9.876543210987 -5.555555555555 90 45 30.000000001"));
+}
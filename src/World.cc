@@ -255,7 +255,7 @@ Errors World::Load(sdf::ElementPtr _sdf, const ParserConfig &_config)
     implicitFrameNames.insert(ifaceModelPair.second->Name());
   }
 
-  for (auto elem = _sdf->GetFirstElement(); elem; elem = elem->GetNextElement())
+  for (const auto &elem : _sdf->Children())
   {
     const std::string elementName = elem->GetName();
     if (elementName == "model")
@@ -0,0 +1,395 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "XmlStreamReader.hh"
+
+using namespace sdf;
+
+/// \brief Elements nested deeper than this are left to tinyxml2, which
+/// limits the depth of documents itself.
+static const std::size_t kMaxDepth = 64;
+
+/////////////////////////////////////////////////
+/// \brief Get whether a character is whitespace, as in tinyxml2.
+/// \param[in] _c Character.
+/// \return True if the character is whitespace.
+static bool isWhiteSpace(char _c)
+{
+  return _c == ' ' || _c == '\t' || _c == '\n' || _c == '\r' ||
+         _c == '\v' || _c == '\f';
+}
+
+/////////////////////////////////////////////////
+/// \brief Get whether a character may start a name, as in tinyxml2.
+/// \param[in] _c Character.
+/// \return True if the character may start a name.
+static bool isNameStartChar(char _c)
+{
+  const unsigned char c = static_cast<unsigned char>(_c);
+  return c >= 128 || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         c == ':' || c == '_';
+}
+
+/////////////////////////////////////////////////
+/// \brief Get whether a character may be part of a name, as in tinyxml2.
+/// \param[in] _c Character.
+/// \return True if the character may be part of a name.
+static bool isNameChar(char _c)
+{
+  return isNameStartChar(_c) || (_c >= '0' && _c <= '9') || _c == '.' ||
+         _c == '-';
+}
+
+/////////////////////////////////////////////////
+const char *XmlStreamElement::Attribute(const char *_name) const
+{
+  for (std::size_t i = 0; i < this->attributeCount; ++i)
+  {
+    if (this->attributes[i].name == _name)
+      return this->attributes[i].value.c_str();
+  }
+  return nullptr;
+}
+
+/////////////////////////////////////////////////
+XmlStreamReader::XmlStreamReader(const char *_data, std::size_t _size)
+  : cursor(_data), end(_data + _size)
+{
+  if (const void *nul = std::memchr(_data, '\0', _size))
+    this->end = static_cast<const char *>(nul);
+
+  // tinyxml2 skips whitespace before the byte order mark
+  this->SkipWhiteSpace();
+  if (this->end - this->cursor >= 3 &&
+      std::memcmp(this->cursor, "\xEF\xBB\xBF", 3) == 0)
+  {
+    this->cursor += 3;
+  }
+}
+
+/////////////////////////////////////////////////
+XmlStreamReader::Token XmlStreamReader::Next()
+{
+  if (this->pendingEnd)
+  {
+    this->pendingEnd = false;
+    return Token::END_ELEMENT;
+  }
+
+  const bool inElement = !this->openElements.empty();
+  const char *start = this->cursor;
+  const int startLine = this->line;
+  this->SkipWhiteSpace();
+
+  if (this->cursor == this->end)
+  {
+    if (inElement || !this->rootRead)
+      return this->Unsupported();
+    return Token::END_OF_DOCUMENT;
+  }
+
+  if (*this->cursor != '<')
+  {
+    if (!inElement)
+      return this->Unsupported();
+    // Leading whitespace is part of the text, and collapsed with it.
+    this->cursor = start;
+    this->line = startLine;
+    return this->ReadText();
+  }
+
+  const std::size_t left = static_cast<std::size_t>(this->end - this->cursor);
+  if (left >= 2 && this->cursor[1] == '?')
+  {
+    // Declarations are only valid before anything else in the document
+    if (inElement || this->declarationsDone)
+      return this->Unsupported();
+    this->cursor += 2;
+    return this->SkipPast("?>") ? Token::OTHER : this->Unsupported();
+  }
+
+  this->declarationsDone = true;
+  if (left >= 4 && std::memcmp(this->cursor, "<!--", 4) == 0)
+  {
+    this->cursor += 4;
+    return this->SkipPast("-->") ? Token::OTHER : this->Unsupported();
+  }
+
+  // CDATA sections and document type declarations
+  if (left >= 2 && this->cursor[1] == '!')
+    return this->Unsupported();
+
+  const int elementLine = this->line;
+  ++this->cursor;
+  this->SkipWhiteSpace();
+  if (this->cursor == this->end)
+    return this->Unsupported();
+
+  if (*this->cursor == '/')
+  {
+    ++this->cursor;
+    return this->ReadEndTag();
+  }
+
+  if (!inElement && this->rootRead)
+    return this->Unsupported();
+  return this->ReadStartTag(elementLine);
+}
+
+/////////////////////////////////////////////////
+const XmlStreamElement &XmlStreamReader::Element() const
+{
+  return this->element;
+}
+
+/////////////////////////////////////////////////
+const std::string &XmlStreamReader::Text() const
+{
+  return this->text;
+}
+
+/////////////////////////////////////////////////
+XmlStreamReader::Token XmlStreamReader::ReadStartTag(int _line)
+{
+  if (this->openElements.size() >= kMaxDepth ||
+      !this->ReadName(this->element.name))
+  {
+    return this->Unsupported();
+  }
+  this->element.lineNumber = _line;
+  this->element.attributeCount = 0;
+  this->rootRead = true;
+
+  while (true)
+  {
+    this->SkipWhiteSpace();
+    if (this->cursor == this->end)
+      return this->Unsupported();
+
+    if (isNameStartChar(*this->cursor))
+    {
+      if (this->element.attributeCount == this->element.attributes.size())
+        this->element.attributes.emplace_back();
+      XmlStreamAttribute &attribute =
+          this->element.attributes[this->element.attributeCount];
+      attribute.lineNumber = this->line;
+      if (!this->ReadName(attribute.name))
+        return this->Unsupported();
+
+      this->SkipWhiteSpace();
+      if (this->cursor == this->end || *this->cursor != '=')
+        return this->Unsupported();
+      ++this->cursor;
+      this->SkipWhiteSpace();
+      if (this->cursor == this->end ||
+          (*this->cursor != '"' && *this->cursor != '\''))
+      {
+        return this->Unsupported();
+      }
+
+      const char quote = *this->cursor++;
+      const char *valueEnd = static_cast<const char *>(std::memchr(
+          this->cursor, quote, this->end - this->cursor));
+      if (valueEnd == nullptr)
+        return this->Unsupported();
+      this->line += static_cast<int>(
+          std::count(this->cursor, valueEnd, '\n'));
+      attribute.value.clear();
+      if (!Decode(this->cursor, valueEnd, false, attribute.value) ||
+          this->element.Attribute(attribute.Name()) != nullptr)
+      {
+        return this->Unsupported();
+      }
+      this->cursor = valueEnd + 1;
+      ++this->element.attributeCount;
+    }
+    else if (*this->cursor == '>')
+    {
+      ++this->cursor;
+      this->openElements.push_back(this->element.name);
+      break;
+    }
+    else if (*this->cursor == '/' && this->end - this->cursor >= 2 &&
+             this->cursor[1] == '>')
+    {
+      this->cursor += 2;
+      this->pendingEnd = true;
+      break;
+    }
+    else
+    {
+      return this->Unsupported();
+    }
+  }
+
+  for (std::size_t i = 0; i < this->element.attributeCount; ++i)
+  {
+    this->element.attributes[i].next =
+        i + 1 < this->element.attributeCount ?
+        &this->element.attributes[i + 1] : nullptr;
+  }
+  return Token::START_ELEMENT;
+}
+
+/////////////////////////////////////////////////
+XmlStreamReader::Token XmlStreamReader::ReadEndTag()
+{
+  std::string name;
+  if (this->openElements.empty() || !this->ReadName(name))
+    return this->Unsupported();
+
+  this->SkipWhiteSpace();
+  if (this->cursor == this->end || *this->cursor != '>' ||
+      name != this->openElements.back())
+  {
+    return this->Unsupported();
+  }
+  ++this->cursor;
+  this->openElements.pop_back();
+  return Token::END_ELEMENT;
+}
+
+/////////////////////////////////////////////////
+XmlStreamReader::Token XmlStreamReader::ReadText()
+{
+  const char *textEnd = static_cast<const char *>(
+      std::memchr(this->cursor, '<', this->end - this->cursor));
+  if (textEnd == nullptr)
+    return this->Unsupported();
+
+  this->line += static_cast<int>(std::count(this->cursor, textEnd, '\n'));
+  this->text.clear();
+  if (!Decode(this->cursor, textEnd, true, this->text) || this->text.empty())
+    return this->Unsupported();
+  this->cursor = textEnd;
+  return Token::TEXT;
+}
+
+/////////////////////////////////////////////////
+XmlStreamReader::Token XmlStreamReader::Unsupported()
+{
+  this->cursor = this->end;
+  this->openElements.clear();
+  this->pendingEnd = false;
+  this->rootRead = false;
+  return Token::UNSUPPORTED;
+}
+
+/////////////////////////////////////////////////
+bool XmlStreamReader::SkipPast(const char *_end)
+{
+  const std::size_t length = std::strlen(_end);
+  const char *found = std::search(this->cursor, this->end, _end, _end + length);
+  this->line += static_cast<int>(std::count(this->cursor, found, '\n'));
+  if (found == this->end)
+  {
+    this->cursor = this->end;
+    return false;
+  }
+  this->cursor = found + length;
+  return true;
+}
+
+/////////////////////////////////////////////////
+void XmlStreamReader::SkipWhiteSpace()
+{
+  while (this->cursor != this->end && isWhiteSpace(*this->cursor))
+  {
+    if (*this->cursor == '\n')
+      ++this->line;
+    ++this->cursor;
+  }
+}
+
+/////////////////////////////////////////////////
+bool XmlStreamReader::ReadName(std::string &_name)
+{
+  if (this->cursor == this->end || !isNameStartChar(*this->cursor))
+    return false;
+
+  const char *start = this->cursor++;
+  while (this->cursor != this->end && isNameChar(*this->cursor))
+    ++this->cursor;
+
+  // tinyxml2 fails on a name at the end of the document
+  if (this->cursor == this->end)
+    return false;
+  _name.assign(start, this->cursor);
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool XmlStreamReader::Decode(const char *_begin, const char *_end,
+                             bool _collapse, std::string &_out)
+{
+  static const struct
+  {
+    const char *pattern;
+    std::size_t length;
+    char value;
+  } kEntities[] = {
+    {"quot;", 5, '"'}, {"amp;", 4, '&'}, {"apos;", 5, '\''},
+    {"lt;", 3, '<'}, {"gt;", 3, '>'}};
+
+  bool space = false;
+  for (const char *p = _begin; p != _end; ++p)
+  {
+    char c = *p;
+    if (c == '&')
+    {
+      // Character references are left to tinyxml2, as are unknown entities,
+      // which it handles inconsistently.
+      bool found = false;
+      for (const auto &entity : kEntities)
+      {
+        if (static_cast<std::size_t>(_end - p - 1) >= entity.length &&
+            std::memcmp(p + 1, entity.pattern, entity.length) == 0)
+        {
+          c = entity.value;
+          p += entity.length;
+          found = true;
+          break;
+        }
+      }
+      if (!found)
+        return false;
+    }
+    else if (_collapse && isWhiteSpace(c))
+    {
+      space = true;
+      continue;
+    }
+    else if (!_collapse && (c == '\r' || c == '\n'))
+    {
+      // CR LF, LF CR and CR alone become LF
+      const char other = c == '\r' ? '\n' : '\r';
+      if (p + 1 != _end && p[1] == other)
+        ++p;
+      c = '\n';
+    }
+
+    if (space && !_out.empty())
+      _out.push_back(' ');
+    space = false;
+    _out.push_back(c);
+  }
+  return true;
+}
@@ -0,0 +1,251 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDFORMAT_XMLSTREAMREADER_HH
+#define SDFORMAT_XMLSTREAMREADER_HH
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "sdf/sdf_config.h"
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  /// \internal
+  /// \brief Attribute of the start tag read last by an XmlStreamReader. It
+  /// has the accessors of tinyxml2::XMLAttribute that the parser uses, so
+  /// that the same code reads attributes from either.
+  class XmlStreamAttribute
+  {
+    /// \brief Get the name of the attribute.
+    /// \return Name of the attribute.
+    public: const char *Name() const
+    {
+      return this->name.c_str();
+    }
+
+    /// \brief Get the value of the attribute, with entities replaced.
+    /// \return Value of the attribute.
+    public: const char *Value() const
+    {
+      return this->value.c_str();
+    }
+
+    /// \brief Get the line of the attribute.
+    /// \return Line number of the name of the attribute.
+    public: int GetLineNum() const
+    {
+      return this->lineNumber;
+    }
+
+    /// \brief Get the next attribute of the element.
+    /// \return The next attribute, or nullptr if this is the last one.
+    public: const XmlStreamAttribute *Next() const
+    {
+      return this->next;
+    }
+
+    /// \brief Name of the attribute.
+    public: std::string name;
+
+    /// \brief Value of the attribute.
+    public: std::string value;
+
+    /// \brief Line number of the attribute.
+    public: int lineNumber = 0;
+
+    /// \brief Next attribute of the element.
+    public: const XmlStreamAttribute *next = nullptr;
+  };
+
+  /// \internal
+  /// \brief Start tag read last by an XmlStreamReader. It has the accessors
+  /// of tinyxml2::XMLElement that are about the element itself, but none
+  /// about its children, which are read after it.
+  class XmlStreamElement
+  {
+    /// \brief Get the name of the element.
+    /// \return Name of the element.
+    public: const char *Value() const
+    {
+      return this->name.c_str();
+    }
+
+    /// \brief Get the line of the element.
+    /// \return Line number of the start tag.
+    public: int GetLineNum() const
+    {
+      return this->lineNumber;
+    }
+
+    /// \brief Get the first attribute of the element.
+    /// \return The first attribute, or nullptr if there is none.
+    public: const XmlStreamAttribute *FirstAttribute() const
+    {
+      return this->attributeCount > 0 ? &this->attributes[0] : nullptr;
+    }
+
+    /// \brief Get the value of an attribute.
+    /// \param[in] _name Name of the attribute.
+    /// \return Value of the attribute, or nullptr if there is none.
+    public: const char *Attribute(const char *_name) const;
+
+    /// \brief Name of the element.
+    public: std::string name;
+
+    /// \brief Line number of the start tag.
+    public: int lineNumber = 0;
+
+    /// \brief Attributes of the element. Only the first attributeCount are
+    /// in use, so that their storage is reused from one tag to the next.
+    public: std::vector<XmlStreamAttribute> attributes;
+
+    /// \brief Number of attributes of the element.
+    public: std::size_t attributeCount = 0;
+  };
+
+  /// \internal
+  /// \brief Reads an XML document one node at a time, without building a
+  /// tree, with the whitespace handling of a tinyxml2::XMLDocument in
+  /// COLLAPSE_WHITESPACE mode. Text is collapsed, predefined entities are
+  /// replaced, and line numbers are those reported by tinyxml2.
+  ///
+  /// The reader only accepts the documents that it is sure to read exactly
+  /// like tinyxml2: a single root element, with optional declarations and
+  /// comments around it. Anything else, including malformed XML, CDATA
+  /// sections, document type declarations and character references, ends
+  /// the document with Token::UNSUPPORTED, so that the caller can parse it
+  /// with tinyxml2 instead and report the same result and errors.
+  class XmlStreamReader
+  {
+    /// \brief Kind of node read by Next.
+    public: enum class Token
+    {
+      /// \brief A start tag. An empty element tag is read as a start tag
+      /// followed by an end tag.
+      START_ELEMENT,
+
+      /// \brief An end tag.
+      END_ELEMENT,
+
+      /// \brief Text, which is never empty.
+      TEXT,
+
+      /// \brief A comment or a declaration.
+      OTHER,
+
+      /// \brief The end of the document.
+      END_OF_DOCUMENT,
+
+      /// \brief A node that cannot be read, or malformed XML. The reader
+      /// stays at the end of the document.
+      UNSUPPORTED
+    };
+
+    /// \brief Constructor. The document ends at the first null character,
+    /// as it does for tinyxml2::XMLDocument::Parse.
+    /// \param[in] _data Content of the document, which must outlive the
+    /// reader.
+    /// \param[in] _size Size of the content in bytes.
+    public: XmlStreamReader(const char *_data, std::size_t _size);
+
+    /// \brief Read the next node.
+    /// \return Kind of the node.
+    public: Token Next();
+
+    /// \brief Get the last start tag.
+    /// \return The element of the last Token::START_ELEMENT.
+    public: const XmlStreamElement &Element() const;
+
+    /// \brief Get the last text.
+    /// \return Text of the last Token::TEXT.
+    public: const std::string &Text() const;
+
+    /// \brief Read a start tag, from its name.
+    /// \param[in] _line Line number of the '<' of the tag.
+    /// \return Kind of the node.
+    private: Token ReadStartTag(int _line);
+
+    /// \brief Read an end tag, after its "</".
+    /// \return Kind of the node.
+    private: Token ReadEndTag();
+
+    /// \brief Read text up to the next '<'.
+    /// \return Kind of the node.
+    private: Token ReadText();
+
+    /// \brief Stop reading the document.
+    /// \return Token::UNSUPPORTED.
+    private: Token Unsupported();
+
+    /// \brief Skip to the end of a comment or a declaration.
+    /// \param[in] _end Delimiter at the end of the node.
+    /// \return True if the delimiter was found.
+    private: bool SkipPast(const char *_end);
+
+    /// \brief Skip whitespace, counting lines.
+    private: void SkipWhiteSpace();
+
+    /// \brief Read a name.
+    /// \param[out] _name The name.
+    /// \return True if a name was read.
+    private: bool ReadName(std::string &_name);
+
+    /// \brief Append characters with entities replaced.
+    /// \param[in] _begin First character.
+    /// \param[in] _end Past the last character.
+    /// \param[in] _collapse True to collapse whitespace as in text, false to
+    /// normalize line endings as in attribute values.
+    /// \param[out] _out String to append to.
+    /// \return False if there is an entity that cannot be replaced.
+    private: static bool Decode(const char *_begin, const char *_end,
+                                bool _collapse, std::string &_out);
+
+    /// \brief Next character to read.
+    private: const char *cursor;
+
+    /// \brief End of the document.
+    private: const char *end;
+
+    /// \brief Current line number.
+    private: int line = 1;
+
+    /// \brief Names of the open elements.
+    private: std::vector<std::string> openElements;
+
+    /// \brief True if the last start tag was an empty element tag whose end
+    /// has not been returned yet.
+    private: bool pendingEnd = false;
+
+    /// \brief True once the root element was read.
+    private: bool rootRead = false;
+
+    /// \brief True once a node other than a declaration was read.
+    private: bool declarationsDone = false;
+
+    /// \brief The last start tag.
+    private: XmlStreamElement element;
+
+    /// \brief The last text.
+    private: std::string text;
+  };
+  }
+}
+#endif
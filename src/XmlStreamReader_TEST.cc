@@ -0,0 +1,144 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "XmlStreamReader.hh"
+
+using Token = sdf::XmlStreamReader::Token;
+
+/////////////////////////////////////////////////
+/// \brief Read every node of a document.
+/// \param[in] _xml The document.
+/// \return The last token, which ends the document.
+static Token readAll(const std::string &_xml)
+{
+  sdf::XmlStreamReader reader(_xml.c_str(), _xml.size());
+  Token token;
+  while ((token = reader.Next()) != Token::END_OF_DOCUMENT &&
+         token != Token::UNSUPPORTED)
+  {
+  }
+  return token;
+}
+
+/////////////////////////////////////////////////
+TEST(XmlStreamReader, Nodes)
+{
+  const std::string xml =
+      "<?xml version='1.0'?>\n"
+      "<!-- comment -->\n"
+      "<sdf version='1.12'>\n"
+      "  <model name=\"a&amp;b\"\n"
+      "         static = 'true'>\n"
+      "    <pose>  1   2\n 3 &lt;0&gt; </pose>\n"
+      "    <link name='link'/>\n"
+      "  </model>\n"
+      "</sdf>\n"
+      "<!-- trailing -->\n";
+  sdf::XmlStreamReader reader(xml.c_str(), xml.size());
+
+  EXPECT_EQ(Token::OTHER, reader.Next());
+  EXPECT_EQ(Token::OTHER, reader.Next());
+
+  ASSERT_EQ(Token::START_ELEMENT, reader.Next());
+  EXPECT_STREQ("sdf", reader.Element().Value());
+  EXPECT_EQ(3, reader.Element().GetLineNum());
+  EXPECT_STREQ("1.12", reader.Element().Attribute("version"));
+
+  ASSERT_EQ(Token::START_ELEMENT, reader.Next());
+  const sdf::XmlStreamElement &model = reader.Element();
+  EXPECT_STREQ("model", model.Value());
+  EXPECT_EQ(4, model.GetLineNum());
+  const sdf::XmlStreamAttribute *attribute = model.FirstAttribute();
+  ASSERT_NE(nullptr, attribute);
+  EXPECT_STREQ("name", attribute->Name());
+  EXPECT_STREQ("a&b", attribute->Value());
+  EXPECT_EQ(4, attribute->GetLineNum());
+  attribute = attribute->Next();
+  ASSERT_NE(nullptr, attribute);
+  EXPECT_STREQ("static", attribute->Name());
+  EXPECT_STREQ("true", attribute->Value());
+  EXPECT_EQ(5, attribute->GetLineNum());
+  EXPECT_EQ(nullptr, attribute->Next());
+  EXPECT_EQ(nullptr, model.Attribute("missing"));
+
+  ASSERT_EQ(Token::START_ELEMENT, reader.Next());
+  EXPECT_STREQ("pose", reader.Element().Value());
+  EXPECT_EQ(6, reader.Element().GetLineNum());
+  EXPECT_EQ(nullptr, reader.Element().FirstAttribute());
+  ASSERT_EQ(Token::TEXT, reader.Next());
+  EXPECT_EQ("1 2 3 <0>", reader.Text());
+  EXPECT_EQ(Token::END_ELEMENT, reader.Next());
+
+  ASSERT_EQ(Token::START_ELEMENT, reader.Next());
+  EXPECT_STREQ("link", reader.Element().Value());
+  EXPECT_EQ(8, reader.Element().GetLineNum());
+  EXPECT_EQ(Token::END_ELEMENT, reader.Next());
+
+  EXPECT_EQ(Token::END_ELEMENT, reader.Next());
+  EXPECT_EQ(Token::END_ELEMENT, reader.Next());
+  EXPECT_EQ(Token::OTHER, reader.Next());
+  EXPECT_EQ(Token::END_OF_DOCUMENT, reader.Next());
+  EXPECT_EQ(Token::END_OF_DOCUMENT, reader.Next());
+}
+
+/////////////////////////////////////////////////
+TEST(XmlStreamReader, LineEndings)
+{
+  const std::string xml = "\xEF\xBB\xBF<a b='1\r\n2\n\r3\r4'>\r\n<c/></a>";
+  sdf::XmlStreamReader reader(xml.c_str(), xml.size());
+  ASSERT_EQ(Token::START_ELEMENT, reader.Next());
+  EXPECT_STREQ("1\n2\n3\n4", reader.Element().Attribute("b"));
+  ASSERT_EQ(Token::START_ELEMENT, reader.Next());
+  EXPECT_EQ(4, reader.Element().GetLineNum());
+}
+
+/////////////////////////////////////////////////
+TEST(XmlStreamReader, Unsupported)
+{
+  EXPECT_EQ(Token::END_OF_DOCUMENT, readAll("<a><b>x</b></a>"));
+  EXPECT_EQ(Token::END_OF_DOCUMENT, readAll(std::string("<a>x</a>\0<b>", 12)));
+
+  // Malformed documents
+  EXPECT_EQ(Token::UNSUPPORTED, readAll(""));
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("<a><b></a>"));
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("<a>"));
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("<a x='1' x='2'/>"));
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("<a x=1/>"));
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("<a>text"));
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("<a/><!-- x"));
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("</a>"));
+
+  // Documents that tinyxml2 reads in ways that are not reproduced
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("<a/><b/>"));
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("<a/>text"));
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("<a><![CDATA[x]]></a>"));
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("<!DOCTYPE a><a/>"));
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("<a>&#65;</a>"));
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("<a>&unknown;</a>"));
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("<!-- x --><?xml?><a/>"));
+  EXPECT_EQ(Token::UNSUPPORTED, readAll("<a><?pi?></a>"));
+
+  std::string deep;
+  for (int i = 0; i < 100; ++i)
+    deep += "<a>";
+  for (int i = 0; i < 100; ++i)
+    deep += "</a>";
+  EXPECT_EQ(Token::UNSUPPORTED, readAll(deep));
+}
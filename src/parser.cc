@@ -15,22 +15,37 @@
  *
  */
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <gz/math/SemanticVersion.hh>
 
 #include "sdf/Console.hh"
+#include "sdf/ConversionCache.hh"
 #include "sdf/Filesystem.hh"
 #include "sdf/Frame.hh"
+#include "sdf/IncludeCache.hh"
 #include "sdf/Joint.hh"
 #include "sdf/JointAxis.hh"
 #include "sdf/Link.hh"
 #include "sdf/Model.hh"
+#include "sdf/ModelIndex.hh"
 #include "sdf/Param.hh"
 #include "sdf/Root.hh"
 #include "sdf/SDFImpl.hh"
@@ -40,10 +55,13 @@
 #include "sdf/sdf_config.h"
 
 #include "Converter.hh"
+#include "DocumentArena.hh"
+#include "EmbeddedSdf.hh"
 #include "FrameSemantics.hh"
 #include "ParamPassing.hh"
 #include "ScopedGraph.hh"
 #include "Utils.hh"
+#include "XmlStreamReader.hh"
 #include "parser_private.hh"
 #include "parser_urdf.hh"
 
@@ -126,6 +144,37 @@ bool readStringInternal(
     SDFPtr _sdf,
     Errors &_errors);
 
+/// \brief Result of reading a document with an XmlStreamReader.
+enum class StreamReadResult
+{
+  /// \brief The document was read.
+  READ,
+
+  /// \brief The document was read, with errors that make reading fail.
+  FAILED,
+
+  /// \brief The document needs to be parsed by tinyxml2. Nothing was read.
+  UNSUPPORTED
+};
+
+/// \brief Internal helper for readFileInternal and readStringInternal,
+/// which reads an SDFormat document with an XmlStreamReader, building
+/// Elements as the XML is read instead of parsing it into a
+/// tinyxml2::XMLDocument first. The result and errors are those of readDoc.
+/// Documents that need random access to their XML, such as those with
+/// <include> tags or that need to be converted, are left to readDoc.
+/// \param[in] _data Content of the document.
+/// \param[in] _size Size of the content in bytes.
+/// \param[out] _sdf Pointer to an SDF object.
+/// \param[in] _source Source of the document.
+/// \param[in] _convert Convert to the latest version if true.
+/// \param[in] _config Custom parser configuration
+/// \param[out] _errors Parsing errors will be appended to this variable.
+/// \return Whether the document was read.
+static StreamReadResult readDocStream(const char *_data, std::size_t _size,
+    SDFPtr _sdf, const std::string &_source, bool _convert,
+    const ParserConfig &_config, Errors &_errors);
+
 //////////////////////////////////////////////////
 /// \brief Internal helper for creating XMLDocuments
 ///
@@ -154,6 +203,100 @@ static bool isSdfFile(const std::string &_fileName)
   return false;
 }
 
+//////////////////////////////////////////////////
+/// \brief Find a spec file in the embedded schema tables.
+/// \param[in] _filename Name of the spec file, such as "model.sdf".
+/// \return The file, or nullptr if the tables are not for the current SDF
+/// version or do not contain the file.
+static const EmbeddedSchemaFile *findSchemaFile(const std::string &_filename)
+{
+  const EmbeddedSchema &schema = GetEmbeddedSchema();
+  if (SDF::Version() != schema.version)
+  {
+    return nullptr;
+  }
+
+  const EmbeddedSchemaFile *end = schema.files + schema.fileCount;
+  const EmbeddedSchemaFile *file = std::lower_bound(schema.files, end,
+      _filename.c_str(),
+      [](const EmbeddedSchemaFile &_file, const char *_name)
+      {
+        return std::strcmp(_file.name, _name) < 0;
+      });
+  if (file == end || _filename != file->name)
+  {
+    return nullptr;
+  }
+  return file;
+}
+
+//////////////////////////////////////////////////
+/// \brief Initialize an element description from the embedded schema
+/// tables. This is the table counterpart of initXml, and gives the same
+/// element descriptions for the spec files the tables were generated from,
+/// without parsing any XML.
+/// \param[out] _errors Captures errors found while initializing.
+/// \param[in,out] _sdf Element to initialize.
+/// \param[in] _index Index of the element in the schema tables.
+/// \return True on success.
+static bool initSchemaElement(sdf::Errors &_errors, ElementPtr _sdf,
+                              std::size_t _index)
+{
+  const EmbeddedSchema &schema = GetEmbeddedSchema();
+  const EmbeddedSchemaElement &desc = schema.elements[_index];
+
+  if (desc.referenceSdf)
+  {
+    _sdf->SetReferenceSDF(desc.referenceSdf);
+  }
+  _sdf->SetName(desc.name);
+  _sdf->SetRequired(desc.required);
+
+  if (desc.type)
+  {
+    _sdf->AddValue(desc.type, desc.defaultValue, desc.valueRequired,
+                   desc.minValue, desc.maxValue, _errors,
+                   desc.description ? desc.description : "");
+  }
+
+  for (std::size_t i = desc.firstAttribute;
+       i < desc.firstAttribute + desc.attributeCount; ++i)
+  {
+    const EmbeddedSchemaAttribute &attribute = schema.attributes[i];
+    _sdf->AddAttribute(attribute.name, attribute.type,
+                       attribute.defaultValue, attribute.required, _errors,
+                       attribute.description);
+  }
+
+  if (desc.description)
+  {
+    _sdf->SetDescription(desc.description);
+  }
+
+  if (desc.copyChildren)
+  {
+    _sdf->SetCopyChildren(true);
+  }
+
+  for (std::size_t i = desc.firstChild;
+       i < desc.firstChild + desc.childCount; ++i)
+  {
+    const EmbeddedSchemaChild &child = schema.children[i];
+    ElementPtr element(new Element);
+    initSchemaElement(_errors, element, child.element);
+
+    // override description for included elements
+    if (child.description)
+    {
+      element->SetDescription(child.description);
+    }
+
+    _sdf->AddElementDescription(element);
+  }
+
+  return true;
+}
+
 //////////////////////////////////////////////////
 template <typename TPtr>
 static inline bool _initFile(const std::string &_filename,
@@ -424,9 +567,75 @@ bool init(SDFPtr _sdf, const ParserConfig &_config)
 
 }
 
+//////////////////////////////////////////////////
+/// \brief Get the immutable root schema prototype for the current SDF
+/// version, building it on first use.
+///
+/// The prototype is built from the schema tables generated at build time
+/// when they match the current version, and from the embedded spec files
+/// otherwise. Neither consults the ParserConfig (file lookup is only used for
+/// spec files that are not embedded), so one prototype per SDF version is
+/// shared by all configs. Versions that are not embedded bypass the cache.
+/// \param[in] _config Custom parser configuration
+/// \return The cached prototype, or nullptr if it could not be built and
+/// the caller should fall back to parsing the spec directly, which will
+/// report any errors.
+static ElementPtr schemaPrototype(const ParserConfig &_config)
+{
+  static std::mutex prototypeMutex;
+  static std::map<std::string, ElementPtr> prototypes;
+
+  const std::string version = SDF::Version();
+  if (GetEmbeddedSdf().count(version + "/root.sdf") == 0)
+  {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(prototypeMutex);
+  auto it = prototypes.find(version);
+  if (it != prototypes.end())
+  {
+    return it->second;
+  }
+
+  // The prototype outlives every document, so it must not be placed in the
+  // arena of the document that happens to be parsed first.
+  DocumentArenaScope heapScope(nullptr);
+
+  sdf::Errors buildErrors;
+  ElementPtr prototype(new Element);
+  if (const EmbeddedSchemaFile *file = findSchemaFile("root.sdf"))
+  {
+    initSchemaElement(buildErrors, prototype, file->element);
+  }
+  else
+  {
+    auto xmlDoc = makeSdfDoc();
+    xmlDoc.Parse(SDF::EmbeddedSpec("root.sdf", false).c_str());
+    initDoc(buildErrors, prototype, &xmlDoc, _config);
+  }
+
+  if (!buildErrors.empty())
+  {
+    return nullptr;
+  }
+
+  prototypes[version] = prototype;
+  return prototype;
+}
+
 //////////////////////////////////////////////////
 bool init(sdf::Errors &_errors, SDFPtr _sdf, const ParserConfig &_config)
 {
+  ElementPtr prototype = schemaPrototype(_config);
+  if (prototype)
+  {
+    DocumentArenaScope arenaScope(
+        DocumentArena::ForDocument(_config.UseDocumentArena()));
+    _sdf->SetRoot(prototype->Clone(_errors));
+    return true;
+  }
+
   std::string xmldata = SDF::EmbeddedSpec("root.sdf", false);
   auto xmlDoc = makeSdfDoc();
   xmlDoc.Parse(xmldata.c_str());
@@ -453,6 +662,11 @@ bool initFile(const std::string &_filename, const ParserConfig &_config,
 bool initFile(const std::string &_filename, const ParserConfig &_config,
               SDFPtr _sdf, sdf::Errors &_errors)
 {
+  if (const EmbeddedSchemaFile *file = findSchemaFile(_filename))
+  {
+    return initSchemaElement(_errors, _sdf->Root(), file->element);
+  }
+
   std::string xmldata = SDF::EmbeddedSpec(_filename, true);
   if (!xmldata.empty())
   {
@@ -484,6 +698,11 @@ bool initFile(
 bool initFile(const std::string &_filename, const ParserConfig &_config,
               ElementPtr _sdf, sdf::Errors &_errors)
 {
+  if (const EmbeddedSchemaFile *file = findSchemaFile(_filename))
+  {
+    return initSchemaElement(_errors, _sdf, file->element);
+  }
+
   std::string xmldata = SDF::EmbeddedSpec(_filename, true);
   if (!xmldata.empty())
   {
@@ -815,6 +1034,57 @@ bool readFileWithoutConversion(const std::string &_filename,
   return readFileInternal(_filename, false, _config, _sdf, _errors);
 }
 
+//////////////////////////////////////////////////
+/// \brief Parse a document for conversion from URDF if its root element is
+/// <robot>. The root element is found with an XmlStreamReader, so that
+/// other documents are not parsed here, and URDF documents are parsed once
+/// for both detection and conversion.
+/// \param[in] _data Content of the document.
+/// \param[in] _size Size of the content in bytes.
+/// \param[out] _urdfXml Parsed URDF document.
+/// \return True if the document is a URDF document that was parsed without
+/// errors.
+static bool parseUrdfDoc(const char *_data, std::size_t _size,
+                         tinyxml2::XMLDocument &_urdfXml)
+{
+  XmlStreamReader reader(_data, _size);
+  XmlStreamReader::Token token = reader.Next();
+  while (token == XmlStreamReader::Token::OTHER)
+    token = reader.Next();
+  if (token != XmlStreamReader::Token::START_ELEMENT ||
+      reader.Element().name != "robot")
+  {
+    return false;
+  }
+
+  // Malformed documents, and documents that also have an <sdf> element, go
+  // through the same path as any other document.
+  return _urdfXml.Parse(_data, _size) == tinyxml2::XML_SUCCESS &&
+         _urdfXml.FirstChildElement("sdf") == nullptr;
+}
+
+//////////////////////////////////////////////////
+/// \brief Read the content of a file with a single read into a buffer of
+/// the size of the file.
+/// \param[in] _filename Path of the file.
+/// \param[out] _contents Content of the file.
+/// \return True if the whole file was read.
+static bool readFileContents(const std::string &_filename,
+                             std::string &_contents)
+{
+  std::ifstream stream(_filename, std::ios::binary | std::ios::ate);
+  if (!stream)
+    return false;
+
+  const std::streamoff length = stream.tellg();
+  if (length < 0 || !stream.seekg(0))
+    return false;
+
+  _contents.resize(static_cast<std::size_t>(length));
+  stream.read(_contents.data(), length);
+  return stream.gcount() == length;
+}
+
 //////////////////////////////////////////////////
 bool readFileInternal(const std::string &_filename, const bool _convert,
     const ParserConfig &_config, SDFPtr _sdf, Errors &_errors)
@@ -841,49 +1111,89 @@ bool readFileInternal(const std::string &_filename, const bool _convert,
     return false;
   }
 
-  auto error_code = xmlDoc.LoadFile(filename.c_str());
-  if (error_code)
+  // The content of the file is read once, to look up the conversion cache,
+  // to detect URDF and to stream the file, and parsed from memory after
+  // that.
+  const std::shared_ptr<ConversionCache> conversionCache =
+      _convert ? _config.ConversionCache() : nullptr;
+  std::string contents;
+  const char *data = nullptr;
+  std::size_t size = 0;
+  if (readFileContents(filename, contents))
   {
-    _errors.push_back({ErrorCode::FILE_READ, "Error parsing XML in file [" +
-                      std::string(filename) + "]: " +
-                      std::string(xmlDoc.ErrorStr())});
-    return false;
+    data = contents.data();
+    size = contents.size();
   }
 
-  tinyxml2::XMLElement *sdfXml = xmlDoc.FirstChildElement("sdf");
-  if (sdfXml)
+  if (conversionCache && data &&
+      conversionCache->Find(filename, data, size, _config, _sdf))
   {
-    // Suppress deprecation for sdf::URDF2SDF
-    return readDoc(&xmlDoc, _sdf, filename, _convert, _config, _errors);
+    return true;
   }
-  else
+
+  if (_config.UseStreamingReader() && data)
   {
-    tinyxml2::XMLElement *robotXml = xmlDoc.FirstChildElement("robot");
-    if (robotXml)
+    const StreamReadResult result = readDocStream(data, size, _sdf,
+        filename, _convert, _config, _errors);
+    if (result != StreamReadResult::UNSUPPORTED)
+      return result == StreamReadResult::READ;
+  }
+
+  tinyxml2::XMLDocument urdfXml;
+  const bool parsedUrdf = data && parseUrdfDoc(data, size, urdfXml);
+  if (!parsedUrdf)
+  {
+    auto error_code = data ? xmlDoc.Parse(data, size) :
+        xmlDoc.LoadFile(filename.c_str());
+    if (error_code)
     {
-      URDF2SDF u2g;
-      auto doc = makeSdfDoc();
-      u2g.InitModelFile(filename, _config, &doc);
-      if (sdf::readDoc(&doc, _sdf, filename, _convert, _config, _errors))
-      {
-        sdfdbg << "Converting URDF file [" << _filename << "] to SDFormat"
-               << " and parsing it.\n";
-        return true;
-      }
-      else
-      {
-        _errors.push_back({ErrorCode::PARSING_ERROR,
-            "Failed to parse the URDF file after converting to SDFormat."});
+      _errors.push_back({ErrorCode::FILE_READ, "Error parsing XML in file [" +
+                        std::string(filename) + "]: " +
+                        std::string(xmlDoc.ErrorStr())});
+      return false;
+    }
+
+    tinyxml2::XMLElement *sdfXml = xmlDoc.FirstChildElement("sdf");
+    if (sdfXml)
+    {
+      const std::size_t firstError = _errors.size();
+      if (!readDoc(&xmlDoc, _sdf, filename, _convert, _config, _errors))
         return false;
-      }
+
+      // Only documents that are read without errors are cached.
+      if (conversionCache && _errors.size() == firstError)
+        conversionCache->Insert(filename, data, size, _config, _sdf);
+      return true;
+    }
+  }
+
+  if (parsedUrdf || xmlDoc.FirstChildElement("robot"))
+  {
+    URDF2SDF u2g;
+    auto doc = makeSdfDoc();
+    if (parsedUrdf)
+      u2g.InitModel(urdfXml, std::string(data, size), _config, &doc);
+    else
+      u2g.InitModelFile(filename, _config, &doc);
+    if (sdf::readDoc(&doc, _sdf, filename, _convert, _config, _errors))
+    {
+      sdfdbg << "Converting URDF file [" << _filename << "] to SDFormat"
+             << " and parsing it.\n";
+      return true;
     }
     else
     {
       _errors.push_back({ErrorCode::PARSING_ERROR,
-          "XML does not seem to be an SDFormat or an URDF file."});
+          "Failed to parse the URDF file after converting to SDFormat."});
       return false;
     }
   }
+  else
+  {
+    _errors.push_back({ErrorCode::PARSING_ERROR,
+        "XML does not seem to be an SDFormat or an URDF file."});
+    return false;
+  }
 
   return false;
 }
@@ -933,50 +1243,65 @@ bool readStringWithoutConversion(const std::string &_filename,
 bool readStringInternal(const std::string &_xmlString, const bool _convert,
     const ParserConfig &_config, SDFPtr _sdf, Errors &_errors)
 {
-  auto xmlDoc = makeSdfDoc();
-  xmlDoc.Parse(_xmlString.c_str());
-  if (xmlDoc.Error())
+  if (_config.UseStreamingReader())
   {
-    _errors.push_back({ErrorCode::STRING_READ,
-                      "Error parsing XML from string: " +
-                      std::string(xmlDoc.ErrorStr())});
-    return false;
+    const StreamReadResult result = readDocStream(_xmlString.data(),
+        _xmlString.size(), _sdf, std::string(kSdfStringSource), _convert,
+        _config, _errors);
+    if (result != StreamReadResult::UNSUPPORTED)
+      return result == StreamReadResult::READ;
   }
-  tinyxml2::XMLElement *sdfXml = xmlDoc.FirstChildElement("sdf");
-  if (sdfXml)
+
+  auto xmlDoc = makeSdfDoc();
+  tinyxml2::XMLDocument urdfXml;
+  const bool parsedUrdf =
+      parseUrdfDoc(_xmlString.c_str(), _xmlString.size(), urdfXml);
+  if (!parsedUrdf)
   {
-    return readDoc(&xmlDoc, _sdf, std::string(kSdfStringSource), _convert,
-                   _config, _errors);
+    xmlDoc.Parse(_xmlString.c_str());
+    if (xmlDoc.Error())
+    {
+      _errors.push_back({ErrorCode::STRING_READ,
+                        "Error parsing XML from string: " +
+                        std::string(xmlDoc.ErrorStr())});
+      return false;
+    }
+    tinyxml2::XMLElement *sdfXml = xmlDoc.FirstChildElement("sdf");
+    if (sdfXml)
+    {
+      return readDoc(&xmlDoc, _sdf, std::string(kSdfStringSource), _convert,
+                     _config, _errors);
+    }
   }
-  else
+
+  if (parsedUrdf || xmlDoc.FirstChildElement("robot"))
   {
-    tinyxml2::XMLElement *robotXml = xmlDoc.FirstChildElement("robot");
-    if (robotXml)
-    {
-      URDF2SDF u2g;
-      auto doc = makeSdfDoc();
+    URDF2SDF u2g;
+    auto doc = makeSdfDoc();
+    if (parsedUrdf)
+      u2g.InitModel(urdfXml, _xmlString, _config, &doc);
+    else
       u2g.InitModelString(_xmlString, _config, &doc);
 
-      if (sdf::readDoc(&doc, _sdf, std::string(kUrdfStringSource), _convert,
-                      _config, _errors))
-      {
-        sdfdbg << "Converting URDF to SDFormat and parsing it.\n";
-        return true;
-      }
-      else
-      {
-        _errors.push_back({ErrorCode::PARSING_ERROR,
-            "Failed to parse the URDF file after converting to SDFormat."});
-        return false;
-      }
+    if (sdf::readDoc(&doc, _sdf, std::string(kUrdfStringSource), _convert,
+                    _config, _errors))
+    {
+      sdfdbg << "Converting URDF to SDFormat and parsing it.\n";
+      return true;
     }
     else
     {
       _errors.push_back({ErrorCode::PARSING_ERROR,
-          "XML does not seem to be an SDFormat or an URDF string."});
+          "Failed to parse the URDF file after converting to SDFormat."});
       return false;
     }
   }
+  else
+  {
+    _errors.push_back({ErrorCode::PARSING_ERROR,
+        "XML does not seem to be an SDFormat or an URDF string."});
+    return false;
+  }
   return false;
 }
 
@@ -1031,6 +1356,9 @@ bool readDoc(tinyxml2::XMLDocument *_xmlDoc, SDFPtr _sdf,
     const std::string &_source, bool _convert, const ParserConfig &_config,
     Errors &_errors)
 {
+  DocumentArenaScope arenaScope(DocumentArena::ForDocument(
+      _config.UseDocumentArena(), _sdf ? _sdf->Root().get() : nullptr));
+
   if (!_xmlDoc)
   {
     _errors.push_back({ErrorCode::WARNING, "Could not parse the xml"
@@ -1133,6 +1461,9 @@ bool readDoc(tinyxml2::XMLDocument *_xmlDoc, ElementPtr _sdf,
     const std::string &_source, bool _convert, const ParserConfig &_config,
     Errors &_errors)
 {
+  DocumentArenaScope arenaScope(
+      DocumentArena::ForDocument(_config.UseDocumentArena(), _sdf.get()));
+
   if (!_xmlDoc)
   {
     _errors.push_back({ErrorCode::WARNING, "Could not parse the xml."});
@@ -1405,13 +1736,15 @@ std::string getModelFilePath(sdf::Errors &_errors,
 //////////////////////////////////////////////////
 /// Helper function that reads all the attributes of an element from TinyXML to
 /// sdf::Element.
-/// \param[in] _xml Pointer to XML element to read the attributes from.
+/// \param[in] _xml Pointer to XML element to read the attributes from, which
+/// is either a tinyxml2::XMLElement or an XmlStreamElement.
 /// \param[in,out] _sdf sdf::Element pointer to parse the attribute data into.
 /// \param[in] _config Custom parser configuration
 /// \param[in] _errorSourcePath Source of the XML document.
 /// \param[out] _errors Captures errors found during parsing.
 /// \return True on success, false on error.
-static bool readAttributes(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
+template <typename XmlElementT>
+static bool readAttributes(const XmlElementT *_xml, ElementPtr _sdf,
     const ParserConfig &_config, const std::string &_errorSourcePath,
     Errors &_errors)
 {
@@ -1429,7 +1762,7 @@ static bool readAttributes(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
       // //sensor/imu/orientation_reference_frame/custom_rpy/[@parent_frame]
       {"custom_rpy", "parent_frame"}};
 
-  const tinyxml2::XMLAttribute *attribute = _xml->FirstAttribute();
+  auto *attribute = _xml->FirstAttribute();
 
   unsigned int i = 0;
 
@@ -1558,7 +1891,16 @@ static bool resolveFileNameFromUri(tinyxml2::XMLElement *_includeXml,
     }
     else
     {
-      if (sdf::filesystem::is_directory(modelPath))
+      // The model files of indexed model directories are known without
+      // reading their model.config.
+      const std::shared_ptr<ModelIndex> modelIndex = _config.ModelIndex();
+      const std::string indexedFileName =
+          modelIndex ? modelIndex->ModelFile(modelPath) : std::string();
+      if (!indexedFileName.empty())
+      {
+        _fileName = indexedFileName;
+      }
+      else if (sdf::filesystem::is_directory(modelPath))
       {
         // Get the model.config filename
         _fileName = getModelFilePath(_errors, modelPath);
@@ -1634,8 +1976,211 @@ static void validateIncludeElement(tinyxml2::XMLElement *_xml,
 }
 
 //////////////////////////////////////////////////
-bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
-    const ParserConfig &_config, const std::string &_source, Errors &_errors)
+/// \brief Read a file referenced by an <include> element. Files that were
+/// already read are cloned from the include cache of the configuration,
+/// along with the errors that were reported when reading them.
+/// \param[in] _filename Resolved path of the file.
+/// \param[in] _config Custom parser configuration
+/// \param[out] _sdf Document the file is read into.
+/// \param[out] _errors Captures errors found during parsing.
+/// \return True if the file was read.
+static bool readIncludedFile(const std::string &_filename,
+    const ParserConfig &_config, SDFPtr _sdf, Errors &_errors)
+{
+  const std::shared_ptr<IncludeCache> includeCache = _config.IncludeCache();
+  ElementPtr cachedRoot =
+      includeCache ? includeCache->Find(_filename, _errors) : nullptr;
+  if (cachedRoot)
+  {
+    _sdf->SetRoot(cachedRoot);
+    return true;
+  }
+
+  // init clones the schema prototype of the current SDF version, which is
+  // built once and shared by all threads and configs, so it is cheap to
+  // call for every include.
+  init(_errors, _sdf, _config);
+
+  const std::size_t firstReadError = _errors.size();
+  if (!readFile(_filename, _config, _sdf, _errors))
+    return false;
+
+  if (includeCache)
+  {
+    includeCache->Insert(_filename, _sdf->Root(),
+        Errors(_errors.begin() + firstReadError, _errors.end()));
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// \brief A file referenced by <include> elements that was read before the
+/// elements are processed.
+struct PrefetchedFile
+{
+  /// \brief Resolved path of the file.
+  std::string filename;
+
+  /// \brief Document read from the file.
+  SDFPtr sdf;
+
+  /// \brief Errors reported when the file was read.
+  Errors errors;
+
+  /// \brief True if the file was read.
+  bool read = false;
+
+  /// \brief Exception thrown while reading the file. It is rethrown when the
+  /// file is used, as it would have been had the file been read then.
+  std::exception_ptr exception;
+
+  /// \brief Number of <include> elements that have not used the document
+  /// yet. The last one takes the document, the others take clones of it.
+  int pending = 0;
+};
+
+//////////////////////////////////////////////////
+/// \brief The resolved URI of an <include> element, and the file it refers
+/// to if that was read before the element is processed.
+struct PrefetchedInclude
+{
+  /// \brief True if the URI was resolved.
+  bool resolved = false;
+
+  /// \brief Resolved path of the included file.
+  std::string filename;
+
+  /// \brief Errors reported when resolving the URI.
+  Errors errors;
+
+  /// \brief The included file, or nullptr if it is read when the element is
+  /// processed.
+  std::shared_ptr<PrefetchedFile> file;
+};
+
+/// \brief Resolved <include> elements, by XML element.
+using PrefetchedIncludes =
+    std::unordered_map<const tinyxml2::XMLElement *, PrefetchedInclude>;
+
+/// \brief True while the current thread reads included files ahead of
+/// time. Files included by those files are read on the same thread.
+static thread_local bool readingIncludesAhead = false;
+
+//////////////////////////////////////////////////
+/// \brief Resolve the URIs of the <include> children of an element, and read
+/// the SDFormat files they refer to on up to
+/// ParserConfig::IncludeWorkerCount threads. Each file is read once, however
+/// many times it is included. Nothing is reported here; readXml reports the
+/// errors of each include when it processes the include, so errors are in
+/// the same order as when files are read one at a time.
+/// \param[in] _xml Pointer to the TinyXML element whose children are read.
+/// \param[in] _sdf SDF pointer to the element that corresponds to _xml.
+/// \param[in] _config Custom parser configuration
+/// \param[in] _source Source of the XML document
+/// \return The resolved <include> children of _xml.
+static PrefetchedIncludes prefetchIncludes(tinyxml2::XMLElement *_xml,
+    ElementPtr _sdf, const ParserConfig &_config, const std::string &_source)
+{
+  PrefetchedIncludes includes;
+  std::map<std::string, std::shared_ptr<PrefetchedFile>> filesByName;
+  std::vector<PrefetchedFile *> files;
+
+  int includeElemIndex = -1;
+  for (tinyxml2::XMLElement *elemXml = _xml->FirstChildElement("include");
+       elemXml; elemXml = elemXml->NextSiblingElement("include"))
+  {
+    const std::string includeXmlPath = _sdf->XmlPath() + "/include[" +
+        std::to_string(++includeElemIndex) + "]";
+
+    PrefetchedInclude &include = includes[elemXml];
+    include.resolved = resolveFileNameFromUri(elemXml, _config,
+        includeXmlPath, _source, include.filename, include.errors);
+
+    // Other files may be URDF files, whose conversion is not reentrant, or
+    // files for custom parsers, so they are read when they are processed.
+    if (!include.resolved || !sdf::isSdfFile(include.filename))
+      continue;
+
+    std::shared_ptr<PrefetchedFile> &file = filesByName[include.filename];
+    if (!file)
+    {
+      file = std::make_shared<PrefetchedFile>();
+      file->filename = include.filename;
+      files.push_back(file.get());
+    }
+    ++file->pending;
+    include.file = file;
+  }
+
+  // Included files are part of the document being parsed, so they are placed
+  // in its arena whichever thread reads them.
+  const std::shared_ptr<DocumentArena> arena = DocumentArena::Current();
+  std::atomic<std::size_t> nextFile{0};
+  auto readFiles = [&]()
+  {
+    DocumentArenaScope arenaScope(arena);
+    readingIncludesAhead = true;
+    for (std::size_t i = nextFile++; i < files.size(); i = nextFile++)
+    {
+      PrefetchedFile &file = *files[i];
+      file.sdf.reset(new SDF);
+      try
+      {
+        file.read = readIncludedFile(file.filename, _config, file.sdf,
+                                     file.errors);
+      }
+      catch (...)
+      {
+        file.exception = std::current_exception();
+      }
+    }
+    readingIncludesAhead = false;
+  };
+
+  // The calling thread reads files too.
+  const std::size_t threadCount =
+      std::min<std::size_t>(_config.IncludeWorkerCount(), files.size());
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < threadCount; ++i)
+    threads.emplace_back(readFiles);
+  readFiles();
+  for (auto &thread : threads)
+    thread.join();
+
+  return includes;
+}
+
+//////////////////////////////////////////////////
+/// \brief Use a file that was read before the <include> element that refers
+/// to it is processed.
+/// \param[in,out] _file The file.
+/// \param[out] _errors Captures errors found when the file was read.
+/// \return The document read from the file, or nullptr if it was not read.
+static SDFPtr usePrefetchedFile(PrefetchedFile &_file, Errors &_errors)
+{
+  if (_file.exception)
+    std::rethrow_exception(_file.exception);
+
+  _errors.insert(_errors.end(), _file.errors.begin(), _file.errors.end());
+  if (!_file.read)
+    return nullptr;
+
+  if (--_file.pending > 0)
+  {
+    SDFPtr sdf(new SDF);
+    sdf->SetRoot(_file.sdf->Root()->Clone());
+    return sdf;
+  }
+  return std::move(_file.sdf);
+}
+
+//////////////////////////////////////////////////
+/// Helper function to report the use of a deprecated element.
+/// \param[in] _sdf Element that is read.
+/// \param[in] _config Custom parser configuration
+/// \param[out] _errors Captures errors found during parsing.
+static void checkDeprecatedElement(ElementPtr _sdf,
+    const ParserConfig &_config, Errors &_errors)
 {
   // Check if the element pointer is deprecated.
   if (_sdf->GetRequired() == "-1")
@@ -1647,25 +2192,17 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
     enforceConfigurablePolicyCondition(
         _config.DeprecatedElementsPolicy(), err, _errors);
   }
+}
 
-  if (!_xml)
-  {
-    if (_sdf->GetRequired() == "1" || _sdf->GetRequired() =="+")
-    {
-      Error err(
-          ErrorCode::ELEMENT_MISSING,
-          "SDF Element<" + _sdf->GetName() + "> is missing",
-          _source);
-      err.SetXmlPath(_sdf->XmlPath());
-      _errors.push_back(err);
-      return false;
-    }
-    else
-    {
-      return true;
-    }
-  }
-
+//////////////////////////////////////////////////
+/// Helper function to replace an element whose description refers to
+/// another schema file with the description from that file.
+/// \param[in,out] _sdf Element that is read.
+/// \param[in] _config Custom parser configuration
+/// \param[out] _errors Captures errors found during parsing.
+static void copyReferenceSdf(ElementPtr _sdf, const ParserConfig &_config,
+    Errors &_errors)
+{
   // check for nested sdf
   std::string refSDFStr = _sdf->ReferenceSDF();
   if (!refSDFStr.empty())
@@ -1686,13 +2223,18 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
     if (lineNumber.has_value())
       _sdf->SetLineNumber(lineNumber.value());
   }
+}
 
-  if (!readAttributes(_xml, _sdf, _config, _source, _errors))
-    return false;
-
-  if (_xml->GetText() != nullptr && _sdf->GetValue())
+//////////////////////////////////////////////////
+/// Helper function to set the value of an element from its text.
+/// \param[in,out] _sdf Element that is read.
+/// \param[in] _text Text of the element, or nullptr if it has none.
+/// \return True on success, false on error.
+static bool readElementValue(ElementPtr _sdf, const char *_text)
+{
+  if (_text != nullptr && _sdf->GetValue())
   {
-    if (!_sdf->GetValue()->SetFromString(_xml->GetText()))
+    if (!_sdf->GetValue()->SetFromString(_text))
       return false;
   }
   else if (_sdf->GetValue())
@@ -1702,6 +2244,136 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
     if (!_sdf->GetValue()->SetFromString(""))
       return false;
   }
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// Helper function to get the XML path of a child element.
+/// \param[in] _sdf Parent element.
+/// \param[in] _name Name of the child element.
+/// \param[in] _nameAttribute Value of the name attribute of the child, or
+/// nullptr if it has none.
+/// \return XML path of the child element.
+static std::string childXmlPath(ElementPtr _sdf, const char *_name,
+    const char *_nameAttribute)
+{
+  std::string elemXmlPath = _sdf->XmlPath() + "/" + _name;
+  if (_nameAttribute)
+    elemXmlPath += "[@name=\"" + std::string(_nameAttribute) + "\"]";
+  return elemXmlPath;
+}
+
+//////////////////////////////////////////////////
+/// Helper function to report a child element that is not in the schema.
+/// \param[in] _sdf Parent element.
+/// \param[in] _parentName Name of the parent XML element.
+/// \param[in] _name Name of the child element.
+/// \param[in] _nameAttribute Value of the name attribute of the child, or
+/// nullptr if it has none.
+/// \param[in] _lineNumber Line number of the child element.
+/// \param[in] _config Custom parser configuration
+/// \param[in] _source Source of the XML document.
+/// \param[out] _errors Captures errors found during parsing.
+static void reportUnrecognizedElement(ElementPtr _sdf,
+    const char *_parentName, const char *_name, const char *_nameAttribute,
+    int _lineNumber, const ParserConfig &_config, const std::string &_source,
+    Errors &_errors)
+{
+  std::stringstream ss;
+  ss << "XML Element[" << _name
+     << "], child of element[" << _parentName
+     << "], not defined in SDF. Copying[" << _name << "] "
+     << "as children of [" << _parentName << "].\n";
+
+  Error err(
+      ErrorCode::ELEMENT_INCORRECT_TYPE,
+      ss.str(),
+      _source,
+      _lineNumber);
+  err.SetXmlPath(childXmlPath(_sdf, _name, _nameAttribute));
+  enforceConfigurablePolicyCondition(
+      _config.UnrecognizedElementsPolicy(), err, _errors);
+}
+
+//////////////////////////////////////////////////
+/// Helper function to add the required child elements that are missing
+/// from an element with their default values.
+/// \param[in,out] _sdf Element that was read.
+/// \param[in] _lineNumber Line number of the element.
+/// \param[in] _source Source of the XML document.
+/// \param[out] _errors Captures errors found during parsing.
+/// \return True on success, false on error.
+static bool addRequiredElements(ElementPtr _sdf, int _lineNumber,
+    const std::string &_source, Errors &_errors)
+{
+  // Check that all required elements have been set
+  for (unsigned int descCounter = 0;
+       descCounter != _sdf->GetElementDescriptionCount(); ++descCounter)
+  {
+    ElementPtr elemDesc = _sdf->GetElementDescription(descCounter);
+
+    if (elemDesc->GetRequired() == "1" || elemDesc->GetRequired() == "+")
+    {
+      if (!_sdf->HasElement(elemDesc->GetName()))
+      {
+        const std::string elemXmlPath = _sdf->XmlPath() + "/" +
+            elemDesc->GetName();
+        if (_sdf->GetName() == "joint" &&
+            _sdf->Get<std::string>("type") != "ball")
+        {
+          Error missingElementError(
+              ErrorCode::ELEMENT_MISSING,
+              "XML Missing required element[" + elemDesc->GetName() +
+              "], child of element[" + _sdf->GetName() + "]",
+              _source,
+              _lineNumber);
+          missingElementError.SetXmlPath(elemXmlPath);
+          _errors.push_back(missingElementError);
+          return false;
+        }
+        else
+        {
+          // Add default element
+          ElementPtr defaultElement = _sdf->AddElement(elemDesc->GetName());
+          defaultElement->SetExplicitlySetInFile(false);
+        }
+      }
+    }
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
+    const ParserConfig &_config, const std::string &_source, Errors &_errors)
+{
+  checkDeprecatedElement(_sdf, _config, _errors);
+
+  if (!_xml)
+  {
+    if (_sdf->GetRequired() == "1" || _sdf->GetRequired() =="+")
+    {
+      Error err(
+          ErrorCode::ELEMENT_MISSING,
+          "SDF Element<" + _sdf->GetName() + "> is missing",
+          _source);
+      err.SetXmlPath(_sdf->XmlPath());
+      _errors.push_back(err);
+      return false;
+    }
+    else
+    {
+      return true;
+    }
+  }
+
+  copyReferenceSdf(_sdf, _config, _errors);
+
+  if (!readAttributes(_xml, _sdf, _config, _source, _errors))
+    return false;
+
+  if (!readElementValue(_sdf, _xml->GetText()))
+    return false;
 
   if (_sdf->GetCopyChildren())
   {
@@ -1714,6 +2386,15 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
     // Keep count of the include indices
     int includeElemIndex = -1;
 
+    // Included files may be read on several threads before the children
+    // are processed in order.
+    PrefetchedIncludes prefetched;
+    if (_config.IncludeWorkerCount() > 1 && !readingIncludesAhead &&
+        _xml->FirstChildElement("include"))
+    {
+      prefetched = prefetchIncludes(_xml, _sdf, _config, _source);
+    }
+
     // Iterate over all the child elements
     tinyxml2::XMLElement *elemXml = nullptr;
     for (elemXml = _xml->FirstChildElement(); elemXml;
@@ -1729,30 +2410,42 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
             std::to_string(++includeElemIndex) + "]";
         const std::string uriXmlPath = includeXmlPath + "/uri";
 
-        if (!resolveFileNameFromUri(elemXml, _config, includeXmlPath,
-                _source, filename, _errors))
+        std::shared_ptr<PrefetchedFile> prefetchedFile;
+        auto prefetchedIt = prefetched.find(elemXml);
+        if (prefetchedIt != prefetched.end())
+        {
+          PrefetchedInclude &include = prefetchedIt->second;
+          _errors.insert(_errors.end(), include.errors.begin(),
+                         include.errors.end());
+          if (!include.resolved)
+            continue;
+          filename = include.filename;
+          prefetchedFile = include.file;
+        }
+        else if (!resolveFileNameFromUri(elemXml, _config, includeXmlPath,
+                     _source, filename, _errors))
+        {
           continue;
+        }
 
         // If the file is not an SDFormat file, it is assumed that it will
         // handled by a custom parser, so fall through and add the include
         // element into _sdf.
         if (sdf::isSdfFile(filename) || _config.CustomModelParsers().empty())
         {
-          // NOTE: sdf::init is an expensive call. For performance reason,
-          // a new sdf pointer is created here by cloning a fresh sdf template
-          // pointer instead of calling init every iteration.
-          // SDFPtr includeSDF(new SDF);
-          // init(includeSDF, _config);
-          static SDFPtr includeSDFTemplate;
-          if (!includeSDFTemplate)
+          SDFPtr includeSDF;
+          if (prefetchedFile)
           {
-            includeSDFTemplate.reset(new SDF);
-            init(includeSDFTemplate, _config);
+            includeSDF = usePrefetchedFile(*prefetchedFile, _errors);
+          }
+          else
+          {
+            includeSDF.reset(new SDF);
+            if (!readIncludedFile(filename, _config, includeSDF, _errors))
+              includeSDF.reset();
           }
-          SDFPtr includeSDF(new SDF);
-          includeSDF->SetRoot(includeSDFTemplate->Root()->Clone());
 
-          if (!readFile(filename, _config, includeSDF, _errors))
+          if (!includeSDF)
           {
             Error err(
                 ErrorCode::FILE_READ,
@@ -1984,10 +2677,8 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
         ElementPtr elemDesc = _sdf->GetElementDescription(descCounter);
         if (elemDesc->GetName() == elemXml->Value())
         {
-          std::string elemXmlPath = _sdf->XmlPath() + "/" + elemXml->Value();
-          const char *name = elemXml->Attribute("name");
-          if (name)
-            elemXmlPath += "[@name=\"" + std::string(name) + "\"]";
+          const std::string elemXmlPath = childXmlPath(
+              _sdf, elemXml->Value(), elemXml->Attribute("name"));
 
           ElementPtr element = elemDesc->Clone();
           element->SetParent(_sdf);
@@ -2016,26 +2707,9 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
       if (descCounter == _sdf->GetElementDescriptionCount()
             && std::strchr(elemXml->Value(), ':') == nullptr)
       {
-        std::string elemXmlPath = _sdf->XmlPath() + "/" + elemXml->Value();
-        const char *name = elemXml->Attribute("name");
-        if (name)
-          elemXmlPath += "[@name=\"" + std::string(name) + "\"]";
-
-        std::stringstream ss;
-        ss << "XML Element[" << elemXml->Value()
-           << "], child of element[" << _xml->Value()
-           << "], not defined in SDF. Copying[" << elemXml->Value() << "] "
-           << "as children of [" << _xml->Value() << "].\n";
-
-        Error err(
-            ErrorCode::ELEMENT_INCORRECT_TYPE,
-            ss.str(),
-            _source,
-            elemXml->GetLineNum());
-        err.SetXmlPath(elemXmlPath);
-        enforceConfigurablePolicyCondition(
-            _config.UnrecognizedElementsPolicy(), err, _errors);
-
+        reportUnrecognizedElement(_sdf, _xml->Value(), elemXml->Value(),
+            elemXml->Attribute("name"), elemXml->GetLineNum(), _config,
+            _source, _errors);
         continue;
       }
     }
@@ -2043,43 +2717,351 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
     // Copy unknown elements outside the loop so it only happens one time
     copyChildren(_sdf, _xml, true);
 
-    // Check that all required elements have been set
+    if (!addRequiredElements(_sdf, _xml->GetLineNum(), _source, _errors))
+      return false;
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// Helper function to check that a document can be read with an
+/// XmlStreamReader, before any element is built from it.
+/// \param[in] _data Content of the document.
+/// \param[in] _size Size of the content in bytes.
+/// \return False if the document has <include> tags, if its first <model>
+/// has a <pose> that fails checkXmlFromRoot, or if the reader does not
+/// support it, in which case it is parsed by tinyxml2 instead.
+static bool streamReadable(const char *_data, std::size_t _size)
+{
+  using Token = XmlStreamReader::Token;
+
+  // Included files are merged by readXml, which needs the whole <include>.
+  // Searching for the tag is much faster than reading up to it.
+  if (std::string_view(_data, _size).find("<include") != std::string::npos)
+    return false;
+
+  XmlStreamReader reader(_data, _size);
+  int depth = 0;
+  bool firstModel = true;
+  bool inTopLevelModel = false;
+  bool firstPose = true;
+  for (Token token = reader.Next(); token != Token::END_OF_DOCUMENT;
+       token = reader.Next())
+  {
+    if (token == Token::UNSUPPORTED)
+      return false;
+
+    if (token == Token::START_ELEMENT)
+    {
+      const XmlStreamElement &elemXml = reader.Element();
+      ++depth;
+      if (depth == 2 && elemXml.name == "model")
+      {
+        inTopLevelModel = firstModel;
+        firstModel = false;
+      }
+      else if (depth == 3 && inTopLevelModel && firstPose &&
+               elemXml.name == "pose")
+      {
+        // Leave the error about the pose to checkXmlFromRoot
+        firstPose = false;
+        const char *relativeTo = elemXml.Attribute("relative_to");
+        if (relativeTo && *relativeTo)
+          return false;
+      }
+    }
+    else if (token == Token::END_ELEMENT)
+    {
+      if (depth == 2)
+        inTopLevelModel = false;
+      --depth;
+    }
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// Helper function to read the children of the element whose start tag was
+/// just read by an XmlStreamReader, up to its end tag.
+/// \param[in,out] _reader Reader positioned after the start tag.
+/// \param[in] _token First token after the start tag.
+/// \param[in] _readChild Function called at the start tag of each child
+/// element, which reads up to its end tag and returns false on failure.
+/// \return True if the children were read.
+template <typename ReadChildT>
+static bool readStreamChildren(XmlStreamReader &_reader,
+    XmlStreamReader::Token _token, ReadChildT _readChild)
+{
+  using Token = XmlStreamReader::Token;
+  for (Token token = _token; ; token = _reader.Next())
+  {
+    switch (token)
+    {
+      case Token::START_ELEMENT:
+        if (!_readChild())
+          return false;
+        break;
+      case Token::END_ELEMENT:
+        return true;
+      case Token::TEXT:
+      case Token::OTHER:
+        break;
+      default:
+        return false;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+/// Helper function to copy an element read by an XmlStreamReader, as
+/// copyChildren copies each child of a tinyxml2::XMLElement.
+/// \param[in,out] _reader Reader positioned at the start tag of the element.
+/// It is left at the end tag of the element.
+/// \param[in] _sdf Parent of the element.
+/// \param[in] _onlyUnknown True to copy only elements that are not in the
+/// schema of _sdf.
+/// \param[out] _unknown The copy of an element that is not in the schema of
+/// _sdf, which the caller inserts into _sdf, or nullptr.
+/// \return True if the element was read to its end tag.
+static bool copyStreamElement(XmlStreamReader &_reader, ElementPtr _sdf,
+    bool _onlyUnknown, ElementPtr &_unknown)
+{
+  using Token = XmlStreamReader::Token;
+  const XmlStreamElement &elemXml = _reader.Element();
+  _unknown.reset();
+
+  sdf::ElementPtr element;
+  if (_sdf->HasElementDescription(elemXml.name))
+  {
+    if (!_onlyUnknown)
+    {
+      element = _sdf->AddElement(elemXml.name);
+      for (const auto *attribute = elemXml.FirstAttribute(); attribute;
+           attribute = attribute->Next())
+      {
+        if (ParamPtr param = element->GetAttribute(attribute->Name()))
+          param->SetFromString(attribute->Value());
+      }
+    }
+  }
+  else
+  {
+    element.reset(new sdf::Element);
+    element->SetParent(_sdf);
+    element->SetName(elemXml.name);
+    for (const auto *attribute = elemXml.FirstAttribute(); attribute;
+         attribute = attribute->Next())
+    {
+      // Add with required == 0 to allow unrecognized attribute to be empty
+      element->AddAttribute(attribute->Name(), "string", "", 0, "");
+      element->GetAttribute(attribute->Name())->SetFromString(
+          attribute->Value());
+    }
+    _unknown = element;
+  }
+
+  const Token token = _reader.Next();
+  if (!element)
+  {
+    // Skip the element and its children
+    int depth = 0;
+    for (Token skipped = token; ; skipped = _reader.Next())
+    {
+      if (skipped == Token::START_ELEMENT)
+        ++depth;
+      else if (skipped == Token::END_ELEMENT && depth-- == 0)
+        return true;
+      else if (skipped == Token::END_OF_DOCUMENT ||
+               skipped == Token::UNSUPPORTED)
+        return false;
+    }
+  }
+
+  // copy value
+  if (token == Token::TEXT)
+  {
+    if (_unknown)
+      element->AddValue("string", _reader.Text(), true);
+    else if (element->GetValue())
+      element->GetValue()->SetFromString(_reader.Text());
+  }
+
+  return readStreamChildren(_reader, token, [&]()
+  {
+    ElementPtr unknown;
+    const bool result =
+        copyStreamElement(_reader, element, _onlyUnknown, unknown);
+    if (unknown)
+      element->InsertElement(unknown);
+    return result;
+  });
+}
+
+//////////////////////////////////////////////////
+/// Helper function to read an element with an XmlStreamReader, as readXml
+/// reads a tinyxml2::XMLElement.
+/// \param[in,out] _reader Reader positioned at the start tag of the element.
+/// It is left at the end tag of the element.
+/// \param[in,out] _sdf Element to read into.
+/// \param[in] _config Custom parser configuration
+/// \param[in] _source Source of the XML document.
+/// \param[out] _errors Captures errors found during parsing.
+/// \return True on success, false on error.
+static bool readXmlStream(XmlStreamReader &_reader, ElementPtr _sdf,
+    const ParserConfig &_config, const std::string &_source, Errors &_errors)
+{
+  using Token = XmlStreamReader::Token;
+  checkDeprecatedElement(_sdf, _config, _errors);
+  copyReferenceSdf(_sdf, _config, _errors);
+
+  if (!readAttributes(&_reader.Element(), _sdf, _config, _source, _errors))
+    return false;
+
+  const std::string name = _reader.Element().name;
+  const int lineNumber = _reader.Element().GetLineNum();
+
+  // As for tinyxml2::XMLElement::GetText, the value is the first child of
+  // the element if it is text.
+  const Token token = _reader.Next();
+  if (!readElementValue(_sdf, token == Token::TEXT ?
+                        _reader.Text().c_str() : nullptr))
+  {
+    return false;
+  }
+
+  if (_sdf->GetCopyChildren())
+  {
+    return readStreamChildren(_reader, token, [&]()
+    {
+      ElementPtr unknown;
+      const bool result = copyStreamElement(_reader, _sdf, false, unknown);
+      if (unknown)
+        _sdf->InsertElement(unknown);
+      return result;
+    });
+  }
+
+  // Unknown elements are inserted after the others, as readXml does.
+  std::vector<ElementPtr> unknownElements;
+  const bool result = readStreamChildren(_reader, token, [&]()
+  {
+    const XmlStreamElement &elemXml = _reader.Element();
+
+    // Find the matching element in SDF
     for (unsigned int descCounter = 0;
          descCounter != _sdf->GetElementDescriptionCount(); ++descCounter)
     {
       ElementPtr elemDesc = _sdf->GetElementDescription(descCounter);
-
-      if (elemDesc->GetRequired() == "1" || elemDesc->GetRequired() == "+")
+      if (elemDesc->GetName() == elemXml.name)
       {
-        if (!_sdf->HasElement(elemDesc->GetName()))
+        const std::string elemXmlPath = childXmlPath(
+            _sdf, elemXml.Value(), elemXml.Attribute("name"));
+        const std::string elemName = elemXml.name;
+        const int elemLineNumber = elemXml.GetLineNum();
+
+        ElementPtr element = elemDesc->Clone();
+        element->SetParent(_sdf);
+        element->SetLineNumber(elemLineNumber);
+        element->SetXmlPath(elemXmlPath);
+        if (!readXmlStream(_reader, element, _config, _source, _errors))
         {
-          const std::string elemXmlPath = _sdf->XmlPath() + "/" +
-              elemDesc->GetName();
-          if (_sdf->GetName() == "joint" &&
-              _sdf->Get<std::string>("type") != "ball")
-          {
-            Error missingElementError(
-                ErrorCode::ELEMENT_MISSING,
-                "XML Missing required element[" + elemDesc->GetName() +
-                "], child of element[" + _sdf->GetName() + "]",
-                _source,
-                _xml->GetLineNum());
-            missingElementError.SetXmlPath(elemXmlPath);
-            _errors.push_back(missingElementError);
-            return false;
-          }
-          else
-          {
-            // Add default element
-            ElementPtr defaultElement = _sdf->AddElement(elemDesc->GetName());
-            defaultElement->SetExplicitlySetInFile(false);
-          }
+          Error err(
+              ErrorCode::ELEMENT_INVALID,
+              "Error reading element <" + elemName + ">",
+              _source,
+              elemLineNumber);
+          err.SetXmlPath(elemXmlPath);
+          _errors.push_back(err);
+          return false;
         }
+        _sdf->InsertElement(element);
+        return true;
       }
     }
+
+    if (elemXml.name.find(':') == std::string::npos)
+    {
+      reportUnrecognizedElement(_sdf, name.c_str(), elemXml.Value(),
+          elemXml.Attribute("name"), elemXml.GetLineNum(), _config,
+          _source, _errors);
+    }
+
+    ElementPtr unknown;
+    const bool copied = copyStreamElement(_reader, _sdf, true, unknown);
+    if (unknown)
+      unknownElements.push_back(unknown);
+    return copied;
+  });
+
+  if (!result)
+    return false;
+
+  for (const ElementPtr &unknown : unknownElements)
+    _sdf->InsertElement(unknown);
+
+  return addRequiredElements(_sdf, lineNumber, _source, _errors);
+}
+
+//////////////////////////////////////////////////
+static StreamReadResult readDocStream(const char *_data, std::size_t _size,
+    SDFPtr _sdf, const std::string &_source, bool _convert,
+    const ParserConfig &_config, Errors &_errors)
+{
+  using Token = XmlStreamReader::Token;
+
+  if (nullptr == _sdf || nullptr == _sdf->Root() ||
+      _sdf->Root()->GetName() != "sdf" || !streamReadable(_data, _size))
+  {
+    return StreamReadResult::UNSUPPORTED;
   }
 
-  return true;
+  XmlStreamReader reader(_data, _size);
+  Token token = reader.Next();
+  while (token == Token::OTHER)
+    token = reader.Next();
+
+  const char *version = reader.Element().Attribute("version");
+  if (token != Token::START_ELEMENT || reader.Element().name != "sdf" ||
+      !version || (_convert && version != SDF::Version()))
+  {
+    return StreamReadResult::UNSUPPORTED;
+  }
+
+  DocumentArenaScope arenaScope(DocumentArena::ForDocument(
+      _config.UseDocumentArena(), _sdf->Root().get()));
+
+  if (_source != std::string(kSdfStringSource))
+    _sdf->SetFilePath(_source);
+  if (_sdf->OriginalVersion().empty())
+    _sdf->SetOriginalVersion(version);
+  if (_sdf->Root()->OriginalVersion().empty())
+    _sdf->Root()->SetOriginalVersion(version);
+  if (!_sdf->Root()->LineNumber().has_value())
+    _sdf->Root()->SetLineNumber(reader.Element().GetLineNum());
+  if (_sdf->Root()->XmlPath().empty())
+    _sdf->Root()->SetXmlPath("/sdf");
+
+  if (!readXmlStream(reader, _sdf->Root(), _config, _source, _errors))
+  {
+    _errors.push_back({ErrorCode::ELEMENT_INVALID,
+        "Error reading element <" + _sdf->Root()->GetName() + ">"});
+    return StreamReadResult::FAILED;
+  }
+
+  // delimiter '::' in element names not allowed in SDFormat >= 1.8
+  gz::math::SemanticVersion sdfVersion(_sdf->Root()->OriginalVersion());
+  if (sdfVersion >= gz::math::SemanticVersion(1, 8)
+      && !recursiveSiblingNoDoubleColonInNames(_errors, _sdf->Root()))
+  {
+    _errors.push_back({ErrorCode::RESERVED_NAME,
+        "Delimiter '::' found in attribute names of element <"
+        + _sdf->Root()->GetName() +
+        ">, which is not allowed in SDFormat >= 1.8"});
+    return StreamReadResult::FAILED;
+  }
+
+  return StreamReadResult::READ;
 }
 
 /////////////////////////////////////////////////
@@ -2459,11 +3441,9 @@ bool recursiveSameTypeUniqueNames(sdf::Errors &_errors, sdf::ElementPtr _elem)
     }
   }
 
-  sdf::ElementPtr child = _elem->GetFirstElement();
-  while (child)
+  for (const auto &child : _elem->Children())
   {
     result = recursiveSameTypeUniqueNames(_errors, child) && result;
-    child = child->GetNextElement();
   }
 
   return result;
@@ -2494,11 +3474,9 @@ bool recursiveSiblingUniqueNames(sdf::Errors &_errors, sdf::ElementPtr _elem)
     result = false;
   }
 
-  sdf::ElementPtr child = _elem->GetFirstElement();
-  while (child)
+  for (const auto &child : _elem->Children())
   {
     result = recursiveSiblingUniqueNames(_errors, child) && result;
-    child = child->GetNextElement();
   }
 
   return result;
@@ -2530,11 +3508,9 @@ bool recursiveSiblingNoDoubleColonInNames(sdf::Errors &_errors,
     result = false;
   }
 
-  sdf::ElementPtr child = _elem->GetFirstElement();
-  while (child)
+  for (const auto &child : _elem->Children())
   {
     result = recursiveSiblingNoDoubleColonInNames(_errors, child) && result;
-    child = child->GetNextElement();
   }
 
   return result;
@@ -26,6 +26,7 @@
 
 #include <gz/utils/Environment.hh>
 
+#include "EmbeddedSdf.hh"
 #include "test_config.hh"
 #include "test_utils.hh"
 
@@ -940,6 +941,97 @@ TEST(Parser, ReadFileMalformedSDFNoRobotError)
 #endif
 }
 
+/////////////////////////////////////////////////
+/// \brief Check that two parameter descriptions are the same.
+void expectSameParam(const sdf::ParamPtr &_expected,
+    const sdf::ParamPtr &_actual, const std::string &_path)
+{
+  ASSERT_EQ(nullptr == _expected, nullptr == _actual) << _path;
+  if (!_expected)
+  {
+    return;
+  }
+  EXPECT_EQ(_expected->GetKey(), _actual->GetKey()) << _path;
+  EXPECT_EQ(_expected->GetTypeName(), _actual->GetTypeName()) << _path;
+  EXPECT_EQ(_expected->GetDefaultAsString(), _actual->GetDefaultAsString())
+    << _path;
+  EXPECT_EQ(_expected->GetMinValueAsString(), _actual->GetMinValueAsString())
+    << _path;
+  EXPECT_EQ(_expected->GetMaxValueAsString(), _actual->GetMaxValueAsString())
+    << _path;
+  EXPECT_EQ(_expected->GetRequired(), _actual->GetRequired()) << _path;
+  EXPECT_EQ(_expected->GetDescription(), _actual->GetDescription()) << _path;
+}
+
+/////////////////////////////////////////////////
+/// \brief Check that two element descriptions are the same, recursively.
+void expectSameDescription(const sdf::ElementPtr &_expected,
+    const sdf::ElementPtr &_actual, const std::string &_path)
+{
+  const std::string path = _path + "/" + _expected->GetName();
+  EXPECT_EQ(_expected->GetName(), _actual->GetName()) << path;
+  EXPECT_EQ(_expected->GetRequired(), _actual->GetRequired()) << path;
+  EXPECT_EQ(_expected->GetDescription(), _actual->GetDescription()) << path;
+  EXPECT_EQ(_expected->GetCopyChildren(), _actual->GetCopyChildren()) << path;
+  EXPECT_EQ(_expected->ReferenceSDF(), _actual->ReferenceSDF()) << path;
+  expectSameParam(_expected->GetValue(), _actual->GetValue(), path);
+
+  ASSERT_EQ(_expected->GetAttributeCount(), _actual->GetAttributeCount())
+    << path;
+  for (unsigned int i = 0; i < _expected->GetAttributeCount(); ++i)
+  {
+    expectSameParam(_expected->GetAttribute(i), _actual->GetAttribute(i),
+                    path);
+  }
+
+  ASSERT_EQ(_expected->GetElementDescriptionCount(),
+            _actual->GetElementDescriptionCount()) << path;
+  for (unsigned int i = 0; i < _expected->GetElementDescriptionCount();
+       ++i)
+  {
+    expectSameDescription(_expected->GetElementDescription(i),
+                          _actual->GetElementDescription(i), path);
+  }
+}
+
+/////////////////////////////////////////////////
+/// Check that the schema tables generated at build time describe the same
+/// elements as the spec files they were generated from.
+TEST(Parser, SchemaTablesMatchSpecFiles)
+{
+  const sdf::EmbeddedSchema &schema = sdf::GetEmbeddedSchema();
+  ASSERT_EQ(sdf::SDF::Version(), schema.version);
+  ASSERT_GT(schema.fileCount, 0u);
+
+  const std::string prefix = sdf::SDF::Version() + "/";
+  std::size_t specFileCount = 0;
+  for (const auto &[path, content] : sdf::GetEmbeddedSdf())
+  {
+    if (path.rfind(prefix, 0) != 0 ||
+        path.substr(path.size() - 4) != ".sdf")
+    {
+      continue;
+    }
+    ++specFileCount;
+
+    // initString always parses the XML, while initFile uses the tables.
+    sdf::SDFPtr fromXml(new sdf::SDF());
+    sdf::Errors errors;
+    ASSERT_TRUE(sdf::initString(content, sdf::ParserConfig::GlobalConfig(),
+                                fromXml, errors)) << path;
+    EXPECT_TRUE(errors.empty()) << errors;
+
+    sdf::ElementPtr fromTables(new sdf::Element);
+    ASSERT_TRUE(sdf::initFile(path.substr(prefix.size()),
+                              sdf::ParserConfig::GlobalConfig(), fromTables,
+                              errors)) << path;
+    EXPECT_TRUE(errors.empty()) << errors;
+
+    expectSameDescription(fromXml->Root(), fromTables, path);
+  }
+  EXPECT_EQ(schema.fileCount, specFileCount);
+}
+
 /////////////////////////////////////////////////
 /// Main
 int main(int argc, char **argv)
@@ -17,11 +17,14 @@
 
 #include <algorithm>
 #include <fstream>
+#include <locale>
 #include <map>
 #include <memory>
 #include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -38,6 +41,7 @@
 #include "sdf/sdf.hh"
 #include "sdf/Types.hh"
 
+#include "ValueParsing.hh"
 #include "XmlUtils.hh"
 #include "SDFExtension.hh"
 #include "parser_urdf.hh"
@@ -54,17 +58,24 @@ typedef std::shared_ptr<SDFExtension> SDFExtensionPtr;
 typedef std::map<std::string, std::vector<SDFExtensionPtr> >
   StringSDFExtensionPtrMap;
 
-/// create SDF geometry block based on URDF
-StringSDFExtensionPtrMap g_extensions;
-bool g_reduceFixedJoints;
-bool g_enforceLimits;
+/// \brief State of one conversion from URDF to SDFormat. Each URDF2SDF
+/// object owns its own state and passes it to the conversion functions, so
+/// that objects can convert concurrently.
+struct URDF2SDFState
+{
+  /// create SDF geometry block based on URDF
+  StringSDFExtensionPtrMap extensions;
+  bool reduceFixedJoints = true;
+  bool enforceLimits = true;
+  urdf::Pose initialRobotPose;
+  bool initialRobotPoseValid = false;
+  std::set<std::string> fixedJointsTransformedInRevoluteJoints;
+  std::set<std::string> fixedJointsTransformedInFixedJoints;
+};
+
 const char kCollisionExt[] = "_collision";
 const char kVisualExt[] = "_visual";
 const char kLumpPrefix[] = "_fixed_joint_lump__";
-urdf::Pose g_initialRobotPose;
-bool g_initialRobotPoseValid = false;
-std::set<std::string> g_fixedJointsTransformedInRevoluteJoints;
-std::set<std::string> g_fixedJointsTransformedInFixedJoints;
 const int g_outputDecimalPrecision = 16;
 const char kSdformatUrdfExtensionUrl[] =
     "http://sdformat.org/tutorials?tut=sdformat_urdf_extensions";
@@ -77,25 +88,30 @@ urdf::Vector3 ParseVector3(tinyxml2::XMLNode *_key, double _scale = 1.0);
 urdf::Vector3 ParseVector3(const std::string &_str, double _scale = 1.0);
 
 /// insert extensions into collision geoms
-void InsertSDFExtensionCollision(tinyxml2::XMLElement *_elem,
+void InsertSDFExtensionCollision(URDF2SDFState &_state,
+                                 tinyxml2::XMLElement *_elem,
                                  const std::string &_linkName);
 
 /// insert extensions into model
-void InsertSDFExtensionRobot(tinyxml2::XMLElement *_elem);
+void InsertSDFExtensionRobot(URDF2SDFState &_state,
+                             tinyxml2::XMLElement *_elem);
 
 /// insert extensions into visuals
-void InsertSDFExtensionVisual(tinyxml2::XMLElement *_elem,
+void InsertSDFExtensionVisual(URDF2SDFState &_state,
+                              tinyxml2::XMLElement *_elem,
                               const std::string &_linkName);
 
 
 /// insert extensions into joints
-void InsertSDFExtensionJoint(tinyxml2::XMLElement *_elem,
+void InsertSDFExtensionJoint(URDF2SDFState &_state,
+                             tinyxml2::XMLElement *_elem,
                              const std::string &_jointName);
 
 /// reduced fixed joints:  check if a fixed joint should be lumped
 ///   checking both the joint type and if disabledFixedJointLumping
 ///   option is set
-bool FixedJointShouldBeReduced(urdf::JointSharedPtr _jnt);
+bool FixedJointShouldBeReduced(const URDF2SDFState &_state,
+                               urdf::JointSharedPtr _jnt);
 
 /// reduced fixed joints:  apply transform reduction for named elements
 ///   in extensions when doing fixed joint reduction
@@ -110,41 +126,51 @@ void ReduceSDFExtensionElementTransformReduction(
 void ReduceSDFExtensionsTransform(SDFExtensionPtr _ge);
 
 /// reduce fixed joints:  lump joints to parent link
-void ReduceJointsToParent(urdf::LinkSharedPtr _link);
+void ReduceJointsToParent(const URDF2SDFState &_state,
+                          urdf::LinkSharedPtr _link,
+                          urdf::LinkSharedPtr _lumpParent,
+                          const gz::math::Pose3d &_lumpPose);
 
 /// reduce fixed joints:  lump collisions to parent link
-void ReduceCollisionsToParent(urdf::LinkSharedPtr _link);
+void ReduceCollisionsToParent(urdf::LinkSharedPtr _link,
+                              urdf::LinkSharedPtr _lumpParent,
+                              const gz::math::Pose3d &_lumpPose);
 
 /// reduce fixed joints:  lump visuals to parent link
-void ReduceVisualsToParent(urdf::LinkSharedPtr _link);
+void ReduceVisualsToParent(urdf::LinkSharedPtr _link,
+                           urdf::LinkSharedPtr _lumpParent,
+                           const gz::math::Pose3d &_lumpPose);
 
 /// reduce fixed joints:  lump inertial to parent link
 void ReduceInertialToParent(urdf::LinkSharedPtr /*_link*/);
 
 /// create SDF Collision block based on URDF
-void CreateCollision(tinyxml2::XMLElement* _elem,
+void CreateCollision(URDF2SDFState &_state, tinyxml2::XMLElement* _elem,
                      urdf::LinkConstSharedPtr _link,
                      urdf::CollisionSharedPtr _collision,
                      const std::string &_oldLinkName = std::string(""));
 
 /// create SDF Visual block based on URDF
-void CreateVisual(tinyxml2::XMLElement *_elem, urdf::LinkConstSharedPtr _link,
+void CreateVisual(URDF2SDFState &_state, tinyxml2::XMLElement *_elem,
+                  urdf::LinkConstSharedPtr _link,
                   urdf::VisualSharedPtr _visual,
                   const std::string &_oldLinkName = std::string(""));
 
 /// create SDF Joint block based on URDF
-void CreateJoint(tinyxml2::XMLElement *_root, urdf::LinkConstSharedPtr _link,
+void CreateJoint(URDF2SDFState &_state, tinyxml2::XMLElement *_root,
+                 urdf::LinkConstSharedPtr _link,
                  const gz::math::Pose3d &_currentTransform);
 
 /// insert extensions into links
-void InsertSDFExtensionLink(tinyxml2::XMLElement *_elem,
+void InsertSDFExtensionLink(URDF2SDFState &_state, tinyxml2::XMLElement *_elem,
                             const std::string &_linkName);
 
 /// create visual blocks from urdf visuals
-void CreateVisuals(tinyxml2::XMLElement* _elem, urdf::LinkConstSharedPtr _link);
+void CreateVisuals(URDF2SDFState &_state, tinyxml2::XMLElement* _elem,
+                   urdf::LinkConstSharedPtr _link);
 
 /// create collision blocks from urdf collisions
-void CreateCollisions(tinyxml2::XMLElement* _elem,
+void CreateCollisions(URDF2SDFState &_state, tinyxml2::XMLElement* _elem,
                       urdf::LinkConstSharedPtr _link);
 
 /// create SDF Inertial block based on URDF
@@ -156,10 +182,12 @@ void AddTransform(tinyxml2::XMLElement *_elem,
     const gz::math::Pose3d &_transform);
 
 /// create SDF from URDF link
-void CreateSDF(tinyxml2::XMLElement *_root, urdf::LinkConstSharedPtr _link);
+void CreateSDF(URDF2SDFState &_state, tinyxml2::XMLElement *_root,
+               urdf::LinkConstSharedPtr _link);
 
 /// create SDF Link block based on URDF
-void CreateLink(tinyxml2::XMLElement *_root, urdf::LinkConstSharedPtr _link,
+void CreateLink(URDF2SDFState &_state, tinyxml2::XMLElement *_root,
+                urdf::LinkConstSharedPtr _link,
                 const gz::math::Pose3d &_currentTransform);
 
 /// reduced fixed joints:  apply appropriate frame updates in joint
@@ -198,13 +226,55 @@ void ReduceSDFExtensionContactSensorFrameReplace(
 ///   extensions when doing fixed joint reduction
 ///
 /// Take the link's existing list of gazebo extensions, transfer them
-/// into parent link.  Along the way, update local transforms by adding
-/// the additional transform to parent.  Also, look through all
-/// referenced link names with plugins and update references to current
-/// link to the parent link. (ReduceSDFExtensionFrameReplace())
+/// into the link that keeps its elements.  Along the way, update local
+/// transforms by adding the transform to that link.
 ///
+/// \param[in,out] _state State of the conversion.
 /// \param[in] _link pointer to urdf link, its extensions will be reduced
-void ReduceSDFExtensionToParent(urdf::LinkSharedPtr _link);
+/// \param[in] _lumpParent Link that keeps the elements of _link.
+/// \param[in] _lumpPose Pose of _link in the frame of _lumpParent.
+void ReduceSDFExtensionToParent(URDF2SDFState &_state,
+                                urdf::LinkSharedPtr _link,
+                                urdf::LinkSharedPtr _lumpParent,
+                                const gz::math::Pose3d &_lumpPose);
+
+/// \brief State of the sdf extension updates of a fixed joint reduction.
+struct SDFExtensionReduction
+{
+  /// \brief Extensions with the frames of the reduced joints and links.
+  std::vector<SDFExtensionPtr> frames;
+
+  /// \brief Extensions by the link names they may reference.
+  StringSDFExtensionPtrMap references;
+
+  /// \brief Name of the link each extension is attached to in the URDF.
+  std::map<const SDFExtension *, std::string> extensionLinks;
+
+  /// \brief For each reduced link, the link it has been reduced into so
+  /// far: itself, or the reduced parent link whose reduction carried its
+  /// extensions last. Follow the links until one maps to itself.
+  std::map<std::string, urdf::LinkSharedPtr> reducedInto;
+};
+
+/// \brief reduced fixed joints:  look through the extensions that may
+/// reference the link name and update references to the link to its
+/// parent link. (ReduceSDFExtensionFrameReplace())
+/// \param[in] _link pointer to urdf link that is reduced
+/// \param[in,out] _reduction State of the reduction. The references to
+/// _link are moved to its parent link.
+void ReduceSDFExtensionReferencesToParent(urdf::LinkSharedPtr _link,
+    SDFExtensionReduction &_reduction);
+
+/// \brief reduced fixed joints:  add an extension to the lists of the link
+/// names that the text of an element and its descendants may reference.
+/// This is a superset of the references that are updated by
+/// ReduceSDFExtensionFrameReplace().
+/// \param[in] _ge The extension.
+/// \param[in] _elem Element of one of the blobs of _ge.
+/// \param[in,out] _references Extensions by the link names they may
+/// reference.
+void AddSDFExtensionLinkReferences(const SDFExtensionPtr &_ge,
+    tinyxml2::XMLElement *_elem, StringSDFExtensionPtrMap &_references);
 
 /// reduced fixed joints:  apply appropriate frame updates
 ///   in urdf extensions when doing fixed joint reduction
@@ -269,6 +339,28 @@ bool URDF2SDF::IsURDF(const std::string &_filename)
   return false;
 }
 
+/////////////////////////////////////////////////
+/// \brief Parse a double like std::stod, but always with a '.' decimal
+/// separator, whatever the current locale is.
+/// \param[in] _str The string to parse.
+/// \return The parsed value.
+/// \throws std::invalid_argument if _str does not start with a number.
+/// \throws std::out_of_range if the number does not fit in a double.
+double ParseDouble(const std::string &_str)
+{
+  double value = 0;
+  std::size_t length = 0;
+  switch (parseReal(trimView(_str), true, value, length))
+  {
+    case ParseNumberResult::OK:
+      return value;
+    case ParseNumberResult::OUT_OF_RANGE:
+      throw std::out_of_range("ParseDouble: " + _str);
+    default:
+      throw std::invalid_argument("ParseDouble: " + _str);
+  }
+}
+
 /////////////////////////////////////////////////
 urdf::Vector3 ParseVector3(const std::string &_str, double _scale)
 {
@@ -281,7 +373,7 @@ urdf::Vector3 ParseVector3(const std::string &_str, double _scale)
     {
       try
       {
-        vals.push_back(_scale * std::stod(pieces[i]));
+        vals.push_back(_scale * ParseDouble(pieces[i]));
       }
       catch(std::invalid_argument &)
       {
@@ -330,6 +422,7 @@ urdf::Vector3 ParseVector3(tinyxml2::XMLNode *_key, double _scale)
 std::string Vector32Str(const urdf::Vector3 _vector)
 {
   std::stringstream ss;
+  ss.imbue(std::locale::classic());
   ss << _vector.x;
   ss << " ";
   ss << _vector.y;
@@ -339,7 +432,7 @@ std::string Vector32Str(const urdf::Vector3 _vector)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Check and add collision to parent link
+/// \brief Add collision to parent link
 /// \param[in] _parentLink destination for _collision
 /// \param[in] _name urdfdom 0.3+: urdf collision group name with lumped
 ///            collision info (see ReduceCollisionsToParent).
@@ -350,29 +443,14 @@ void ReduceCollisionToParent(urdf::LinkSharedPtr _parentLink,
                              const std::string &_name,
                              urdf::CollisionSharedPtr _collision)
 {
-  // added a check to see if _collision already exist in
-  // _parentLink::collision_array if not, add it.
+  // each collision is moved once, straight to the link that keeps it,
+  // so it cannot already exist in _parentLink::collision_array
   _collision->name = _name;
-  std::vector<urdf::CollisionSharedPtr>::iterator collisionIt =
-    find(_parentLink->collision_array.begin(),
-         _parentLink->collision_array.end(),
-         _collision);
-  if (collisionIt != _parentLink->collision_array.end())
-  {
-    sdfwarn << "attempted to add collision [" << _collision->name
-            << "] to link ["
-            << _parentLink->name
-            << "], but it already exists in collision_array under name ["
-            << (*collisionIt)->name << "]\n";
-  }
-  else
-  {
-    _parentLink->collision_array.push_back(_collision);
-  }
+  _parentLink->collision_array.push_back(_collision);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Check and add visual to parent link
+/// \brief Add visual to parent link
 /// \param[in] _parentLink destination for _visual
 /// \param[in] _name urdfdom 0.3+: urdf visual group name with lumped
 ///            visual info (see ReduceVisualsToParent).
@@ -383,46 +461,99 @@ void ReduceVisualToParent(urdf::LinkSharedPtr _parentLink,
                           const std::string &_name,
                           urdf::VisualSharedPtr _visual)
 {
-  // added a check to see if _visual already exist in
-  // _parentLink::visual_array if not, add it.
+  // each visual is moved once, straight to the link that keeps it,
+  // so it cannot already exist in _parentLink::visual_array
   _visual->name = _name;
-  std::vector<urdf::VisualSharedPtr>::iterator visualIt =
-    find(_parentLink->visual_array.begin(),
-         _parentLink->visual_array.end(),
-         _visual);
-  if (visualIt != _parentLink->visual_array.end())
-  {
-    sdfwarn << "attempted to add visual [" << _visual->name
-            << "] to link ["
-            << _parentLink->name
-            << "], but it already exists in visual_array under name ["
-            << (*visualIt)->name << "]\n";
+  _parentLink->visual_array.push_back(_visual);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Check if a link is lumped into its parent link by fixed joint
+/// reduction.
+/// \param[in] _state State of the conversion.
+/// \param[in] _link The link.
+/// \return True if the parent joint of _link is reduced.
+bool LinkIsReduced(const URDF2SDFState &_state, urdf::LinkSharedPtr _link)
+{
+  return _link->getParent() && _link->getParent()->name != "world" &&
+      _link->parent_joint &&
+      FixedJointShouldBeReduced(_state, _link->parent_joint);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief reduce fixed joints: move visuals, collisions, joints and sdf
+/// extensions of reduced links straight to the link that keeps them. The
+/// tree is walked once from the root, carrying for each link the nearest
+/// ancestor that is not reduced and the pose of the link in that ancestor's
+/// frame, so lumped elements are transformed once whatever the depth of the
+/// fixed joint chain. Visuals and collisions are added in the same order as
+/// lumping them one level at a time would.
+/// \param[in,out] _state State of the conversion.
+/// \param[in] _link Link to visit.
+/// \param[in] _lumpParent Link that keeps the elements of _link, or null if
+/// _link is not reduced.
+/// \param[in] _lumpPose Pose of _link in the frame of _lumpParent.
+void LumpFixedJoints(URDF2SDFState &_state, urdf::LinkSharedPtr _link,
+                     urdf::LinkSharedPtr _lumpParent,
+                     const gz::math::Pose3d &_lumpPose)
+{
+  if (_lumpParent)
+  {
+    ReduceVisualsToParent(_link, _lumpParent, _lumpPose);
+    ReduceCollisionsToParent(_link, _lumpParent, _lumpPose);
+    ReduceJointsToParent(_state, _link, _lumpParent, _lumpPose);
+
+    // lump sdf extensions to parent, (give them new reference _link names)
+    ReduceSDFExtensionToParent(_state, _link, _lumpParent, _lumpPose);
   }
-  else
+
+  for (unsigned int i = 0 ; i < _link->child_links.size() ; ++i)
   {
-    _parentLink->visual_array.push_back(_visual);
+    urdf::LinkSharedPtr child = _link->child_links[i];
+    if (!LinkIsReduced(_state, child))
+    {
+      LumpFixedJoints(_state, child, nullptr, gz::math::Pose3d::Zero);
+    }
+    else if (_lumpParent)
+    {
+      LumpFixedJoints(_state, child, _lumpParent, TransformToParentFrame(
+          CopyPose(child->parent_joint->parent_to_joint_origin_transform),
+          _lumpPose));
+    }
+    else
+    {
+      LumpFixedJoints(_state, child, _link,
+          CopyPose(child->parent_joint->parent_to_joint_origin_transform));
+    }
   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// reduce fixed joints by lumping inertial, visual and
-// collision elements of the child link into the parent link
-void ReduceFixedJoints(tinyxml2::XMLElement *_root, urdf::LinkSharedPtr _link)
+/// \brief reduce fixed joints: lump inertial of the child link into the
+/// parent link, update references to the child link in sdf extensions, and
+/// memorialize the reduced joint and link with frames. Children are reduced
+/// before their parent, since the inertial of a link includes the links
+/// reduced into it.
+/// \param[in,out] _state State of the conversion.
+/// \param[in] _link Link to reduce.
+/// \param[in,out] _reduction State of the reduction.
+void ReduceFixedJointExtensions(URDF2SDFState &_state,
+                                urdf::LinkSharedPtr _link,
+                                SDFExtensionReduction &_reduction)
 {
   // if child is attached to self by fixed joint first go up the tree,
   //   check its children recursively
   for (unsigned int i = 0 ; i < _link->child_links.size() ; ++i)
   {
-    if (FixedJointShouldBeReduced(_link->child_links[i]->parent_joint))
+    if (FixedJointShouldBeReduced(_state, _link->child_links[i]->parent_joint))
     {
-      ReduceFixedJoints(_root, _link->child_links[i]);
+      ReduceFixedJointExtensions(_state, _link->child_links[i], _reduction);
     }
   }
 
   // reduce this _link's stuff up the tree to parent but skip first joint
   //   if it's the world
-  if (_link->getParent() && _link->getParent()->name != "world" &&
-      _link->parent_joint && FixedJointShouldBeReduced(_link->parent_joint) )
+  if (LinkIsReduced(_state, _link))
   {
     sdfdbg << "Fixed Joint Reduction: extension lumping from ["
            << _link->name << "] to [" << _link->getParent()->name << "]\n";
@@ -457,27 +588,76 @@ void ReduceFixedJoints(tinyxml2::XMLElement *_root, urdf::LinkSharedPtr _link)
     sdfFrameToExtension(jointFrame);
     sdfFrameToExtension(linkFrame);
 
-    // Add //frame tags to model extension vector
-    g_extensions[""].push_back(sdfExt);
+    // Frame blobs are not changed by ReduceSDFExtensionFrameReplace, so
+    // they are kept out of the extension map until every link is reduced
+    // instead of being searched again at every reduction.
+    _reduction.frames.push_back(sdfExt);
 
-    // lump sdf extensions to parent, (give them new reference _link names)
-    ReduceSDFExtensionToParent(_link);
+    // the extensions of _link and of the links reduced into it are now
+    // carried by the reduction of _link
+    _reduction.reducedInto[_link->name] = _link;
+    for (const urdf::LinkSharedPtr &child : _link->child_links)
+    {
+      if (LinkIsReduced(_state, child))
+      {
+        _reduction.reducedInto[child->name] = _link;
+      }
+    }
 
-    // reduce _link elements to parent
+    // update references to _link in sdf extensions
+    ReduceSDFExtensionReferencesToParent(_link, _reduction);
+
+    // reduce _link inertial to parent
     ReduceInertialToParent(_link);
-    ReduceVisualsToParent(_link);
-    ReduceCollisionsToParent(_link);
-    ReduceJointsToParent(_link);
   }
 
   // continue down the tree for non-fixed joints
   for (unsigned int i = 0 ; i < _link->child_links.size() ; ++i)
   {
-    if (!FixedJointShouldBeReduced(_link->child_links[i]->parent_joint))
+    if (!FixedJointShouldBeReduced(_state, _link->child_links[i]->parent_joint))
+    {
+      ReduceFixedJointExtensions(_state, _link->child_links[i], _reduction);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// reduce fixed joints by lumping inertial, visual and
+// collision elements of the child link into the parent link
+// \param[in,out] _state State of the conversion.
+// \param[in] _link root link of the tree to reduce.
+void ReduceFixedJoints(URDF2SDFState &_state, urdf::LinkSharedPtr _link)
+{
+  // Index the extensions by the link names they may reference, so each
+  // reduced link only searches the extensions that may refer to it.
+  SDFExtensionReduction reduction;
+  for (const auto &ext : _state.extensions)
+  {
+    for (const SDFExtensionPtr &ge : ext.second)
     {
-      ReduceFixedJoints(_root, _link->child_links[i]);
+      reduction.extensionLinks[ge.get()] = ext.first;
+      for (const XMLDocumentPtr &blob : ge->blobs)
+      {
+        for (tinyxml2::XMLElement *elem = blob->FirstChildElement(); elem;
+             elem = elem->NextSiblingElement())
+        {
+          AddSDFExtensionLinkReferences(ge, elem, reduction.references);
+        }
+      }
     }
   }
+
+  ReduceFixedJointExtensions(_state, _link, reduction);
+
+  // Add //frame tags to model extension vector
+  if (!reduction.frames.empty())
+  {
+    std::vector<SDFExtensionPtr> &modelExtensions = _state.extensions[""];
+    modelExtensions.insert(modelExtensions.end(), reduction.frames.begin(),
+                           reduction.frames.end());
+  }
+
+  LumpFixedJoints(_state, _link, nullptr, gz::math::Pose3d::Zero);
 }
 
 // ODE dMatrix
@@ -944,10 +1124,14 @@ void ReduceInertialToParent(urdf::LinkSharedPtr _link)
 /////////////////////////////////////////////////
 /// \brief reduce fixed joints:  lump visuals to parent link
 /// \param[in] _link take all visuals from _link and lump/move them
-///            to the parent link (_link->getParentLink()).
-void ReduceVisualsToParent(urdf::LinkSharedPtr _link)
+///            to _lumpParent.
+/// \param[in] _lumpParent nearest ancestor of _link that is not reduced.
+/// \param[in] _lumpPose pose of _link in the frame of _lumpParent.
+void ReduceVisualsToParent(urdf::LinkSharedPtr _link,
+                           urdf::LinkSharedPtr _lumpParent,
+                           const gz::math::Pose3d &_lumpPose)
 {
-  // lump all visuals of _link to _link->getParent().
+  // lump all visuals of _link to _lumpParent.
   // modify visual name (urdf 0.3.x) or
   //        visual group name (urdf 0.2.x)
   // to indicate that it was lumped (fixed joint reduced)
@@ -970,7 +1154,7 @@ void ReduceVisualsToParent(urdf::LinkSharedPtr _link)
       newVisualName = (*visualIt)->name;
       sdfdbg << "re-lumping visual [" << (*visualIt)->name
              << "] for link [" << _link->name
-             << "] to parent [" << _link->getParent()->name
+             << "] to parent [" << _lumpParent->name
              << "] with name [" << newVisualName << "]\n";
     }
     else
@@ -985,29 +1169,31 @@ void ReduceVisualsToParent(urdf::LinkSharedPtr _link)
       }
       sdfdbg << "lumping visual [" << (*visualIt)->name
              << "] for link [" << _link->name
-             << "] to parent [" << _link->getParent()->name
+             << "] to parent [" << _lumpParent->name
              << "] with name [" << newVisualName << "]\n";
     }
 
     // transform visual origin from _link frame to
     // parent link frame before adding to parent
-    (*visualIt)->origin = TransformToParentFrame(
-        (*visualIt)->origin,
-        _link->parent_joint->parent_to_joint_origin_transform);
+    (*visualIt)->origin = CopyPose(TransformToParentFrame(
+        CopyPose((*visualIt)->origin), _lumpPose));
 
     // add the modified visual to parent
-    ReduceVisualToParent(_link->getParent(), newVisualName,
-                         *visualIt);
+    ReduceVisualToParent(_lumpParent, newVisualName, *visualIt);
   }
 }
 
 /////////////////////////////////////////////////
 /// \brief reduce fixed joints:  lump collisions to parent link
 /// \param[in] _link take all collisions from _link and lump/move them
-///            to the parent link (_link->getParentLink()).
-void ReduceCollisionsToParent(urdf::LinkSharedPtr _link)
+///            to _lumpParent.
+/// \param[in] _lumpParent nearest ancestor of _link that is not reduced.
+/// \param[in] _lumpPose pose of _link in the frame of _lumpParent.
+void ReduceCollisionsToParent(urdf::LinkSharedPtr _link,
+                              urdf::LinkSharedPtr _lumpParent,
+                              const gz::math::Pose3d &_lumpPose)
 {
-  // lump all collisions of _link to _link->getParent().
+  // lump all collisions of _link to _lumpParent.
   // modify collision name (urdf 0.3.x) or
   //        collision group name (urdf 0.2.x)
   // to indicate that it was lumped (fixed joint reduced)
@@ -1029,7 +1215,7 @@ void ReduceCollisionsToParent(urdf::LinkSharedPtr _link)
       newCollisionName = (*collisionIt)->name;
       sdfdbg << "re-lumping collision [" << (*collisionIt)->name
              << "] for link [" << _link->name
-             << "] to parent [" << _link->getParent()->name
+             << "] to parent [" << _lumpParent->name
              << "] with name [" << newCollisionName << "]\n";
     }
     else
@@ -1044,50 +1230,46 @@ void ReduceCollisionsToParent(urdf::LinkSharedPtr _link)
       }
       sdfdbg << "lumping collision [" << (*collisionIt)->name
              << "] for link [" << _link->name
-             << "] to parent [" << _link->getParent()->name
+             << "] to parent [" << _lumpParent->name
              << "] with name [" << newCollisionName << "]\n";
     }
     // transform collision origin from _link frame to
     // parent link frame before adding to parent
-    (*collisionIt)->origin = TransformToParentFrame(
-        (*collisionIt)->origin,
-        _link->parent_joint->parent_to_joint_origin_transform);
+    (*collisionIt)->origin = CopyPose(TransformToParentFrame(
+        CopyPose((*collisionIt)->origin), _lumpPose));
 
     // add the modified collision to parent
-    ReduceCollisionToParent(_link->getParent(), newCollisionName,
-                            *collisionIt);
+    ReduceCollisionToParent(_lumpParent, newCollisionName, *collisionIt);
   }
 }
 
 /////////////////////////////////////////////////
 /// reduce fixed joints:  lump joints to parent link
-void ReduceJointsToParent(urdf::LinkSharedPtr _link)
+/// \param[in] _state State of the conversion.
+/// \param[in] _link link whose child joints that are not reduced are moved
+///            to _lumpParent.
+/// \param[in] _lumpParent nearest ancestor of _link that is not reduced.
+/// \param[in] _lumpPose pose of _link in the frame of _lumpParent.
+void ReduceJointsToParent(const URDF2SDFState &_state,
+                          urdf::LinkSharedPtr _link,
+                          urdf::LinkSharedPtr _lumpParent,
+                          const gz::math::Pose3d &_lumpPose)
 {
   // set child link's parentJoint's parent link to
   // a parent link up stream that does not have a fixed parentJoint
   for (unsigned int i = 0 ; i < _link->child_links.size() ; ++i)
   {
     urdf::JointSharedPtr parentJoint = _link->child_links[i]->parent_joint;
-    if (!FixedJointShouldBeReduced(parentJoint))
+    if (!FixedJointShouldBeReduced(_state, parentJoint))
     {
-      // go down the tree until we hit a parent joint that is not fixed
-      urdf::LinkSharedPtr newParentLink = _link;
-      while (newParentLink->parent_joint &&
-             newParentLink->getParent()->name != "world" &&
-             FixedJointShouldBeReduced(newParentLink->parent_joint) )
-      {
-        parentJoint->parent_to_joint_origin_transform =
+      parentJoint->parent_to_joint_origin_transform = CopyPose(
           TransformToParentFrame(
-              parentJoint->parent_to_joint_origin_transform,
-              newParentLink->parent_joint->parent_to_joint_origin_transform);
-        newParentLink = newParentLink->getParent();
-      }
+              CopyPose(parentJoint->parent_to_joint_origin_transform),
+              _lumpPose));
       // now set the _link->child_links[i]->parent_joint's parent link to
-      // the newParentLink
-      _link->child_links[i]->setParent(newParentLink);
-      parentJoint->parent_link_name = newParentLink->name;
-      // and set the _link->child_links[i]->parent_joint's
-      // parent_to_joint_origin_transform as the aggregated anchor transform?
+      // the _lumpParent
+      _link->child_links[i]->setParent(_lumpParent);
+      parentJoint->parent_link_name = _lumpParent->name;
     }
   }
 }
@@ -1104,16 +1286,18 @@ std::string lowerStr(const std::string &_str)
   return out;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Private data for URDF2SDF.
+class URDF2SDF::Implementation
+{
+  /// \brief State of the conversion, with the default options.
+  public: URDF2SDFState state;
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 URDF2SDF::URDF2SDF()
+  : dataPtr(gz::utils::MakeUniqueImpl<Implementation>())
 {
-  // default options
-  g_enforceLimits = true;
-  g_reduceFixedJoints = true;
-  g_extensions.clear();
-  g_initialRobotPoseValid = false;
-  g_fixedJointsTransformedInRevoluteJoints.clear();
-  g_fixedJointsTransformedInFixedJoints.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1127,6 +1311,7 @@ URDF2SDF::~URDF2SDF()
 std::string Values2str(unsigned int _count, const double *_values)
 {
   std::stringstream ss;
+  ss.imbue(std::locale::classic());
   ss.precision(g_outputDecimalPrecision);
   for (unsigned int i = 0 ; i < _count ; ++i)
   {
@@ -1146,6 +1331,7 @@ std::string Values2str(unsigned int _count, const double *_values)
 std::string Values2str(unsigned int _count, const int *_values)
 {
   std::stringstream ss;
+  ss.imbue(std::locale::classic());
   for (unsigned int i = 0 ; i < _count ; ++i)
   {
     if (i > 0)
@@ -1224,7 +1410,7 @@ std::string GetKeyValueAsString(tinyxml2::XMLElement* _elem)
 }
 
 /////////////////////////////////////////////////
-void ParseRobotOrigin(tinyxml2::XMLDocument &_urdfXml)
+void ParseRobotOrigin(URDF2SDFState &_state, tinyxml2::XMLDocument &_urdfXml)
 {
   tinyxml2::XMLElement *robotXml = _urdfXml.FirstChildElement("robot");
   tinyxml2::XMLElement *originXml = robotXml->FirstChildElement("origin");
@@ -1233,11 +1419,11 @@ void ParseRobotOrigin(tinyxml2::XMLDocument &_urdfXml)
     const char *xyzstr = originXml->Attribute("xyz");
     if (xyzstr == nullptr)
     {
-      g_initialRobotPose.position = urdf::Vector3(0, 0, 0);
+      _state.initialRobotPose.position = urdf::Vector3(0, 0, 0);
     }
     else
     {
-      g_initialRobotPose.position = ParseVector3(std::string(xyzstr));
+      _state.initialRobotPose.position = ParseVector3(std::string(xyzstr));
     }
     const char *rpystr = originXml->Attribute("rpy");
     urdf::Vector3 rpy;
@@ -1249,22 +1435,23 @@ void ParseRobotOrigin(tinyxml2::XMLDocument &_urdfXml)
     {
       rpy = ParseVector3(std::string(rpystr));
     }
-    g_initialRobotPose.rotation.setFromRPY(rpy.x, rpy.y, rpy.z);
-    g_initialRobotPoseValid = true;
+    _state.initialRobotPose.rotation.setFromRPY(rpy.x, rpy.y, rpy.z);
+    _state.initialRobotPoseValid = true;
   }
 }
 
 /////////////////////////////////////////////////
-void InsertRobotOrigin(tinyxml2::XMLElement *_elem)
+void InsertRobotOrigin(const URDF2SDFState &_state,
+                       tinyxml2::XMLElement *_elem)
 {
-  if (g_initialRobotPoseValid)
+  if (_state.initialRobotPoseValid)
   {
     // set transform
     double pose[6];
-    pose[0] = g_initialRobotPose.position.x;
-    pose[1] = g_initialRobotPose.position.y;
-    pose[2] = g_initialRobotPose.position.z;
-    g_initialRobotPose.rotation.getRPY(pose[3], pose[4], pose[5]);
+    pose[0] = _state.initialRobotPose.position.x;
+    pose[1] = _state.initialRobotPose.position.y;
+    pose[2] = _state.initialRobotPose.position.z;
+    _state.initialRobotPose.rotation.getRPY(pose[3], pose[4], pose[5]);
     AddKeyValue(_elem, "pose", Values2str(6, pose));
   }
 }
@@ -1272,10 +1459,11 @@ void InsertRobotOrigin(tinyxml2::XMLElement *_elem)
 ////////////////////////////////////////////////////////////////////////////////
 void URDF2SDF::ParseSDFExtension(tinyxml2::XMLDocument &_urdfXml)
 {
+  URDF2SDFState &state = this->dataPtr->state;
   tinyxml2::XMLElement* robotXml = _urdfXml.FirstChildElement("robot");
 
   // Get all SDF extension elements, put everything in
-  //   g_extensions map, containing a key string
+  //   extensions map of the state, containing a key string
   //   (link/joint name) and values
   for (tinyxml2::XMLElement* sdfXml = robotXml->FirstChildElement("gazebo");
        sdfXml; sdfXml = sdfXml->NextSiblingElement("gazebo"))
@@ -1293,11 +1481,11 @@ void URDF2SDF::ParseSDFExtension(tinyxml2::XMLDocument &_urdfXml)
       refStr = std::string(ref);
     }
 
-    if (g_extensions.find(refStr) == g_extensions.end())
+    if (state.extensions.find(refStr) == state.extensions.end())
     {
       // create extension map for reference
       std::vector<SDFExtensionPtr> ge;
-      g_extensions.insert(std::make_pair(refStr, ge));
+      state.extensions.insert(std::make_pair(refStr, ge));
     }
 
     // create and insert a new SDFExtension into the map
@@ -1398,27 +1586,27 @@ void URDF2SDF::ParseSDFExtension(tinyxml2::XMLDocument &_urdfXml)
       else if (strcmp(childElem->Name(), "dampingFactor") == 0)
       {
         sdf->isDampingFactor = true;
-        sdf->dampingFactor = std::stod(GetKeyValueAsString(childElem));
+        sdf->dampingFactor = ParseDouble(GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "maxVel") == 0)
       {
         sdf->isMaxVel = true;
-        sdf->maxVel = std::stod(GetKeyValueAsString(childElem));
+        sdf->maxVel = ParseDouble(GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "minDepth") == 0)
       {
         sdf->isMinDepth = true;
-        sdf->minDepth = std::stod(GetKeyValueAsString(childElem));
+        sdf->minDepth = ParseDouble(GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "mu1") == 0)
       {
         sdf->isMu1 = true;
-        sdf->mu1 = std::stod(GetKeyValueAsString(childElem));
+        sdf->mu1 = ParseDouble(GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "mu2") == 0)
       {
         sdf->isMu2 = true;
-        sdf->mu2 = std::stod(GetKeyValueAsString(childElem));
+        sdf->mu2 = ParseDouble(GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "fdir1") == 0)
       {
@@ -1427,12 +1615,12 @@ void URDF2SDF::ParseSDFExtension(tinyxml2::XMLDocument &_urdfXml)
       else if (strcmp(childElem->Name(), "kp") == 0)
       {
         sdf->isKp = true;
-        sdf->kp = std::stod(GetKeyValueAsString(childElem));
+        sdf->kp = ParseDouble(GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "kd") == 0)
       {
         sdf->isKd = true;
-        sdf->kd = std::stod(GetKeyValueAsString(childElem));
+        sdf->kd = ParseDouble(GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "selfCollide") == 0)
       {
@@ -1458,32 +1646,32 @@ void URDF2SDF::ParseSDFExtension(tinyxml2::XMLDocument &_urdfXml)
       else if (strcmp(childElem->Name(), "laserRetro") == 0)
       {
         sdf->isLaserRetro = true;
-        sdf->laserRetro = std::stod(GetKeyValueAsString(childElem));
+        sdf->laserRetro = ParseDouble(GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "springReference") == 0)
       {
         sdf->isSpringReference = true;
-        sdf->springReference = std::stod(GetKeyValueAsString(childElem));
+        sdf->springReference = ParseDouble(GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "springStiffness") == 0)
       {
         sdf->isSpringStiffness = true;
-        sdf->springStiffness = std::stod(GetKeyValueAsString(childElem));
+        sdf->springStiffness = ParseDouble(GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "stopCfm") == 0)
       {
         sdf->isStopCfm = true;
-        sdf->stopCfm = std::stod(GetKeyValueAsString(childElem));
+        sdf->stopCfm = ParseDouble(GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "stopErp") == 0)
       {
         sdf->isStopErp = true;
-        sdf->stopErp = std::stod(GetKeyValueAsString(childElem));
+        sdf->stopErp = ParseDouble(GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "fudgeFactor") == 0)
       {
         sdf->isFudgeFactor = true;
-        sdf->fudgeFactor = std::stod(GetKeyValueAsString(childElem));
+        sdf->fudgeFactor = ParseDouble(GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "provideFeedback") == 0)
       {
@@ -1534,7 +1722,7 @@ void URDF2SDF::ParseSDFExtension(tinyxml2::XMLDocument &_urdfXml)
         if (lowerStr(valueStr) == "true" || lowerStr(valueStr) == "yes" ||
             valueStr == "1")
         {
-          g_fixedJointsTransformedInRevoluteJoints.insert(refStr);
+          state.fixedJointsTransformedInRevoluteJoints.insert(refStr);
         }
       }
       else if (strcmp(childElem->Name(), "preserveFixedJoint") == 0)
@@ -1544,7 +1732,7 @@ void URDF2SDF::ParseSDFExtension(tinyxml2::XMLDocument &_urdfXml)
         if (lowerStr(valueStr) == "true" || lowerStr(valueStr) == "yes" ||
             valueStr == "1")
         {
-          g_fixedJointsTransformedInFixedJoints.insert(refStr);
+          state.fixedJointsTransformedInFixedJoints.insert(refStr);
         }
       }
       else
@@ -1564,20 +1752,21 @@ void URDF2SDF::ParseSDFExtension(tinyxml2::XMLDocument &_urdfXml)
     }
 
     // insert into my map
-    (g_extensions.find(refStr))->second.push_back(sdf);
+    (state.extensions.find(refStr))->second.push_back(sdf);
   }
 
   // Handle fixed joints for which both disableFixedJointLumping
   // and preserveFixedJoint options are present
   for (auto& fixedJointConvertedToFixed:
-             g_fixedJointsTransformedInFixedJoints)
+             state.fixedJointsTransformedInFixedJoints)
   {
     // If both options are present, the model creator is aware of the
     // existence of the preserveFixedJoint option and the
     // disableFixedJointLumping option is there only for backward compatibility
     // For this reason, if both options are present then the preserveFixedJoint
     // option has the precedence
-    g_fixedJointsTransformedInRevoluteJoints.erase(fixedJointConvertedToFixed);
+    state.fixedJointsTransformedInRevoluteJoints.erase(
+        fixedJointConvertedToFixed);
   }
 }
 
@@ -1601,7 +1790,8 @@ void CopyBlob(tinyxml2::XMLElement *_src, tinyxml2::XMLElement *_blob_parent)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void InsertSDFExtensionCollision(tinyxml2::XMLElement *_elem,
+void InsertSDFExtensionCollision(URDF2SDFState &_state,
+                                 tinyxml2::XMLElement *_elem,
                                  const std::string &_linkName)
 {
   // loop through extensions for the whole model
@@ -1610,8 +1800,8 @@ void InsertSDFExtensionCollision(tinyxml2::XMLElement *_elem,
   //   - urdf collision name -> sdf collision name conversion
   //   - fixed joint reduction / lumping
   for (StringSDFExtensionPtrMap::iterator
-      sdfIt = g_extensions.begin();
-      sdfIt != g_extensions.end(); ++sdfIt)
+      sdfIt = _state.extensions.begin();
+      sdfIt != _state.extensions.end(); ++sdfIt)
   {
     if (sdfIt->first == _linkName)
     {
@@ -1911,7 +2101,8 @@ void InsertSDFExtensionCollision(tinyxml2::XMLElement *_elem,
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void InsertSDFExtensionVisual(tinyxml2::XMLElement *_elem,
+void InsertSDFExtensionVisual(URDF2SDFState &_state,
+                              tinyxml2::XMLElement *_elem,
                               const std::string &_linkName)
 {
   // loop through extensions for the whole model
@@ -1920,8 +2111,8 @@ void InsertSDFExtensionVisual(tinyxml2::XMLElement *_elem,
   //   - urdf visual name -> sdf visual name conversion
   //   - fixed joint reduction / lumping
   for (StringSDFExtensionPtrMap::iterator
-      sdfIt = g_extensions.begin();
-      sdfIt != g_extensions.end(); ++sdfIt)
+      sdfIt = _state.extensions.begin();
+      sdfIt != _state.extensions.end(); ++sdfIt)
   {
     if (sdfIt->first == _linkName)
     {
@@ -2105,12 +2296,12 @@ void InsertSDFExtensionVisual(tinyxml2::XMLElement *_elem,
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void InsertSDFExtensionLink(tinyxml2::XMLElement *_elem,
+void InsertSDFExtensionLink(URDF2SDFState &_state, tinyxml2::XMLElement *_elem,
                             const std::string &_linkName)
 {
   for (StringSDFExtensionPtrMap::iterator
-       sdfIt = g_extensions.begin();
-       sdfIt != g_extensions.end(); ++sdfIt)
+       sdfIt = _state.extensions.begin();
+       sdfIt != _state.extensions.end(); ++sdfIt)
   {
     if (sdfIt->first == _linkName)
     {
@@ -2156,13 +2347,14 @@ void InsertSDFExtensionLink(tinyxml2::XMLElement *_elem,
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void InsertSDFExtensionJoint(tinyxml2::XMLElement *_elem,
+void InsertSDFExtensionJoint(URDF2SDFState &_state,
+                             tinyxml2::XMLElement *_elem,
                              const std::string &_jointName)
 {
   auto* doc = _elem->GetDocument();
   for (StringSDFExtensionPtrMap::iterator
-      sdfIt = g_extensions.begin();
-      sdfIt != g_extensions.end(); ++sdfIt)
+      sdfIt = _state.extensions.begin();
+      sdfIt != _state.extensions.end(); ++sdfIt)
   {
     if (sdfIt->first == _jointName)
     {
@@ -2303,11 +2495,12 @@ void InsertSDFExtensionJoint(tinyxml2::XMLElement *_elem,
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void InsertSDFExtensionRobot(tinyxml2::XMLElement *_elem)
+void InsertSDFExtensionRobot(URDF2SDFState &_state,
+                             tinyxml2::XMLElement *_elem)
 {
   for (StringSDFExtensionPtrMap::iterator
-      sdfIt = g_extensions.begin();
-      sdfIt != g_extensions.end(); ++sdfIt)
+      sdfIt = _state.extensions.begin();
+      sdfIt != _state.extensions.end(); ++sdfIt)
   {
     if (sdfIt->first.empty())
     {
@@ -2487,102 +2680,155 @@ gz::math::Pose3d TransformToParentFrame(
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void ReduceSDFExtensionToParent(urdf::LinkSharedPtr _link)
+void ReduceSDFExtensionToParent(URDF2SDFState &_state,
+                                urdf::LinkSharedPtr _link,
+                                urdf::LinkSharedPtr _lumpParent,
+                                const gz::math::Pose3d &_lumpPose)
 {
   /// \todo: move to header
   /// Take the link's existing list of gazebo extensions, transfer them
-  /// into parent link.  Along the way, update local transforms by adding
-  /// the additional transform to parent.  Also, look through all
-  /// referenced link names with plugins and update references to current
-  /// link to the parent link. (reduceGazeboExtensionFrameReplace())
+  /// into the link that keeps its elements.  Along the way, update local
+  /// transforms by adding the additional transform to that link.
+
+  std::string linkName = _link->name;
 
+  StringSDFExtensionPtrMap::iterator ext = _state.extensions.find(linkName);
+  if (ext == _state.extensions.end() || ext->second.empty())
+  {
+    return;
+  }
+
+  sdfdbg << "  REDUCE EXTENSION: moving reference from ["
+         << linkName << "] to [" << _lumpParent->name << "]\n";
+
+  // update reduction transform (for rays, cameras for now).
+  //   FIXME: contact frames too?
+  for (std::vector<SDFExtensionPtr>::iterator ge = ext->second.begin();
+       ge != ext->second.end(); ++ge)
+  {
+    (*ge)->reductionTransform = _lumpPose;
+    // for sensor and projector blocks only
+    ReduceSDFExtensionsTransform((*ge));
+  }
+
+  // move sdf extensions from _link into the _lumpParent's extensions,
+  // creating them if none exist. The entry of _link is removed, since the
+  // extensions are inserted by searching all entries.
+  std::vector<SDFExtensionPtr> &parentExt =
+    _state.extensions[_lumpParent->name];
+  parentExt.insert(parentExt.end(), ext->second.begin(), ext->second.end());
+  _state.extensions.erase(ext);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void ReduceSDFExtensionReferencesToParent(urdf::LinkSharedPtr _link,
+    SDFExtensionReduction &_reduction)
+{
   /// @todo: this is a very complicated module that updates the plugins
   /// based on fixed joint reduction really wish this could be a lot cleaner
 
-  std::string linkName = _link->name;
-
-  // update extension map with references to linkName
-  // this->ListSDFExtensions();
-  StringSDFExtensionPtrMap::iterator ext = g_extensions.find(linkName);
-  if (ext != g_extensions.end())
+  StringSDFExtensionPtrMap::iterator refs =
+    _reduction.references.find(_link->name);
+  if (refs == _reduction.references.end())
   {
-    sdfdbg << "  REDUCE EXTENSION: moving reference from ["
-           << linkName << "] to [" << _link->getParent()->name << "]\n";
+    return;
+  }
 
-    // update reduction transform (for rays, cameras for now).
-    //   FIXME: contact frames too?
-    for (std::vector<SDFExtensionPtr>::iterator ge = ext->second.begin();
-         ge != ext->second.end(); ++ge)
+  // search and replace _link name patterns within the plugin with new
+  // _link name and assign the proper reduction transform for the _link
+  // name pattern
+  sdfdbg << "  STRING REPLACE: instances of _link name ["
+         << _link->name << "] with [" << _link->getParent()->name << "]\n";
+  std::vector<SDFExtensionPtr> extensions;
+  extensions.swap(refs->second);
+  for (std::vector<SDFExtensionPtr>::iterator ge = extensions.begin();
+       ge != extensions.end(); ++ge)
+  {
+    // the reduction transform of an extension is the joint pose of the
+    // last reduction that carried it, as if the extensions were moved up
+    // one link at a time
+    auto home = _reduction.extensionLinks.find(ge->get());
+    if (home != _reduction.extensionLinks.end())
     {
-      (*ge)->reductionTransform = CopyPose(
-          _link->parent_joint->parent_to_joint_origin_transform);
-      // for sensor and projector blocks only
-      ReduceSDFExtensionsTransform((*ge));
+      auto into = _reduction.reducedInto.find(home->second);
+      if (into != _reduction.reducedInto.end())
+      {
+        while (into->second->name != into->first)
+        {
+          auto next = _reduction.reducedInto.find(into->second->name);
+          // skip the link in between next time
+          into->second = next->second;
+          into = next;
+        }
+        (*ge)->reductionTransform = CopyPose(
+            into->second->parent_joint->parent_to_joint_origin_transform);
+      }
     }
 
-    // find pointer to the existing extension with the new _link reference
-    std::string parentLinkName = _link->getParent()->name;
-    StringSDFExtensionPtrMap::iterator parentExt =
-      g_extensions.find(parentLinkName);
+    ReduceSDFExtensionFrameReplace(*ge, _link);
+  }
 
-    // if none exist, create new extension with parentLinkName
-    if (parentExt == g_extensions.end())
-    {
-      std::vector<SDFExtensionPtr> ge;
-      g_extensions.insert(std::make_pair(parentLinkName, ge));
-      parentExt = g_extensions.find(parentLinkName);
-    }
+  // the replaced references now name the parent link
+  std::vector<SDFExtensionPtr> &parentRefs =
+    _reduction.references[_link->getParent()->name];
+  parentRefs.insert(parentRefs.end(), extensions.begin(), extensions.end());
+}
 
-    // move sdf extensions from _link into the parent _link's extensions
-    for (std::vector<SDFExtensionPtr>::iterator ge = ext->second.begin();
-         ge != ext->second.end(); ++ge)
-    {
-      parentExt->second.push_back(*ge);
-    }
-    ext->second.clear();
+////////////////////////////////////////////////////////////////////////////////
+void AddSDFExtensionLinkReferences(const SDFExtensionPtr &_ge,
+    tinyxml2::XMLElement *_elem, StringSDFExtensionPtrMap &_references)
+{
+  for (tinyxml2::XMLElement *child = _elem->FirstChildElement(); child;
+       child = child->NextSiblingElement())
+  {
+    AddSDFExtensionLinkReferences(_ge, child, _references);
   }
 
-  // for extensions with empty reference, search and replace
-  // _link name patterns within the plugin with new _link name
-  // and assign the proper reduction transform for the _link name pattern
-  for (StringSDFExtensionPtrMap::iterator sdfIt = g_extensions.begin();
-       sdfIt != g_extensions.end(); ++sdfIt)
+  // the same values as GetKeyValueAsString
+  const char *value = _elem->Attribute("value");
+  if (!value)
   {
-    // update reduction transform (for contacts, rays, cameras for now).
-    for (std::vector<SDFExtensionPtr>::iterator ge = sdfIt->second.begin();
-         ge != sdfIt->second.end(); ++ge)
+    value = _elem->GetText();
+  }
+  if (!value)
+  {
+    return;
+  }
+
+  // a link name, a <link>/<projector> reference, or a contact collision
+  const std::string text = trim(value);
+  std::vector<std::string> names = {text, text.substr(0, text.find('/'))};
+  const std::string collisionExt(kCollisionExt);
+  if (text.size() > collisionExt.size() &&
+      text.compare(text.size() - collisionExt.size(), std::string::npos,
+                   collisionExt) == 0)
+  {
+    names.push_back(text.substr(0, text.size() - collisionExt.size()));
+  }
+
+  for (const std::string &name : names)
+  {
+    std::vector<SDFExtensionPtr> &extensions = _references[name];
+    if (extensions.empty() || extensions.back() != _ge)
     {
-      ReduceSDFExtensionFrameReplace(*ge, _link);
+      extensions.push_back(_ge);
     }
   }
-
-  // this->ListSDFExtensions();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 void ReduceSDFExtensionFrameReplace(SDFExtensionPtr _ge,
                                     urdf::LinkSharedPtr _link)
 {
-  std::string linkName = _link->name;
-  std::string parentLinkName = _link->getParent()->name;
-
   // HACK: need to do this more generally, but we also need to replace
   //       all instances of _link name with new link name
   //       e.g. contact sensor refers to
   //         <collision>base_link_collision</collision>
   //         and it needs to be reparented to
   //         <collision>base_footprint_collision</collision>
-  sdfdbg << "  STRING REPLACE: instances of _link name ["
-        << linkName << "] with [" << parentLinkName << "]\n";
   for (auto blobIt = _ge->blobs.begin();
          blobIt != _ge->blobs.end(); ++blobIt)
   {
-    tinyxml2::XMLPrinter debugStreamIn;
-    (*blobIt)->Print(&debugStreamIn);
-    sdfdbg << "        INITIAL STRING link ["
-           << linkName << "]-->[" << parentLinkName << "]: ["
-           << debugStreamIn.CStr() << "]\n";
-
     ReduceSDFExtensionContactSensorFrameReplace(blobIt, _link);
     ReduceSDFExtensionPluginFrameReplace(
         (*blobIt)->FirstChildElement(), _link, "plugin", "bodyName",
@@ -2614,9 +2860,10 @@ void ReduceSDFExtensionsTransform(SDFExtensionPtr _ge)
 ////////////////////////////////////////////////////////////////////////////////
 void URDF2SDF::ListSDFExtensions()
 {
+  URDF2SDFState &state = this->dataPtr->state;
   for (StringSDFExtensionPtrMap::iterator
-      sdfIt = g_extensions.begin();
-      sdfIt != g_extensions.end(); ++sdfIt)
+      sdfIt = state.extensions.begin();
+      sdfIt != state.extensions.end(); ++sdfIt)
   {
     int extCount = 0;
     for (std::vector<SDFExtensionPtr>::iterator ge = sdfIt->second.begin();
@@ -2642,9 +2889,10 @@ void URDF2SDF::ListSDFExtensions()
 ////////////////////////////////////////////////////////////////////////////////
 void URDF2SDF::ListSDFExtensions(const std::string &_reference)
 {
+  URDF2SDFState &state = this->dataPtr->state;
   for (StringSDFExtensionPtrMap::iterator
-      sdfIt = g_extensions.begin();
-      sdfIt != g_extensions.end(); ++sdfIt)
+      sdfIt = state.extensions.begin();
+      sdfIt != state.extensions.end(); ++sdfIt)
   {
     if (sdfIt->first == _reference)
     {
@@ -2666,7 +2914,7 @@ void URDF2SDF::ListSDFExtensions(const std::string &_reference)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void CreateSDF(tinyxml2::XMLElement *_root,
+void CreateSDF(URDF2SDFState &_state, tinyxml2::XMLElement *_root,
                urdf::LinkConstSharedPtr _link)
 {
   // Links without an <inertial> block will be considered to have zero mass.
@@ -2698,8 +2946,8 @@ void CreateSDF(tinyxml2::XMLElement *_root,
     // if the parent joint is reduced, which resolves the massless issue of this
     // link, no warnings will be emitted
     bool parentJointReduced = _link->parent_joint &&
-        FixedJointShouldBeReduced(_link->parent_joint) &&
-        g_reduceFixedJoints;
+        FixedJointShouldBeReduced(_state, _link->parent_joint) &&
+        _state.reduceFixedJoints;
 
     if (!parentJointReduced)
     {
@@ -2781,20 +3029,20 @@ void CreateSDF(tinyxml2::XMLElement *_root,
 
   // create <body:...> block for non fixed joint attached bodies that have mass
   if ((_link->getParent() && _link->getParent()->name == "world") ||
-      !g_reduceFixedJoints ||
+      !_state.reduceFixedJoints ||
       (!_link->parent_joint ||
-       !FixedJointShouldBeReduced(_link->parent_joint)))
+       !FixedJointShouldBeReduced(_state, _link->parent_joint)))
   {
     if (!linkHasZeroMass)
     {
-      CreateLink(_root, _link, gz::math::Pose3d::Zero);
+      CreateLink(_state, _root, _link, gz::math::Pose3d::Zero);
     }
   }
 
   // recurse into children
   for (unsigned int i = 0 ; i < _link->child_links.size() ; ++i)
   {
-    CreateSDF(_root, _link->child_links[i]);
+    CreateSDF(_state, _root, _link->child_links[i]);
   }
 }
 
@@ -2827,7 +3075,7 @@ urdf::Pose CopyPose(gz::math::Pose3d _pose)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void CreateLink(tinyxml2::XMLElement *_root,
+void CreateLink(URDF2SDFState &_state, tinyxml2::XMLElement *_root,
                 urdf::LinkConstSharedPtr _link,
                 const gz::math::Pose3d &_currentTransform)
 {
@@ -2861,23 +3109,23 @@ void CreateLink(tinyxml2::XMLElement *_root,
   CreateInertial(elem, _link);
 
   // create new collision block
-  CreateCollisions(elem, _link);
+  CreateCollisions(_state, elem, _link);
 
   // create new visual block
-  CreateVisuals(elem, _link);
+  CreateVisuals(_state, elem, _link);
 
   // copy sdf extensions data
-  InsertSDFExtensionLink(elem, _link->name);
+  InsertSDFExtensionLink(_state, elem, _link->name);
 
   // make a <joint:...> block
-  CreateJoint(_root, _link, _currentTransform);
+  CreateJoint(_state, _root, _link, _currentTransform);
 
   // add body to document
   _root->LinkEndChild(elem);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void CreateCollisions(tinyxml2::XMLElement* _elem,
+void CreateCollisions(URDF2SDFState &_state, tinyxml2::XMLElement* _elem,
                       urdf::LinkConstSharedPtr _link)
 {
   // loop through all collisions in
@@ -2915,14 +3163,14 @@ void CreateCollisions(tinyxml2::XMLElement* _elem,
     }
 
     // make a <collision> block
-    CreateCollision(_elem, _link, *collision, collisionName);
+    CreateCollision(_state, _elem, _link, *collision, collisionName);
 
     ++collisionCount;
   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void CreateVisuals(tinyxml2::XMLElement* _elem,
+void CreateVisuals(URDF2SDFState &_state, tinyxml2::XMLElement* _elem,
                    urdf::LinkConstSharedPtr _link)
 {
   // loop through all visuals in
@@ -2960,7 +3208,7 @@ void CreateVisuals(tinyxml2::XMLElement* _elem,
     }
 
     // make a <visual> block
-    CreateVisual(_elem, _link, *visual, visualName);
+    CreateVisual(_state, _elem, _link, *visual, visualName);
 
     ++visualCount;
   }
@@ -3006,7 +3254,7 @@ void CreateInertial(tinyxml2::XMLElement *_elem,
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void CreateJoint(tinyxml2::XMLElement *_root,
+void CreateJoint(URDF2SDFState &_state, tinyxml2::XMLElement *_root,
                  urdf::LinkConstSharedPtr _link,
                  const gz::math::Pose3d &/*_currentTransform*/)
 {
@@ -3046,16 +3294,17 @@ void CreateJoint(tinyxml2::XMLElement *_root,
   if (jtype == "fixed")
   {
     fixedJointConvertedToRevoluteJoint =
-      (g_fixedJointsTransformedInRevoluteJoints.find(_link->parent_joint->name)
-       != g_fixedJointsTransformedInRevoluteJoints.end());
+      (_state.fixedJointsTransformedInRevoluteJoints.find(
+           _link->parent_joint->name)
+       != _state.fixedJointsTransformedInRevoluteJoints.end());
   }
 
   // skip if joint type is fixed and it is lumped
   //   skip/return with the exception of root link being world,
   //   because there's no lumping there
   if (_link->getParent() && _link->getParent()->name != "world"
-      && FixedJointShouldBeReduced(_link->parent_joint)
-      && g_reduceFixedJoints)
+      && FixedJointShouldBeReduced(_state, _link->parent_joint)
+      && _state.reduceFixedJoints)
   {
     return;
   }
@@ -3113,7 +3362,7 @@ void CreateJoint(tinyxml2::XMLElement *_root,
                     Values2str(1, &_link->parent_joint->dynamics->friction));
       }
 
-      if (g_enforceLimits && _link->parent_joint->limits)
+      if (_state.enforceLimits && _link->parent_joint->limits)
       {
         if (jtype == "slider")
         {
@@ -3179,7 +3428,7 @@ void CreateJoint(tinyxml2::XMLElement *_root,
     }
 
     // copy sdf extensions data
-    InsertSDFExtensionJoint(joint, _link->parent_joint->name);
+    InsertSDFExtensionJoint(_state, joint, _link->parent_joint->name);
 
     // add joint to document
     _root->LinkEndChild(joint);
@@ -3187,7 +3436,7 @@ void CreateJoint(tinyxml2::XMLElement *_root,
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void CreateCollision(tinyxml2::XMLElement* _elem,
+void CreateCollision(URDF2SDFState &_state, tinyxml2::XMLElement* _elem,
                      urdf::LinkConstSharedPtr _link,
                      urdf::CollisionSharedPtr _collision,
                      const std::string &_oldLinkName)
@@ -3235,15 +3484,17 @@ void CreateCollision(tinyxml2::XMLElement* _elem,
   }
 
   // set additional data from extensions
-  InsertSDFExtensionCollision(sdfCollision, _link->name);
+  InsertSDFExtensionCollision(_state, sdfCollision, _link->name);
 
   // add geometry to body
   _elem->LinkEndChild(sdfCollision);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void CreateVisual(tinyxml2::XMLElement *_elem, urdf::LinkConstSharedPtr _link,
-    urdf::VisualSharedPtr _visual, const std::string &_oldLinkName)
+void CreateVisual(URDF2SDFState &_state, tinyxml2::XMLElement *_elem,
+                  urdf::LinkConstSharedPtr _link,
+                  urdf::VisualSharedPtr _visual,
+                  const std::string &_oldLinkName)
 {
   auto* doc = _elem->GetDocument();
   // begin create sdf visual node
@@ -3281,7 +3532,7 @@ void CreateVisual(tinyxml2::XMLElement *_elem, urdf::LinkConstSharedPtr _link,
   }
 
   // set additional data from extensions
-  InsertSDFExtensionVisual(sdfVisual, _link->name);
+  InsertSDFExtensionVisual(_state, sdfVisual, _link->name);
 
   if (_visual->material)
   {
@@ -3338,7 +3589,20 @@ void URDF2SDF::InitModelString(const std::string &_urdfStr,
                                tinyxml2::XMLDocument* _sdfXmlOut,
                                bool _enforceLimits)
 {
-  g_enforceLimits = _enforceLimits;
+  tinyxml2::XMLDocument urdfXml;
+  urdfXml.Parse(_urdfStr.c_str());
+  this->InitModel(urdfXml, _urdfStr, _config, _sdfXmlOut, _enforceLimits);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void URDF2SDF::InitModel(tinyxml2::XMLDocument &_urdfXml,
+                         const std::string &_urdfStr,
+                         const ParserConfig& _config,
+                         tinyxml2::XMLDocument* _sdfXmlOut,
+                         bool _enforceLimits)
+{
+  URDF2SDFState &state = this->dataPtr->state;
+  state.enforceLimits = _enforceLimits;
 
   // Create a RobotModel from string
   urdf::ModelInterfaceSharedPtr robotModel = urdf::parseURDF(_urdfStr);
@@ -3356,23 +3620,22 @@ void URDF2SDF::InitModelString(const std::string &_urdfStr,
   robot->SetAttribute("name", robotModel->getName().c_str());
 
   // parse sdf extension
-  tinyxml2::XMLDocument urdfXml;
-  if (urdfXml.Parse(_urdfStr.c_str()))
+  if (_urdfXml.Error())
   {
-    sdferr << "Unable to parse URDF string: " << urdfXml.ErrorStr() << "\n";
+    sdferr << "Unable to parse URDF string: " << _urdfXml.ErrorStr() << "\n";
     return;
   }
 
-  // Set g_reduceFixedJoints based on config value.
-  g_reduceFixedJoints = !_config.URDFPreserveFixedJoint();
+  // Set state.reduceFixedJoints based on config value.
+  state.reduceFixedJoints = !_config.URDFPreserveFixedJoint();
 
-  g_extensions.clear();
-  g_fixedJointsTransformedInFixedJoints.clear();
-  g_fixedJointsTransformedInRevoluteJoints.clear();
-  this->ParseSDFExtension(urdfXml);
+  state.extensions.clear();
+  state.fixedJointsTransformedInFixedJoints.clear();
+  state.fixedJointsTransformedInRevoluteJoints.clear();
+  this->ParseSDFExtension(_urdfXml);
 
   // Parse robot pose
-  ParseRobotOrigin(urdfXml);
+  ParseRobotOrigin(state, _urdfXml);
 
   urdf::LinkConstSharedPtr rootLink = robotModel->getRoot();
   tinyxml2::XMLElement *sdf;
@@ -3389,9 +3652,9 @@ void URDF2SDF::InitModelString(const std::string &_urdfStr,
     // parent link recursively
     // using the disabledFixedJointLumping or preserveFixedJoint options
     // is possible to disable fixed joint lumping only for selected joints
-    if (g_reduceFixedJoints)
+    if (state.reduceFixedJoints)
     {
-      ReduceFixedJoints(robot, urdf::const_pointer_cast<urdf::Link>(rootLink));
+      ReduceFixedJoints(state, urdf::const_pointer_cast<urdf::Link>(rootLink));
     }
 
     if (rootLink->name == "world")
@@ -3401,19 +3664,19 @@ void URDF2SDF::InitModelString(const std::string &_urdfStr,
           child = rootLink->child_links.begin();
           child != rootLink->child_links.end(); ++child)
       {
-        CreateSDF(robot, (*child));
+        CreateSDF(state, robot, (*child));
       }
     }
     else
     {
       // convert, starting from root link
-      CreateSDF(robot, rootLink);
+      CreateSDF(state, robot, rootLink);
     }
 
     // insert the extensions without reference into <robot> root level
-    InsertSDFExtensionRobot(robot);
+    InsertSDFExtensionRobot(state, robot);
 
-    InsertRobotOrigin(robot);
+    InsertRobotOrigin(state, robot);
 
     // Create new sdf
     sdf = _sdfXmlOut->NewElement("sdf");
@@ -3446,8 +3709,12 @@ void URDF2SDF::InitModelDoc(const tinyxml2::XMLDocument *_xmlDoc,
 {
   tinyxml2::XMLPrinter printer;
   _xmlDoc->Print(&printer);
-  std::string urdfStr = printer.CStr();
-  InitModelString(urdfStr, _config, _sdfXmlDoc);
+
+  // Extensions are read from a copy of the document, instead of parsing the
+  // printed string again.
+  tinyxml2::XMLDocument urdfXml;
+  _xmlDoc->DeepCopy(&urdfXml);
+  this->InitModel(urdfXml, printer.CStr(), _config, _sdfXmlDoc);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3458,7 +3725,9 @@ void URDF2SDF::InitModelFile(const std::string &_filename,
   tinyxml2::XMLDocument xmlDoc;
   if (!xmlDoc.LoadFile(_filename.c_str()))
   {
-    this->InitModelDoc(&xmlDoc, _config, _sdfXmlDoc);
+    tinyxml2::XMLPrinter printer;
+    xmlDoc.Print(&printer);
+    this->InitModel(xmlDoc, printer.CStr(), _config, _sdfXmlDoc);
   }
   else
   {
@@ -3468,16 +3737,18 @@ void URDF2SDF::InitModelFile(const std::string &_filename,
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-bool FixedJointShouldBeReduced(urdf::JointSharedPtr _jnt)
+bool FixedJointShouldBeReduced(const URDF2SDFState &_state,
+                               urdf::JointSharedPtr _jnt)
 {
     // A joint should be lumped only if its type is fixed and
     // the disabledFixedJointLumping or preserveFixedJoint
     // joint options are not set
     return (_jnt->type == urdf::Joint::FIXED &&
-              (g_fixedJointsTransformedInRevoluteJoints.find(_jnt->name) ==
-                 g_fixedJointsTransformedInRevoluteJoints.end()) &&
-              (g_fixedJointsTransformedInFixedJoints.find(_jnt->name) ==
-                 g_fixedJointsTransformedInFixedJoints.end()));
+              (_state.fixedJointsTransformedInRevoluteJoints.find(
+                   _jnt->name) ==
+                 _state.fixedJointsTransformedInRevoluteJoints.end()) &&
+              (_state.fixedJointsTransformedInFixedJoints.find(_jnt->name) ==
+                 _state.fixedJointsTransformedInFixedJoints.end()));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3552,6 +3823,7 @@ void ReduceSDFExtensionElementTransformReduction(
 
     // output updated pose to text
     std::ostringstream poseStream;
+    poseStream.imbue(std::locale::classic());
     poseStream << reductionXyz.x << " " << reductionXyz.y
                << " " << reductionXyz.z << " " << reductionRpy.x
                << " " << reductionRpy.y << " " << reductionRpy.z;
@@ -3682,6 +3954,8 @@ void ReduceSDFExtensionPluginFrameReplace(
                                   _reductionTransform.Rot().W());
 
         std::ostringstream xyzStream, rpyStream;
+        xyzStream.imbue(std::locale::classic());
+        rpyStream.imbue(std::locale::classic());
         xyzStream << reductionXyz.x << " " << reductionXyz.y << " "
                   << reductionXyz.z;
         urdf::Vector3 reductionRpy;
@@ -22,6 +22,8 @@
 
 #include <string>
 
+#include <gz/utils/ImplPtr.hh>
+
 #include "sdf/Console.hh"
 #include "sdf/ParserConfig.hh"
 #include "sdf/Types.hh"
@@ -33,7 +35,9 @@ namespace sdf
   inline namespace SDF_VERSION_NAMESPACE {
   //
 
-  /// \brief URDF to SDF converter
+  /// \brief URDF to SDF converter. Each object keeps the state of its own
+  /// conversion, so separate objects can convert on separate threads at the
+  /// same time.
   class URDF2SDF
   {
     /// \brief constructor
@@ -69,6 +73,22 @@ namespace sdf
                                  tinyxml2::XMLDocument *_sdfXmlDoc,
                                  bool _enforceLimits = true);
 
+    /// \brief convert a parsed urdf document to sdf xml document. The
+    /// document is used for the <gazebo> extensions and the robot origin,
+    /// so that it is not parsed again.
+    /// \param[in] _urdfXml document containing the urdf model, which must
+    /// have been parsed from _urdfStr with tinyxml2::PRESERVE_WHITESPACE.
+    /// \param[in] _urdfStr a string containing model urdf, for
+    /// urdf::parseURDF.
+    /// \param[in] _config Custom parser configuration
+    /// \param[inout] _sdfXmlDoc document to populate with the sdf model.
+    /// \param[in] _enforceLimits option to enforce joint limits
+    public: void InitModel(tinyxml2::XMLDocument &_urdfXml,
+                           const std::string &_urdfStr,
+                           const ParserConfig &_config,
+                           tinyxml2::XMLDocument *_sdfXmlDoc,
+                           bool _enforceLimits = true);
+
     /// \brief Return true if the filename is a URDF model.
     /// \param[in] _filename File to check.
     /// \return True if _filename is a URDF model.
@@ -83,6 +103,9 @@ namespace sdf
     /// things that do not belong in urdf but should be mapped into sdf
     /// @todo: do this using sdf definitions, not hard coded stuff
     private: void ParseSDFExtension(tinyxml2::XMLDocument &_urdfXml);
+
+    /// \brief Private data pointer.
+    GZ_UTILS_UNIQUE_IMPL_PTR(dataPtr)
   };
   }
 }
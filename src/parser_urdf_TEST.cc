@@ -18,6 +18,9 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "sdf/sdf.hh"
 #include "parser_urdf.hh"
@@ -842,6 +845,73 @@ TEST(URDFParser, CheckFixedJointOptions_NoOption_Repeated)
   ASSERT_FALSE(elem->HasElement("joint"));
 }
 
+/////////////////////////////////////////////////
+TEST(URDFParser, ConcurrentConversions)
+{
+  // Each conversion has its own state, so conversions with different
+  // options can run at the same time
+  std::ostringstream fixedJoint;
+  fixedJoint << "<robot name='test_robot'>"
+    << "  <link name='link1'>"
+    << "    <inertial>"
+    << "      <mass value='1.0'/>"
+    << "      <inertia ixx='1.0' ixy='0.0' ixz='0.0'"
+    << "               iyy='1.0' iyz='0.0' izz='1.0'/>"
+    << "    </inertial>"
+    << "  </link>"
+    << "  <link name='link2'>"
+    << "    <inertial>"
+    << "      <mass value='1.0'/>"
+    << "      <inertia ixx='1.0' ixy='0.0' ixz='0.0'"
+    << "               iyy='1.0' iyz='0.0' izz='1.0'/>"
+    << "    </inertial>"
+    << "  </link>"
+    << "  <joint name='joint1_2' type='fixed'>"
+    << "    <parent link='link1' />"
+    << "    <child  link='link2' />"
+    << "    <origin xyz='0.0 0.0 1.0' rpy='0.0 0.0 0.0' />"
+    << "  </joint>"
+    << "  <gazebo reference='link2'>"
+    << "    <self_collide>true</self_collide>"
+    << "  </gazebo>"
+    << "</robot>";
+
+  sdf::ParserConfig reduceConfig;
+  sdf::ParserConfig preserveConfig;
+  preserveConfig.URDFSetPreserveFixedJoint(true);
+  const std::string reduced =
+      convertUrdfStrToSdfStr(fixedJoint.str(), reduceConfig);
+  const std::string preserved =
+      convertUrdfStrToSdfStr(fixedJoint.str(), preserveConfig);
+  ASSERT_NE(reduced, preserved);
+
+  const unsigned int threadCount = 8;
+  std::vector<std::vector<std::string>> results(threadCount);
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < threadCount; ++t)
+  {
+    const sdf::ParserConfig &config =
+        t % 2 == 0 ? reduceConfig : preserveConfig;
+    threads.emplace_back([&fixedJoint, &results, &config, t]()
+        {
+          for (int i = 0; i < 50; ++i)
+          {
+            results[t].push_back(
+                convertUrdfStrToSdfStr(fixedJoint.str(), config));
+          }
+        });
+  }
+  for (std::thread &thread : threads)
+    thread.join();
+
+  for (unsigned int t = 0; t < threadCount; ++t)
+  {
+    ASSERT_EQ(50u, results[t].size());
+    for (const std::string &result : results[t])
+      EXPECT_EQ(t % 2 == 0 ? reduced : preserved, result);
+  }
+}
+
 /////////////////////////////////////////////////
 TEST(URDFParser, CheckJointTransform)
 {
@@ -969,6 +1039,95 @@ TEST(URDFParser, CheckJointTransform)
   std::string sdfStr = convertUrdfStrToSdfStr(str.str());
   EXPECT_EQ(expectedSdf, sdfStr);
 }
+
+/////////////////////////////////////////////////
+TEST(URDFParser, FixedJointChainReduction)
+{
+  // A chain of links connected by fixed joints is lumped into its first
+  // link, with the elements of every link in the order of the chain
+  std::ostringstream str;
+  str << "<robot name='test_robot'>";
+  for (int i = 0; i < 5; ++i)
+  {
+    str << "  <link name='link" << i << "'>"
+        << "    <inertial>"
+        << "      <mass value='1.0'/>"
+        << "      <inertia ixx='1.0' ixy='0.0' ixz='0.0'"
+        << "               iyy='1.0' iyz='0.0' izz='1.0'/>"
+        << "    </inertial>"
+        << "    <visual>"
+        << "      <geometry><box size='1 1 1'/></geometry>"
+        << "    </visual>"
+        << "    <collision>"
+        << "      <geometry><box size='1 1 1'/></geometry>"
+        << "    </collision>"
+        << "  </link>";
+  }
+  for (int i = 0; i < 4; ++i)
+  {
+    str << "  <joint name='joint" << i << "_" << i + 1 << "' type='"
+        << (i < 3 ? "fixed" : "continuous") << "'>"
+        << "    <parent link='link" << i << "' />"
+        << "    <child  link='link" << i + 1 << "' />"
+        << "    <origin xyz='1.0 0.0 0.0' rpy='0.0 0.0 0.0' />"
+        << "  </joint>";
+  }
+  str << "</robot>";
+
+  sdf::SDF sdfResult;
+  convertUrdfStrToSdf(str.str(), sdfResult);
+  sdf::ElementPtr model = sdfResult.Root();
+  ASSERT_NE(nullptr, model);
+  model = model->GetElement("model");
+  ASSERT_NE(nullptr, model);
+
+  sdf::ElementPtr link = model->GetElement("link");
+  ASSERT_NE(nullptr, link);
+  EXPECT_EQ("link0", link->Get<std::string>("name"));
+  EXPECT_DOUBLE_EQ(4.0, link->GetElement("inertial")->Get<double>("mass"));
+
+  const std::string visualNames[] =
+      {"link0_visual", "link1_visual_1", "link2_visual_2", "link3_visual_3"};
+  sdf::ElementPtr visual = link->GetElement("visual");
+  for (int i = 0; i < 4; ++i)
+  {
+    ASSERT_NE(nullptr, visual);
+    EXPECT_EQ(visualNames[i], visual->Get<std::string>("name"));
+    EXPECT_EQ(gz::math::Pose3d(i, 0, 0, 0, 0, 0),
+              visual->Get<gz::math::Pose3d>("pose"));
+    visual = visual->GetNextElement("visual");
+  }
+  EXPECT_EQ(nullptr, visual);
+
+  sdf::ElementPtr collision = link->GetElement("collision");
+  for (int i = 0; i < 4; ++i)
+  {
+    ASSERT_NE(nullptr, collision);
+    EXPECT_EQ(gz::math::Pose3d(i, 0, 0, 0, 0, 0),
+              collision->Get<gz::math::Pose3d>("pose"));
+    collision = collision->GetNextElement("collision");
+  }
+  EXPECT_EQ(nullptr, collision);
+
+  // The joint after the chain is moved to its first link
+  sdf::ElementPtr joint = model->GetElement("joint");
+  ASSERT_NE(nullptr, joint);
+  EXPECT_EQ("joint3_4", joint->Get<std::string>("name"));
+  EXPECT_EQ("link0", joint->Get<std::string>("parent"));
+  EXPECT_EQ(gz::math::Pose3d(4, 0, 0, 0, 0, 0),
+            joint->Get<gz::math::Pose3d>("pose"));
+  EXPECT_EQ(nullptr, joint->GetNextElement("joint"));
+
+  // Each reduced joint and link is kept as a frame
+  int frameCount = 0;
+  for (sdf::ElementPtr frame = model->GetElement("frame"); frame;
+       frame = frame->GetNextElement("frame"))
+  {
+    ++frameCount;
+  }
+  EXPECT_EQ(6, frameCount);
+}
+
 /////////////////////////////////////////////////
 TEST(URDFParser, OutputPrecision)
 {
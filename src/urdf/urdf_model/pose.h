@@ -75,7 +75,7 @@ public:
     for (unsigned int i = 0; i < pieces.size(); ++i){
       if (pieces[i] != ""){
         try {
-          xyz.push_back(std::stod(pieces[i]));
+          xyz.push_back(urdf::strToDouble(pieces[i]));
         }
         catch (std::invalid_argument &/*e*/) {
           throw ParseError("Unable to parse component [" + pieces[i] + "] to a double (while parsing a vector value)");
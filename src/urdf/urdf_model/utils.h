@@ -37,6 +37,10 @@
 #ifndef URDF_INTERFACE_UTILS_H
 #define URDF_INTERFACE_UTILS_H
 
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -62,6 +66,43 @@ void split_string(std::vector<std::string> &result,
   }
 }
 
+// Replacement for std::stod and std::stof that does not depend on the
+// current locale: the number is always read with a '.' decimal separator.
+// Like std::stod, characters after the number are ignored, and
+// std::invalid_argument or std::out_of_range is thrown if no number can be
+// read.
+template <typename T>
+inline
+T strToReal(const std::string &input)
+{
+  std::istringstream stream(input);
+  stream.imbue(std::locale::classic());
+  T value = 0;
+  stream >> value;
+  if (stream.fail())
+  {
+    if (value == std::numeric_limits<T>::max() ||
+        value == -std::numeric_limits<T>::max())
+    {
+      throw std::out_of_range("strToReal: " + input);
+    }
+    throw std::invalid_argument("strToReal: " + input);
+  }
+  return value;
+}
+
+inline
+double strToDouble(const std::string &input)
+{
+  return strToReal<double>(input);
+}
+
+inline
+float strToFloat(const std::string &input)
+{
+  return strToReal<float>(input);
+}
+
 }
 
 #endif
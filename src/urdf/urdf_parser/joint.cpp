@@ -60,7 +60,7 @@ bool parseJointDynamics(JointDynamics &jd, tinyxml2::XMLElement* config)
   {
     try
     {
-      jd.damping = std::stod(damping_str);
+      jd.damping = urdf::strToDouble(damping_str);
     }
     catch (std::invalid_argument &e)
     {
@@ -81,7 +81,7 @@ bool parseJointDynamics(JointDynamics &jd, tinyxml2::XMLElement* config)
   {
     try
     {
-      jd.friction = std::stod(friction_str);
+      jd.friction = urdf::strToDouble(friction_str);
     }
     catch (std::invalid_argument &e)
     {
@@ -115,7 +115,7 @@ bool parseJointLimits(JointLimits &jl, tinyxml2::XMLElement* config)
   {
     try
     {
-      jl.lower = std::stod(lower_str);
+      jl.lower = urdf::strToDouble(lower_str);
     }
     catch (std::invalid_argument &e)
     {
@@ -136,7 +136,7 @@ bool parseJointLimits(JointLimits &jl, tinyxml2::XMLElement* config)
   {
     try
     {
-      jl.upper = std::stod(upper_str);
+      jl.upper = urdf::strToDouble(upper_str);
     }
     catch (std::invalid_argument &e)
     {
@@ -157,7 +157,7 @@ bool parseJointLimits(JointLimits &jl, tinyxml2::XMLElement* config)
   {
     try
     {
-      jl.effort = std::stod(effort_str);
+      jl.effort = urdf::strToDouble(effort_str);
     }
     catch (std::invalid_argument &e)
     {
@@ -178,7 +178,7 @@ bool parseJointLimits(JointLimits &jl, tinyxml2::XMLElement* config)
   {
     try
     {
-      jl.velocity = std::stod(velocity_str);
+      jl.velocity = urdf::strToDouble(velocity_str);
     }
     catch (std::invalid_argument &e)
     {
@@ -207,7 +207,7 @@ bool parseJointSafety(JointSafety &js, tinyxml2::XMLElement* config)
   {
     try
     {
-      js.soft_lower_limit = std::stod(soft_lower_limit_str);
+      js.soft_lower_limit = urdf::strToDouble(soft_lower_limit_str);
     }
     catch (std::invalid_argument &e)
     {
@@ -229,7 +229,7 @@ bool parseJointSafety(JointSafety &js, tinyxml2::XMLElement* config)
   {
     try
     {
-      js.soft_upper_limit = std::stod(soft_upper_limit_str);
+      js.soft_upper_limit = urdf::strToDouble(soft_upper_limit_str);
     }
     catch (std::invalid_argument &e)
     {
@@ -251,7 +251,7 @@ bool parseJointSafety(JointSafety &js, tinyxml2::XMLElement* config)
   {
     try
     {
-      js.k_position = std::stod(k_position_str);
+      js.k_position = urdf::strToDouble(k_position_str);
     }
     catch (std::invalid_argument &e)
     {
@@ -272,7 +272,7 @@ bool parseJointSafety(JointSafety &js, tinyxml2::XMLElement* config)
   {
     try
     {
-      js.k_velocity = std::stod(k_velocity_str);
+      js.k_velocity = urdf::strToDouble(k_velocity_str);
     }
     catch (std::invalid_argument &e)
     {
@@ -301,7 +301,7 @@ bool parseJointCalibration(JointCalibration &jc, tinyxml2::XMLElement* config)
   {
     try
     {
-      jc.rising.reset(new double(std::stod(rising_position_str)));
+      jc.rising.reset(new double(urdf::strToDouble(rising_position_str)));
     }
     catch (std::invalid_argument &e)
     {
@@ -323,7 +323,7 @@ bool parseJointCalibration(JointCalibration &jc, tinyxml2::XMLElement* config)
   {
     try
     {
-      jc.falling.reset(new double(std::stod(falling_position_str)));
+      jc.falling.reset(new double(urdf::strToDouble(falling_position_str)));
     }
     catch (std::invalid_argument &e)
     {
@@ -363,7 +363,7 @@ bool parseJointMimic(JointMimic &jm, tinyxml2::XMLElement* config)
   {
     try
     {
-      jm.multiplier = std::stod(multiplier_str);
+      jm.multiplier = urdf::strToDouble(multiplier_str);
     }
     catch (std::invalid_argument &e)
     {
@@ -386,7 +386,7 @@ bool parseJointMimic(JointMimic &jm, tinyxml2::XMLElement* config)
   {
     try
     {
-      jm.offset = std::stod(offset_str);
+      jm.offset = urdf::strToDouble(offset_str);
     }
     catch (std::invalid_argument &e)
     {
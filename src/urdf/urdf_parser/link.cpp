@@ -112,7 +112,7 @@ bool parseSphere(Sphere &s, tinyxml2::XMLElement *c)
 
   try
   {
-    s.radius = std::stod(c->Attribute("radius"));
+    s.radius = urdf::strToDouble(c->Attribute("radius"));
   }
   catch (std::invalid_argument &e)
   {
@@ -164,7 +164,7 @@ bool parseCylinder(Cylinder &y, tinyxml2::XMLElement *c)
 
   try
   {
-    y.length = std::stod(c->Attribute("length"));
+    y.length = urdf::strToDouble(c->Attribute("length"));
   }
   catch (std::invalid_argument &/*e*/)
   {
@@ -181,7 +181,7 @@ bool parseCylinder(Cylinder &y, tinyxml2::XMLElement *c)
 
   try
   {
-    y.radius = std::stod(c->Attribute("radius"));
+    y.radius = urdf::strToDouble(c->Attribute("radius"));
   }
   catch (std::invalid_argument &/*e*/)
   {
@@ -298,7 +298,7 @@ bool parseInertial(Inertial &i, tinyxml2::XMLElement *config)
 
   try
   {
-    i.mass = std::stod(mass_xml->Attribute("value"));
+    i.mass = urdf::strToDouble(mass_xml->Attribute("value"));
   }
   catch (std::invalid_argument &/*e*/)
   {
@@ -328,12 +328,12 @@ bool parseInertial(Inertial &i, tinyxml2::XMLElement *config)
   }
   try
   {
-    i.ixx  = std::stod(inertia_xml->Attribute("ixx"));
-    i.ixy  = std::stod(inertia_xml->Attribute("ixy"));
-    i.ixz  = std::stod(inertia_xml->Attribute("ixz"));
-    i.iyy  = std::stod(inertia_xml->Attribute("iyy"));
-    i.iyz  = std::stod(inertia_xml->Attribute("iyz"));
-    i.izz  = std::stod(inertia_xml->Attribute("izz"));
+    i.ixx  = urdf::strToDouble(inertia_xml->Attribute("ixx"));
+    i.ixy  = urdf::strToDouble(inertia_xml->Attribute("ixy"));
+    i.ixz  = urdf::strToDouble(inertia_xml->Attribute("ixz"));
+    i.iyy  = urdf::strToDouble(inertia_xml->Attribute("iyy"));
+    i.iyz  = urdf::strToDouble(inertia_xml->Attribute("iyz"));
+    i.izz  = urdf::strToDouble(inertia_xml->Attribute("izz"));
   }
   catch (std::invalid_argument &/*e*/)
   {
@@ -37,6 +37,7 @@
 
 #include <urdf_model/pose.h>
 #include <fstream>
+#include <locale>
 #include <sstream>
 #include <algorithm>
 // #include <console_bridge/console.h>
@@ -48,6 +49,7 @@ namespace urdf_export_helpers {
 std::string values2str(unsigned int count, const double *values, double (*conv)(double))
 {
     std::stringstream ss;
+    ss.imbue(std::locale::classic());
     for (unsigned int i = 0 ; i < count ; i++)
     {
         if (i > 0)
@@ -62,7 +62,7 @@ bool parseModelState(ModelState &ms, tinyxml2::XMLElement* config)
   if (time_stamp_char)
   {
     try {
-      double sec = std::stod(time_stamp_char);
+      double sec = urdf::strToDouble(time_stamp_char);
       ms.time_stamp.set(sec);
     }
     catch (std::invalid_argument &e) {
@@ -97,7 +97,7 @@ bool parseModelState(ModelState &ms, tinyxml2::XMLElement* config)
       for (unsigned int i = 0; i < pieces.size(); ++i){
         if (pieces[i] != ""){
           try {
-            joint_state->position.push_back(std::stod(pieces[i].c_str()));
+            joint_state->position.push_back(urdf::strToDouble(pieces[i].c_str()));
           }
           catch (std::invalid_argument &/*e*/) {
             throw ParseError("position element ("+ pieces[i] +") is not a valid float");
@@ -119,7 +119,7 @@ bool parseModelState(ModelState &ms, tinyxml2::XMLElement* config)
       for (unsigned int i = 0; i < pieces.size(); ++i){
         if (pieces[i] != ""){
           try {
-            joint_state->velocity.push_back(std::stod(pieces[i].c_str()));
+            joint_state->velocity.push_back(urdf::strToDouble(pieces[i].c_str()));
           }
           catch (std::invalid_argument &/*e*/) {
             throw ParseError("velocity element ("+ pieces[i] +") is not a valid float");
@@ -141,7 +141,7 @@ bool parseModelState(ModelState &ms, tinyxml2::XMLElement* config)
       for (unsigned int i = 0; i < pieces.size(); ++i){
         if (pieces[i] != ""){
           try {
-            joint_state->effort.push_back(std::stod(pieces[i].c_str()));
+            joint_state->effort.push_back(urdf::strToDouble(pieces[i].c_str()));
           }
           catch (std::invalid_argument &/*e*/) {
             throw ParseError("effort element ("+ pieces[i] +") is not a valid float");
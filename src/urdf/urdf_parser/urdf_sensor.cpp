@@ -36,6 +36,7 @@
 #pragma warning(push, 0)
 
 #include <urdf_sensor/sensor.h>
+#include <urdf_model/utils.h>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
@@ -111,7 +112,7 @@ bool parseCamera(Camera &camera, tinyxml2::XMLElement* config)
     {
       try
       {
-        camera.hfov = std::stod(hfov_char);
+        camera.hfov = urdf::strToDouble(hfov_char);
       }
       catch (std::invalid_argument &e)
       {
@@ -132,7 +133,7 @@ bool parseCamera(Camera &camera, tinyxml2::XMLElement* config)
     {
       try
       {
-        camera.near = std::stod(near_char);
+        camera.near = urdf::strToDouble(near_char);
       }
       catch (std::invalid_argument &e)
       {
@@ -153,7 +154,7 @@ bool parseCamera(Camera &camera, tinyxml2::XMLElement* config)
     {
       try
       {
-        camera.far = std::stod(far_char);
+        camera.far = urdf::strToDouble(far_char);
       }
       catch (std::invalid_argument &e)
       {
@@ -207,7 +208,7 @@ bool parseRay(Ray &ray, tinyxml2::XMLElement* config)
     {
       try
       {
-        ray.horizontal_resolution = std::stod(resolution_char);
+        ray.horizontal_resolution = urdf::strToDouble(resolution_char);
       }
       catch (std::invalid_argument &e)
       {
@@ -224,7 +225,7 @@ bool parseRay(Ray &ray, tinyxml2::XMLElement* config)
     {
       try
       {
-        ray.horizontal_min_angle = std::stod(min_angle_char);
+        ray.horizontal_min_angle = urdf::strToDouble(min_angle_char);
       }
       catch (std::invalid_argument &e)
       {
@@ -241,7 +242,7 @@ bool parseRay(Ray &ray, tinyxml2::XMLElement* config)
     {
       try
       {
-        ray.horizontal_max_angle = std::stod(max_angle_char);
+        ray.horizontal_max_angle = urdf::strToDouble(max_angle_char);
       }
       catch (std::invalid_argument &e)
       {
@@ -279,7 +280,7 @@ bool parseRay(Ray &ray, tinyxml2::XMLElement* config)
     {
       try
       {
-        ray.vertical_resolution = std::stod(resolution_char);
+        ray.vertical_resolution = urdf::strToDouble(resolution_char);
       }
       catch (std::invalid_argument &e)
       {
@@ -296,7 +297,7 @@ bool parseRay(Ray &ray, tinyxml2::XMLElement* config)
     {
       try
       {
-        ray.vertical_min_angle = std::stod(min_angle_char);
+        ray.vertical_min_angle = urdf::strToDouble(min_angle_char);
       }
       catch (std::invalid_argument &e)
       {
@@ -313,7 +314,7 @@ bool parseRay(Ray &ray, tinyxml2::XMLElement* config)
     {
       try
       {
-        ray.vertical_max_angle = std::stod(max_angle_char);
+        ray.vertical_max_angle = urdf::strToDouble(max_angle_char);
       }
       catch (std::invalid_argument &e)
       {
@@ -0,0 +1,173 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+#include "test_config.hh"
+#include "test_utils.hh"
+
+/////////////////////////////////////////////////
+/// \brief Check that two element trees have the same metadata.
+/// \param[in] _expected Element read from XML.
+/// \param[in] _actual Element read from a binary document.
+static void expectSameMetadata(const sdf::ElementPtr &_expected,
+                               const sdf::ElementPtr &_actual)
+{
+  ASSERT_NE(nullptr, _actual) << _expected->XmlPath();
+  EXPECT_EQ(_expected->GetName(), _actual->GetName());
+  EXPECT_EQ(_expected->LineNumber(), _actual->LineNumber());
+  EXPECT_EQ(_expected->XmlPath(), _actual->XmlPath());
+  EXPECT_EQ(_expected->FilePath(), _actual->FilePath());
+  EXPECT_EQ(_expected->OriginalVersion(), _actual->OriginalVersion());
+  EXPECT_EQ(_expected->ReferenceSDF(), _actual->ReferenceSDF());
+  EXPECT_EQ(_expected->GetExplicitlySetInFile(),
+            _actual->GetExplicitlySetInFile());
+  EXPECT_EQ(_expected->GetElementDescriptionCount(),
+            _actual->GetElementDescriptionCount());
+
+  ASSERT_EQ(nullptr == _expected->GetIncludeElement(),
+            nullptr == _actual->GetIncludeElement());
+  if (_expected->GetIncludeElement())
+  {
+    EXPECT_EQ(_expected->GetIncludeElement()->ToString(""),
+              _actual->GetIncludeElement()->ToString(""));
+  }
+
+  sdf::ElementPtr actualChild = _actual->GetFirstElement();
+  for (sdf::ElementPtr child = _expected->GetFirstElement(); child;
+       child = child->GetNextElement())
+  {
+    expectSameMetadata(child, actualChild);
+    if (!actualChild)
+      return;
+    actualChild = actualChild->GetNextElement();
+  }
+  EXPECT_EQ(nullptr, actualChild);
+}
+
+/////////////////////////////////////////////////
+/// \brief Save every test file that can be read to a binary document, and
+/// check that loading it gives the same document.
+TEST(BinaryDocument, TestFiles)
+{
+  sdf::ParserConfig config;
+  config.SetFindCallback([](const std::string &_input)
+      {
+        return sdf::testing::TestFile("integration", "model", _input);
+      });
+
+  std::string tmpDir;
+  ASSERT_TRUE(sdf::testing::TestTmpPath(tmpDir));
+  const std::string binaryFile =
+      (std::filesystem::path(tmpDir) / "binary_document.sdfb").string();
+
+  int fileCount = 0;
+  for (const auto &entry : std::filesystem::directory_iterator(
+           sdf::testing::TestFile("sdf")))
+  {
+    if (entry.path().extension() != ".sdf")
+      continue;
+
+    const std::string file = entry.path().string();
+    sdf::SDFPtr sdf(new sdf::SDF());
+    sdf::init(sdf, config);
+    sdf::Errors errors;
+    if (!sdf::readFile(file, config, sdf, errors))
+      continue;
+    ++fileCount;
+
+    sdf::Errors binaryErrors;
+    sdf->SaveBinary(binaryErrors, binaryFile);
+    ASSERT_TRUE(binaryErrors.empty()) << file << binaryErrors;
+
+    sdf::SDF loaded;
+    loaded.LoadBinary(binaryErrors, binaryFile, config);
+    ASSERT_TRUE(binaryErrors.empty()) << file << binaryErrors;
+
+    EXPECT_EQ(sdf->ToString(), loaded.ToString()) << file;
+    EXPECT_EQ(sdf->FilePath(), loaded.FilePath()) << file;
+    EXPECT_EQ(sdf->OriginalVersion(), loaded.OriginalVersion()) << file;
+    expectSameMetadata(sdf->Root(), loaded.Root());
+  }
+  EXPECT_GT(fileCount, 100);
+
+  std::remove(binaryFile.c_str());
+}
+
+/////////////////////////////////////////////////
+/// \brief A document with included models gives the same DOM when it is
+/// loaded from a binary document, without reading the included files.
+TEST(BinaryDocument, Includes)
+{
+  sdf::ParserConfig config;
+  config.SetFindCallback([](const std::string &_input)
+      {
+        return sdf::testing::TestFile("integration", "model", _input);
+      });
+
+  const std::string file = sdf::testing::TestFile("sdf", "includes.sdf");
+  sdf::Root expectedRoot;
+  sdf::Errors errors = expectedRoot.Load(file, config);
+  ASSERT_TRUE(errors.empty()) << errors;
+
+  sdf::SDFPtr sdf(new sdf::SDF());
+  sdf::init(sdf, config);
+  ASSERT_TRUE(sdf::readFile(file, config, sdf, errors)) << errors;
+
+  std::string tmpDir;
+  ASSERT_TRUE(sdf::testing::TestTmpPath(tmpDir));
+  const std::string binaryFile =
+      (std::filesystem::path(tmpDir) / "includes.sdfb").string();
+  sdf->SaveBinary(errors, binaryFile);
+  ASSERT_TRUE(errors.empty()) << errors;
+
+  // Included files can not be found, so they must not be read.
+  sdf::ParserConfig noFindConfig;
+  auto loaded = std::make_shared<sdf::SDF>();
+  loaded->LoadBinary(errors, binaryFile, noFindConfig);
+  ASSERT_TRUE(errors.empty()) << errors;
+
+  sdf::Root root;
+  errors = root.Load(loaded, noFindConfig);
+  EXPECT_TRUE(errors.empty()) << errors;
+  EXPECT_EQ(expectedRoot.Element()->ToString(""), root.Element()->ToString(""));
+
+  const sdf::World *world = root.WorldByIndex(0);
+  ASSERT_NE(nullptr, world);
+  EXPECT_EQ(expectedRoot.WorldByIndex(0)->ModelCount(), world->ModelCount());
+  EXPECT_EQ(expectedRoot.WorldByIndex(0)->ActorCount(), world->ActorCount());
+  EXPECT_EQ(expectedRoot.WorldByIndex(0)->LightCount(), world->LightCount());
+
+  const sdf::Model *model = world->ModelByIndex(0);
+  ASSERT_NE(nullptr, model);
+  EXPECT_EQ(expectedRoot.WorldByIndex(0)->ModelByIndex(0)->Name(),
+            model->Name());
+  EXPECT_EQ(expectedRoot.WorldByIndex(0)->ModelByIndex(0)->Uri(),
+            model->Uri());
+  ASSERT_NE(nullptr, model->Element()->GetIncludeElement());
+  EXPECT_EQ(sdf::testing::TestFile("integration", "model", "test_model",
+                                   "model.sdf"),
+            model->Element()->FilePath());
+
+  std::remove(binaryFile.c_str());
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/ConversionCache.hh"
+#include "sdf/sdf.hh"
+#include "test_config.hh"
+
+/////////////////////////////////////////////////
+/// \brief Check that two element trees have the same line numbers and XML
+/// paths.
+/// \param[in] _expected Element read from XML.
+/// \param[in] _actual Element loaded from the cache.
+static void expectSameLines(const sdf::ElementPtr &_expected,
+                            const sdf::ElementPtr &_actual)
+{
+  ASSERT_NE(nullptr, _actual) << _expected->XmlPath();
+  EXPECT_EQ(_expected->LineNumber(), _actual->LineNumber());
+  EXPECT_EQ(_expected->XmlPath(), _actual->XmlPath());
+  EXPECT_EQ(_expected->FilePath(), _actual->FilePath());
+
+  sdf::ElementPtr actualChild = _actual->GetFirstElement();
+  for (sdf::ElementPtr child = _expected->GetFirstElement(); child;
+       child = child->GetNextElement())
+  {
+    expectSameLines(child, actualChild);
+    if (!actualChild)
+      return;
+    actualChild = actualChild->GetNextElement();
+  }
+  EXPECT_EQ(nullptr, actualChild);
+}
+
+/////////////////////////////////////////////////
+/// \brief Create a cache in an empty directory.
+/// \param[in] _name Name of the directory.
+/// \return The cache.
+static std::shared_ptr<sdf::ConversionCache> emptyCache(
+    const std::string &_name)
+{
+  std::string tmpDir;
+  EXPECT_TRUE(sdf::testing::TestTmpPath(tmpDir));
+  const std::filesystem::path directory =
+      std::filesystem::path(tmpDir) / _name;
+  std::filesystem::remove_all(directory);
+  return std::make_shared<sdf::ConversionCache>(directory.string());
+}
+
+/////////////////////////////////////////////////
+/// \brief A converted file gives the same DOM when it is loaded from the
+/// cache.
+TEST(ConversionCache, ConvertedFile)
+{
+  const std::string file =
+      sdf::testing::TestFile("sdf", "double_pendulum.sdf");
+
+  sdf::ParserConfig uncachedConfig;
+  sdf::Root expectedRoot;
+  sdf::Errors errors = expectedRoot.Load(file, uncachedConfig);
+  ASSERT_TRUE(errors.empty()) << errors;
+
+  auto cache = emptyCache("conversion_cache_converted");
+  sdf::ParserConfig config;
+  config.SetConversionCache(cache);
+  for (int i = 0; i < 2; ++i)
+  {
+    sdf::Root root;
+    errors = root.Load(file, config);
+    ASSERT_TRUE(errors.empty()) << errors;
+    EXPECT_EQ(expectedRoot.Element()->ToString(""),
+              root.Element()->ToString(""));
+    EXPECT_EQ("1.6", root.Element()->OriginalVersion());
+    expectSameLines(expectedRoot.Element(), root.Element());
+
+    ASSERT_NE(nullptr, root.Model());
+    EXPECT_EQ(expectedRoot.Model()->Name(), root.Model()->Name());
+    EXPECT_EQ(expectedRoot.Model()->LinkCount(), root.Model()->LinkCount());
+    EXPECT_EQ(expectedRoot.Model()->JointCount(),
+              root.Model()->JointCount());
+  }
+  EXPECT_EQ(1u, cache->Hits());
+  EXPECT_EQ(1u, cache->Misses());
+}
+
+/////////////////////////////////////////////////
+/// \brief Files with included models are read every time, and the included
+/// files that are converted are loaded from the cache.
+TEST(ConversionCache, Includes)
+{
+  sdf::ParserConfig uncachedConfig;
+  uncachedConfig.SetFindCallback([](const std::string &_input)
+      {
+        return sdf::testing::TestFile("integration", "model", _input);
+      });
+  const std::string file = sdf::testing::TestFile("sdf", "includes_1.5.sdf");
+  sdf::Root expectedRoot;
+  const sdf::Errors expectedErrors = expectedRoot.Load(file, uncachedConfig);
+
+  auto cache = emptyCache("conversion_cache_includes");
+  sdf::ParserConfig config = uncachedConfig;
+  config.SetConversionCache(cache);
+
+  sdf::Root firstRoot;
+  EXPECT_EQ(expectedErrors.size(), firstRoot.Load(file, config).size());
+  EXPECT_EQ(0u, cache->Hits());
+  const uint64_t firstMisses = cache->Misses();
+
+  std::size_t entryCount = 0;
+  for (const auto &entry :
+       std::filesystem::directory_iterator(cache->Directory()))
+  {
+    if (entry.path().extension() == ".sdfb")
+      ++entryCount;
+  }
+  // The top level file is not cached
+  EXPECT_LT(entryCount, firstMisses);
+
+  sdf::Root root;
+  EXPECT_EQ(expectedErrors.size(), root.Load(file, config).size());
+  EXPECT_EQ(entryCount, cache->Hits());
+  EXPECT_EQ(2 * firstMisses - entryCount, cache->Misses());
+  EXPECT_EQ(expectedRoot.Element()->ToString(""),
+            root.Element()->ToString(""));
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+#include "test_config.hh"
+
+/////////////////////////////////////////////////
+std::string findFileCb(const std::string &_input)
+{
+  return sdf::testing::TestFile("integration", "model", _input);
+}
+
+/////////////////////////////////////////////////
+/// \brief Load a file and return its string representation.
+/// \param[in] _file File to load.
+/// \param[in] _useArena True to load the file into a document arena.
+static std::string loadToString(const std::string &_file, bool _useArena)
+{
+  sdf::ParserConfig config;
+  config.SetFindCallback(findFileCb);
+  config.SetUseDocumentArena(_useArena);
+
+  sdf::Root root;
+  sdf::Errors errors = root.Load(_file, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+  EXPECT_NE(nullptr, root.Element());
+  return root.Element() ? root.Element()->ToString("") : "";
+}
+
+/////////////////////////////////////////////////
+TEST(DocumentArena, SameResultAsHeap)
+{
+  const std::string file = sdf::testing::TestFile("sdf", "includes.sdf");
+  const std::string heap = loadToString(file, false);
+  const std::string arena = loadToString(file, true);
+  EXPECT_FALSE(arena.empty());
+  EXPECT_EQ(heap, arena);
+}
+
+/////////////////////////////////////////////////
+TEST(DocumentArena, ElementsOutliveDocument)
+{
+  const std::string sdfString =
+    std::string("<sdf version='") + SDF_VERSION + "'>"
+    "  <model name='m'>"
+    "    <link name='l'><pose>1 2 3 0 0 0</pose></link>"
+    "  </model>"
+    "</sdf>";
+
+  sdf::ParserConfig config;
+  config.SetUseDocumentArena(true);
+
+  sdf::ElementPtr link;
+  {
+    sdf::SDFPtr sdf(new sdf::SDF());
+    ASSERT_TRUE(sdf::init(sdf, config));
+    sdf::Errors errors;
+    ASSERT_TRUE(sdf::readString(sdfString, config, sdf, errors)) << errors;
+    link = sdf->Root()->GetElement("model")->GetElement("link");
+  }
+
+  // The document is gone, but the arena is kept alive by the element.
+  ASSERT_NE(nullptr, link);
+  EXPECT_EQ("l", link->Get<std::string>("name"));
+  EXPECT_EQ(gz::math::Pose3d(1, 2, 3, 0, 0, 0),
+            link->Get<gz::math::Pose3d>("pose"));
+
+  // Elements created outside of parsing are not placed in an arena, and may
+  // be mixed freely with arena elements.
+  sdf::ElementPtr clone = link->Clone();
+  link.reset();
+  EXPECT_EQ("l", clone->Get<std::string>("name"));
+  clone->GetElement("pose")->Set(gz::math::Pose3d(4, 5, 6, 0, 0, 0));
+  EXPECT_EQ(gz::math::Pose3d(4, 5, 6, 0, 0, 0),
+            clone->Get<gz::math::Pose3d>("pose"));
+}
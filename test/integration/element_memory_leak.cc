@@ -15,8 +15,12 @@
  *
  */
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -100,3 +104,150 @@ TEST(ElementMemoryLeak, SDFCreateDestroy)
             << getMemoryUsage()
             << std::endl;
 }
+
+//////////////////////////////////////////////////
+TEST(ElementMemoryLeak, SharedElementDescriptions)
+{
+  // Build the schema once so that it is not counted below.
+  {
+    sdf::SDFPtr warmup(new sdf::SDF());
+    ASSERT_TRUE(sdf::init(warmup));
+  }
+
+  // Element descriptions are shared between instances, so holding many
+  // initialized SDF objects should cost a small fraction of the memory of
+  // one full copy of the schema each.
+  const unsigned int count = 200;
+  const int initialMemory = getMemoryUsage();
+  std::vector<sdf::SDFPtr> sdfs;
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    sdf::SDFPtr sdf(new sdf::SDF());
+    ASSERT_TRUE(sdf::init(sdf));
+    sdfs.push_back(sdf);
+  }
+  const int finalMemory = getMemoryUsage();
+
+  std::cout << "memory per initialized SDF: "
+            << (finalMemory - initialMemory) / static_cast<int>(count)
+            << " bytes" << std::endl;
+
+  // A deep copy of the schema takes several megabytes, while a shared one
+  // only needs the root element.
+  EXPECT_LT(finalMemory - initialMemory, static_cast<int>(count) * 50000);
+
+  // Elements loaded from a document reference the same description nodes.
+  sdf::SDFPtr modelSDF(new sdf::SDF());
+  modelSDF->SetFromString(
+    "<sdf version='1.5'>"
+    "  <model name='m'>"
+    "    <link name='l1'/>"
+    "    <link name='l2'/>"
+    "  </model>"
+    "</sdf>");
+  sdf::ElementPtr model = modelSDF->Root()->GetElement("model");
+  ASSERT_NE(nullptr, model);
+  sdf::ElementPtr link1 = model->GetElement("link");
+  ASSERT_NE(nullptr, link1);
+  sdf::ElementPtr link2 = link1->GetNextElement("link");
+  ASSERT_NE(nullptr, link2);
+  ASSERT_NE(nullptr, link1->GetElementDescription("visual"));
+  EXPECT_EQ(link1->GetElementDescription("visual"),
+            link2->GetElementDescription("visual"));
+}
+
+//////////////////////////////////////////////////
+/// \brief Count an element and all its descendants.
+std::size_t countElements(const sdf::ElementPtr &_elem)
+{
+  std::size_t count = 1;
+  for (const auto &child : _elem->Children())
+  {
+    count += countElements(child);
+  }
+  return count;
+}
+
+//////////////////////////////////////////////////
+/// \brief Load documents, hold them, and report the resident memory used
+/// per element. A document is loaded and released first, so that the
+/// schema and other one-time allocations are not counted.
+/// \param[in] _name Name of the documents in the report.
+/// \param[in] _load Function that loads one document.
+/// \param[in] _count Number of documents to load and hold.
+/// \return Bytes of resident memory per element.
+int bytesPerElement(const std::string &_name,
+                    const std::function<sdf::SDFPtr()> &_load, int _count)
+{
+  {
+    sdf::SDFPtr warmup = _load();
+    EXPECT_NE(nullptr, warmup);
+  }
+
+  const int initialMemory = getMemoryUsage();
+  std::vector<sdf::SDFPtr> sdfs;
+  for (int i = 0; i < _count; ++i)
+  {
+    sdfs.push_back(_load());
+  }
+  const int finalMemory = getMemoryUsage();
+
+  std::size_t elementCount = 0;
+  for (const sdf::SDFPtr &sdf : sdfs)
+  {
+    elementCount += countElements(sdf->Root());
+  }
+  EXPECT_GT(elementCount, 1000u);
+  const int bytes = (finalMemory - initialMemory) /
+      static_cast<int>(std::max<std::size_t>(elementCount, 1));
+  std::cout << _name << " elements: " << elementCount
+            << ", bytes per element: " << bytes << std::endl;
+  return bytes;
+}
+
+//////////////////////////////////////////////////
+TEST(ElementMemoryLeak, BytesPerElement)
+{
+  std::ostringstream stream;
+  stream << "<sdf version='" << SDF_VERSION << "'><world name='default'>";
+  for (int i = 0; i < 1000; ++i)
+  {
+    stream << "<model name='model" << i << "'>"
+           << "  <pose>" << i << " 0 0 0 0 0</pose>"
+           << "  <link name='link'>"
+           << "    <collision name='collision'>"
+           << "      <geometry><box><size>1 1 1</size></box></geometry>"
+           << "    </collision>"
+           << "    <visual name='visual'>"
+           << "      <geometry><box><size>1 1 1</size></box></geometry>"
+           << "    </visual>"
+           << "  </link>"
+           << "</model>";
+  }
+  stream << "</world></sdf>";
+  const std::string worldString = stream.str();
+
+  const int worldBytes = bytesPerElement("world", [&worldString]()
+  {
+    sdf::SDFPtr worldSDF(new sdf::SDF());
+    worldSDF->SetFromString(worldString);
+    return worldSDF;
+  }, 1);
+
+  // The atlas URDF is converted, so its elements come from generated SDF
+  // with many different element types.
+  const std::string atlasFile =
+      sdf::testing::TestFile("performance", "parser_urdf_atlas.urdf");
+  const int atlasBytes = bytesPerElement("atlas", [&atlasFile]()
+  {
+    sdf::SDFPtr atlasSDF(new sdf::SDF());
+    sdf::init(atlasSDF);
+    EXPECT_TRUE(sdf::readFile(atlasFile, atlasSDF));
+    return atlasSDF;
+  }, 20);
+
+  // An element holds its own attributes and value and shares its
+  // description with the schema, so it takes well under a few kilobytes.
+  EXPECT_LT(worldBytes, 4000);
+  EXPECT_LT(atlasBytes, 4000);
+}
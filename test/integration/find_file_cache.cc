@@ -0,0 +1,87 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+#include "test_config.hh"
+
+/////////////////////////////////////////////////
+std::string findFileCb(const std::string &_input)
+{
+  return sdf::testing::TestFile("integration", "model", _input);
+}
+
+/////////////////////////////////////////////////
+/// \brief Generate a world that includes two models many times.
+/// \param[in] _includeCount Number of includes.
+/// \return SDFormat string of the world.
+static std::string manyIncludeWorld(int _includeCount)
+{
+  std::ostringstream stream;
+  stream << "<sdf version='" << SDF_VERSION << "'>\n"
+         << "<world name='default'>\n";
+  for (int i = 0; i < _includeCount; ++i)
+  {
+    stream << "<include>"
+           << "<uri>" << (i % 2 == 0 ? "box" : "test_model") << "</uri>"
+           << "<name>model" << i << "</name>"
+           << "<pose>" << i << " 0 0 0 0 0</pose>"
+           << "</include>\n";
+  }
+  stream << "</world>\n</sdf>";
+  return stream.str();
+}
+
+/////////////////////////////////////////////////
+TEST(FindFileCache, ManyIncludes)
+{
+  const int includeCount = 1000;
+  const std::string world = manyIncludeWorld(includeCount);
+
+  sdf::ParserConfig config;
+  config.SetFindCallback(findFileCb);
+
+  sdf::Root uncached;
+  sdf::Errors errors = uncached.LoadSdfString(world, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  auto cache = std::make_shared<sdf::FindFileCache>();
+  config.SetFindFileCache(cache);
+
+  sdf::Root cached;
+  errors = cached.LoadSdfString(world, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+  ASSERT_NE(nullptr, cached.WorldByIndex(0));
+  EXPECT_EQ(static_cast<uint64_t>(includeCount),
+            cached.WorldByIndex(0)->ModelCount());
+
+  // Each of the two models is searched for once by its URI, and once by the
+  // path of its model file. Every other lookup is answered by the cache.
+  EXPECT_EQ(4u, cache->Misses());
+  EXPECT_EQ(4u, cache->Size());
+  EXPECT_EQ(static_cast<uint64_t>(2 * includeCount - 4), cache->Hits());
+  EXPECT_LT(cache->Probes() * 100, cache->ProbesSaved());
+
+  ASSERT_NE(nullptr, uncached.Element());
+  ASSERT_NE(nullptr, cached.Element());
+  EXPECT_EQ(uncached.Element()->ToString(""), cached.Element()->ToString(""));
+}
@@ -791,3 +791,53 @@ TEST(SDFParser, FixedJointReductionPluginFrameExtensionTest)
   bool correctedOffset = plugin->Get<bool>("gz::corrected_offsets");
   EXPECT_TRUE(correctedOffset);
 }
+
+/////////////////////////////////////////////////
+// This test uses a urdf with a plugin attached to a link that is reduced,
+// whose bodyName refers to that link and that has no offsets.
+// Test to make sure that the reduction transform of the link is applied on
+// top of the fixed joint pose, as when extensions were moved up one link at
+// a time.
+TEST(SDFParser, FixedJointReductionPluginWithoutOffsetsTest)
+{
+  const std::string urdf = R"(
+    <robot name='r'>
+      <link name='base_link'>
+        <inertial>
+          <mass value='1'/>
+          <inertia ixx='1' ixy='0' ixz='0' iyy='1' iyz='0' izz='1'/>
+        </inertial>
+      </link>
+      <link name='link1'>
+        <inertial>
+          <mass value='1'/>
+          <inertia ixx='1' ixy='0' ixz='0' iyy='1' iyz='0' izz='1'/>
+        </inertial>
+      </link>
+      <joint name='joint1' type='fixed'>
+        <parent link='base_link'/>
+        <child link='link1'/>
+        <origin xyz='1 0 0' rpy='0 0 0'/>
+      </joint>
+      <gazebo reference='link1'>
+        <plugin name='p' filename='p'>
+          <bodyName>link1</bodyName>
+        </plugin>
+      </gazebo>
+    </robot>)";
+
+  sdf::SDFPtr robot(new sdf::SDF());
+  sdf::init(robot);
+  ASSERT_TRUE(sdf::readString(urdf, robot));
+
+  sdf::ElementPtr link = robot->Root()->GetElement("model")
+    ->GetElement("link");
+  EXPECT_EQ("base_link", link->Get<std::string>("name"));
+  sdf::ElementPtr plugin = link->GetElement("plugin");
+
+  EXPECT_EQ("base_link", plugin->Get<std::string>("bodyName"));
+  EXPECT_EQ(gz::math::Vector3d(2, 0, 0),
+            plugin->Get<gz::math::Vector3d>("xyzOffset"));
+  EXPECT_EQ(gz::math::Vector3d::Zero,
+            plugin->Get<gz::math::Vector3d>("rpyOffset"));
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+#include "test_config.hh"
+
+/////////////////////////////////////////////////
+std::string findFileCb(const std::string &_input)
+{
+  return sdf::testing::TestFile("integration", "model", _input);
+}
+
+/////////////////////////////////////////////////
+/// \brief World that includes the same model several times.
+static const char kWorld[] =
+    "<sdf version='1.12'>"
+    "  <world name='default'>"
+    "    <include>"
+    "      <uri>box</uri>"
+    "      <name>box1</name>"
+    "      <pose>1 0 0 0 0 0</pose>"
+    "    </include>"
+    "    <include>"
+    "      <uri>box</uri>"
+    "      <name>box2</name>"
+    "      <pose>2 0 0 0 0 0</pose>"
+    "    </include>"
+    "    <include>"
+    "      <uri>box</uri>"
+    "      <name>box3</name>"
+    "      <static>true</static>"
+    "    </include>"
+    "  </world>"
+    "</sdf>";
+
+/////////////////////////////////////////////////
+TEST(IncludeCache, RepeatedIncludes)
+{
+  sdf::ParserConfig config;
+  config.SetFindCallback(findFileCb);
+
+  sdf::Root uncached;
+  sdf::Errors errors = uncached.LoadSdfString(kWorld, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  auto cache = std::make_shared<sdf::IncludeCache>();
+  config.SetIncludeCache(cache);
+
+  sdf::Root cached;
+  errors = cached.LoadSdfString(kWorld, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+  EXPECT_EQ(1u, cache->Misses());
+  EXPECT_EQ(2u, cache->Hits());
+  EXPECT_EQ(1u, cache->Size());
+
+  // Overrides of one include do not leak into the others
+  const sdf::World *world = cached.WorldByIndex(0);
+  ASSERT_NE(nullptr, world);
+  ASSERT_EQ(3u, world->ModelCount());
+  EXPECT_EQ("box1", world->ModelByIndex(0)->Name());
+  EXPECT_EQ(gz::math::Pose3d(1, 0, 0, 0, 0, 0),
+            world->ModelByIndex(0)->RawPose());
+  EXPECT_FALSE(world->ModelByIndex(0)->Static());
+  EXPECT_EQ("box2", world->ModelByIndex(1)->Name());
+  EXPECT_EQ(gz::math::Pose3d(2, 0, 0, 0, 0, 0),
+            world->ModelByIndex(1)->RawPose());
+  EXPECT_EQ("box3", world->ModelByIndex(2)->Name());
+  EXPECT_EQ(gz::math::Pose3d(0, 0, 0.5, 0, 0, 0),
+            world->ModelByIndex(2)->RawPose());
+  EXPECT_TRUE(world->ModelByIndex(2)->Static());
+
+  ASSERT_NE(nullptr, uncached.Element());
+  ASSERT_NE(nullptr, cached.Element());
+  EXPECT_EQ(uncached.Element()->ToString(""), cached.Element()->ToString(""));
+
+  // Later documents, and copies of the configuration, share the cache
+  sdf::ParserConfig copy(config);
+  sdf::Root again;
+  errors = again.LoadSdfString(kWorld, copy);
+  EXPECT_TRUE(errors.empty()) << errors;
+  EXPECT_EQ(1u, cache->Misses());
+  EXPECT_EQ(5u, cache->Hits());
+
+  // Cleared caches read the file again
+  cache->Clear();
+  EXPECT_EQ(0u, cache->Size());
+  sdf::Root reloaded;
+  errors = reloaded.LoadSdfString(kWorld, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+  EXPECT_EQ(2u, cache->Misses());
+  EXPECT_EQ(7u, cache->Hits());
+  EXPECT_EQ(uncached.Element()->ToString(""),
+            reloaded.Element()->ToString(""));
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+#include "test_config.hh"
+
+/////////////////////////////////////////////////
+std::string findFileCb(const std::string &_input)
+{
+  return sdf::testing::TestFile("integration", "model", _input);
+}
+
+/////////////////////////////////////////////////
+/// \brief World that includes models of different SDFormat versions.
+static const char kWorld[] =
+    "<sdf version='1.12'>"
+    "  <world name='default'>"
+    "    <include>"
+    "      <uri>box</uri>"
+    "      <name>box1</name>"
+    "    </include>"
+    "    <include>"
+    "      <uri>test_model</uri>"
+    "      <pose>1 0 0 0 0 0</pose>"
+    "    </include>"
+    "    <include>"
+    "      <uri>box</uri>"
+    "      <name>box2</name>"
+    "      <static>true</static>"
+    "    </include>"
+    "  </world>"
+    "</sdf>";
+
+/////////////////////////////////////////////////
+/// \brief Load worlds with includes from many threads at once, with and
+/// without a shared include cache, and check that every thread reads the
+/// same document as a single thread does.
+TEST(IncludeConcurrency, ParallelLoads)
+{
+  sdf::ParserConfig config;
+  config.SetFindCallback(findFileCb);
+
+  sdf::Root baseline;
+  sdf::Errors errors = baseline.LoadSdfString(kWorld, config);
+  ASSERT_TRUE(errors.empty()) << errors;
+  ASSERT_NE(nullptr, baseline.Element());
+  const std::string expected = baseline.Element()->ToString("");
+
+  sdf::ParserConfig cachedConfig(config);
+  auto cache = std::make_shared<sdf::IncludeCache>();
+  cachedConfig.SetIncludeCache(cache);
+
+  const int threadCount = 8;
+  const int iterationCount = 20;
+  std::vector<std::string> failures(threadCount);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < threadCount; ++t)
+  {
+    threads.emplace_back([&, t]()
+    {
+      // Half of the threads use their own configuration, the other half
+      // share one configuration and its include cache.
+      sdf::ParserConfig ownConfig;
+      ownConfig.SetFindCallback(findFileCb);
+      const sdf::ParserConfig &threadConfig =
+          (t % 2 == 0) ? ownConfig : cachedConfig;
+
+      for (int i = 0; i < iterationCount; ++i)
+      {
+        sdf::Root root;
+        sdf::Errors loadErrors = root.LoadSdfString(kWorld, threadConfig);
+        if (!loadErrors.empty())
+        {
+          failures[t] = loadErrors[0].Message();
+          return;
+        }
+        if (!root.Element() || root.Element()->ToString("") != expected)
+        {
+          failures[t] = "Document differs from the single thread document";
+          return;
+        }
+      }
+    });
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  for (int t = 0; t < threadCount; ++t)
+  {
+    EXPECT_TRUE(failures[t].empty()) << "Thread " << t << ": " << failures[t];
+  }
+
+  // Each of the two included files is read at least once, and every include
+  // is looked up in the cache.
+  EXPECT_EQ(2u, cache->Size());
+  EXPECT_GE(cache->Misses(), 2u);
+  EXPECT_EQ(static_cast<uint64_t>(threadCount / 2 * iterationCount * 3),
+            cache->Hits() + cache->Misses());
+}
+
+/////////////////////////////////////////////////
+/// \brief World with distinct, repeated, nested and missing includes.
+static const char kMixedWorld[] =
+    "<sdf version='1.12'>"
+    "  <world name='default'>"
+    "    <include>"
+    "      <uri>box</uri>"
+    "      <name>box1</name>"
+    "    </include>"
+    "    <include>"
+    "      <uri>test_model</uri>"
+    "    </include>"
+    "    <include>"
+    "      <uri>does_not_exist</uri>"
+    "    </include>"
+    "    <include>"
+    "      <uri>top_nested</uri>"
+    "    </include>"
+    "    <model name='parent'>"
+    "      <include>"
+    "        <uri>test_model_with_frames</uri>"
+    "      </include>"
+    "      <include>"
+    "        <uri>nested_multiple_models_error</uri>"
+    "      </include>"
+    "    </model>"
+    "    <include>"
+    "      <uri>box</uri>"
+    "      <name>box2</name>"
+    "      <pose>1 0 0 0 0 0</pose>"
+    "    </include>"
+    "  </world>"
+    "</sdf>";
+
+/////////////////////////////////////////////////
+/// \brief Load kMixedWorld.
+/// \param[in] _workerCount Number of threads that read included files.
+/// \param[out] _errors Errors reported when loading the world, with their
+/// locations.
+/// \return The loaded document.
+static std::string loadMixedWorld(unsigned int _workerCount,
+                                  std::string &_errors)
+{
+  sdf::ParserConfig config;
+  config.SetFindCallback(findFileCb);
+  config.SetIncludeWorkerCount(_workerCount);
+
+  sdf::Root root;
+  sdf::Errors errors = root.LoadSdfString(kMixedWorld, config);
+  std::ostringstream stream;
+  for (const auto &error : errors)
+  {
+    stream << error << " line " << error.LineNumber().value_or(-1)
+           << " path " << error.XmlPath().value_or("") << "\n";
+  }
+  _errors = stream.str();
+  return root.Element() ? root.Element()->ToString("") : "";
+}
+
+/////////////////////////////////////////////////
+/// \brief Included files read on worker threads give the same document and
+/// errors as files read one at a time.
+TEST(IncludeConcurrency, WorkerThreads)
+{
+  std::string serialErrors;
+  const std::string serial = loadMixedWorld(0, serialErrors);
+  EXPECT_FALSE(serial.empty());
+  EXPECT_FALSE(serialErrors.empty());
+
+  for (unsigned int workerCount : {2u, 4u, 16u})
+  {
+    std::string parallelErrors;
+    EXPECT_EQ(serial, loadMixedWorld(workerCount, parallelErrors))
+        << workerCount;
+    EXPECT_EQ(serialErrors, parallelErrors) << workerCount;
+  }
+}
@@ -15,8 +15,15 @@
  *
  */
 
+#include <atomic>
+#include <cctype>
+#include <clocale>
+#include <cmath>
 #include <iostream>
+#include <locale>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -27,33 +34,51 @@
 // Windows supports the setlocale call but we can not extract the
 // available locales using the Linux call
 #ifndef _MSC_VER
-TEST(CheckFixForLocal, MakeTestToFail)
+/////////////////////////////////////////////////
+/// \brief Find a latin locale, which uses a comma as decimal separator.
+/// \return Name of the locale, or an empty string if none is available.
+static std::string latinLocale()
 {
-  const std::string sdfTestFile =
-      sdf::testing::TestFile("integration", "numeric.sdf");
-
-  // Check if any of the latin locales is avilable
   FILE *fp = popen("locale -a | grep '^es\\|^pt_\\|^it_' | head -n 1", "r");
-
   if (!fp)
   {
-    FAIL() << "locale -a call failed";
-    return;
+    return "";
   }
 
   char buffer[1024];
   char *line = fgets(buffer, sizeof(buffer), fp);
   pclose(fp);
+  if (!line)
+  {
+    return "";
+  }
+
+  std::string name(line);
+  while (!name.empty() && std::isspace(name.back()))
+  {
+    name.pop_back();
+  }
+  return name;
+}
+
+/////////////////////////////////////////////////
+TEST(CheckFixForLocal, MakeTestToFail)
+{
+  const std::string sdfTestFile =
+      sdf::testing::TestFile("integration", "numeric.sdf");
+
+  // Check if any of the latin locales is avilable
+  const std::string line = latinLocale();
 
   // Do not run test if not available
-  if (!line)
+  if (line.empty())
   {
     std::cout << "No latin locale available. Skip test" << std::endl;
     SUCCEED();
     return;
   }
 
-  setlocale(LC_NUMERIC, line);
+  setlocale(LC_NUMERIC, line.c_str());
 
   // fix to allow make test without make install
   sdf::SDFPtr p(new sdf::SDF());
@@ -79,4 +104,188 @@ TEST(CheckFixForLocal, MakeTestToFail)
   ASSERT_TRUE(param.Get<double>(tmp));
   ASSERT_DOUBLE_EQ(1.5, tmp);
 }
+
+/////////////////////////////////////////////////
+/// \brief Numeric facet that uses a comma as decimal separator.
+struct CommaDecimalPointFacet : std::numpunct<char>
+{
+  char do_decimal_point() const
+  {
+    return ',';
+  }
+};
+
+/////////////////////////////////////////////////
+/// \brief Uses a comma as decimal separator in both the C and the C++
+/// locale for the lifetime of the object. A latin C locale may not be
+/// installed, in which case only the C++ locale is changed.
+class CommaDecimalLocale
+{
+  public: CommaDecimalLocale()
+    : originalNumericLocale(setlocale(LC_NUMERIC, nullptr)),
+      commaLocale(std::locale::classic(), new CommaDecimalPointFacet)
+  {
+    const std::string latin = latinLocale();
+    if (!latin.empty())
+    {
+      setlocale(LC_NUMERIC, latin.c_str());
+    }
+    this->numericLocale = setlocale(LC_NUMERIC, nullptr);
+    this->originalGlobalLocale = std::locale::global(this->commaLocale);
+  }
+
+  public: ~CommaDecimalLocale()
+  {
+    std::locale::global(this->originalGlobalLocale);
+    setlocale(LC_NUMERIC, this->originalNumericLocale.c_str());
+  }
+
+  /// \brief Check that the process locale was left alone.
+  public: void ExpectUnchanged() const
+  {
+    EXPECT_EQ(this->numericLocale, setlocale(LC_NUMERIC, nullptr));
+    EXPECT_EQ(this->commaLocale, std::locale());
+  }
+
+  private: const std::string originalNumericLocale;
+  private: std::string numericLocale;
+  private: const std::locale commaLocale;
+  private: std::locale originalGlobalLocale;
+};
+
+/////////////////////////////////////////////////
+TEST(CheckFixForLocal, ConcurrentParsing)
+{
+  CommaDecimalLocale locale;
+
+  const std::string sdfString =
+    std::string("<sdf version='") + SDF_VERSION + "'>"
+    "  <model name='m'>"
+    "    <link name='l'>"
+    "      <pose>1.5 2.5 3.5 0 0 0.25</pose>"
+    "      <inertial><mass>0.823</mass></inertial>"
+    "      <visual name='v'>"
+    "        <geometry><box><size>0.5 1.5 2.5</size></box></geometry>"
+    "      </visual>"
+    "    </link>"
+    "  </model>"
+    "</sdf>";
+
+  std::atomic<int> failures{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t)
+  {
+    threads.emplace_back([&]()
+    {
+      for (int i = 0; i < 20; ++i)
+      {
+        sdf::Root root;
+        sdf::Errors errors = root.LoadSdfString(sdfString);
+        const sdf::Model *model = root.Model();
+        const sdf::Link *link = model ? model->LinkByIndex(0) : nullptr;
+        const sdf::Visual *visual = link ? link->VisualByIndex(0) : nullptr;
+        if (!errors.empty() || !visual ||
+            link->RawPose() != gz::math::Pose3d(1.5, 2.5, 3.5, 0, 0, 0.25) ||
+            std::abs(link->Inertial().MassMatrix().Mass() - 0.823) > 1e-9 ||
+            visual->Geom()->BoxShape()->Size() !=
+              gz::math::Vector3d(0.5, 1.5, 2.5))
+        {
+          ++failures;
+        }
+
+        // Values are printed and parsed back without the comma
+        sdf::Param param("key", "double", "0.125", true);
+        double value = 0;
+        if (!param.Set(2.75) || !param.Get<double>(value) || value != 2.75 ||
+            param.GetAsString() != "2.75")
+        {
+          ++failures;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+  EXPECT_EQ(0, failures);
+
+  // Parsing must leave the process locale alone
+  locale.ExpectUnchanged();
+}
+
+/////////////////////////////////////////////////
+TEST(CheckFixForLocal, URDFParsing)
+{
+  CommaDecimalLocale locale;
+
+  const std::string urdfString = R"(
+    <robot name='r'>
+      <link name='base'>
+        <inertial>
+          <origin xyz='0.5 0 0' rpy='0 0 0'/>
+          <mass value='0.823'/>
+          <inertia ixx='0.01' ixy='0' ixz='0' iyy='0.01' iyz='0' izz='0.01'/>
+        </inertial>
+        <visual>
+          <geometry><box size='0.5 1.5 2.5'/></geometry>
+        </visual>
+        <collision>
+          <geometry><box size='0.5 1.5 2.5'/></geometry>
+        </collision>
+      </link>
+      <link name='child'>
+        <inertial>
+          <mass value='0.5'/>
+          <inertia ixx='0.01' ixy='0' ixz='0' iyy='0.01' iyz='0' izz='0.01'/>
+        </inertial>
+      </link>
+      <joint name='j' type='revolute'>
+        <parent link='base'/>
+        <child link='child'/>
+        <origin xyz='1.5 2.5 3.5' rpy='0 0 0.25'/>
+        <axis xyz='0 0 1'/>
+        <limit lower='-0.5' upper='0.5' effort='1.5' velocity='2.5'/>
+      </joint>
+      <gazebo reference='base'>
+        <mu1>0.5</mu1>
+      </gazebo>
+    </robot>)";
+
+  sdf::Root root;
+  sdf::Errors errors = root.LoadSdfString(urdfString);
+  ASSERT_TRUE(errors.empty()) << errors;
+
+  const sdf::Model *model = root.Model();
+  ASSERT_NE(nullptr, model);
+  const sdf::Link *base = model->LinkByName("base");
+  ASSERT_NE(nullptr, base);
+  EXPECT_DOUBLE_EQ(0.823, base->Inertial().MassMatrix().Mass());
+
+  const sdf::Visual *visual = base->VisualByIndex(0);
+  ASSERT_NE(nullptr, visual);
+  ASSERT_NE(nullptr, visual->Geom()->BoxShape());
+  EXPECT_EQ(gz::math::Vector3d(0.5, 1.5, 2.5),
+            visual->Geom()->BoxShape()->Size());
+
+  const sdf::Collision *collision = base->CollisionByIndex(0);
+  ASSERT_NE(nullptr, collision);
+  EXPECT_DOUBLE_EQ(0.5, collision->Surface()->Friction()->ODE()->Mu());
+
+  const sdf::Link *child = model->LinkByName("child");
+  ASSERT_NE(nullptr, child);
+  gz::math::Pose3d pose;
+  EXPECT_TRUE(child->SemanticPose().Resolve(pose).empty());
+  EXPECT_EQ(gz::math::Pose3d(1.5, 2.5, 3.5, 0, 0, 0.25), pose);
+
+  const sdf::Joint *joint = model->JointByName("j");
+  ASSERT_NE(nullptr, joint);
+  ASSERT_NE(nullptr, joint->Axis(0));
+  EXPECT_DOUBLE_EQ(-0.5, joint->Axis(0)->Lower());
+  EXPECT_DOUBLE_EQ(0.5, joint->Axis(0)->Upper());
+  EXPECT_DOUBLE_EQ(1.5, joint->Axis(0)->Effort());
+  EXPECT_DOUBLE_EQ(2.5, joint->Axis(0)->MaxVelocity());
+
+  locale.ExpectUnchanged();
+}
 #endif
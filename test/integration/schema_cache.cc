@@ -0,0 +1,125 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+
+/////////////////////////////////////////////////
+/// \brief Time a single call to sdf::init.
+/// \param[out] _sdf SDF object that is initialized.
+/// \return Elapsed time in microseconds.
+static double timeInit(sdf::SDFPtr _sdf)
+{
+  auto start = std::chrono::steady_clock::now();
+  sdf::Errors errors;
+  EXPECT_TRUE(sdf::init(errors, _sdf, sdf::ParserConfig::GlobalConfig()));
+  EXPECT_TRUE(errors.empty()) << errors;
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the schema description of an SDF object.
+static std::string description(sdf::SDFPtr _sdf)
+{
+  std::ostringstream stream;
+  std::streambuf *old = std::cout.rdbuf(stream.rdbuf());
+  _sdf->PrintDescription();
+  std::cout.rdbuf(old);
+  return stream.str();
+}
+
+/////////////////////////////////////////////////
+TEST(SchemaCache, InitIsFasterOnceCached)
+{
+  // The first call in this process builds the schema prototype.
+  sdf::SDFPtr first(new sdf::SDF());
+  const double coldTime = timeInit(first);
+
+  // The median is used so that a run that is preempted does not count.
+  const int runs = 21;
+  std::vector<double> warmTimes;
+  for (int i = 0; i < runs; ++i)
+  {
+    sdf::SDFPtr sdf(new sdf::SDF());
+    warmTimes.push_back(timeInit(sdf));
+  }
+  std::nth_element(warmTimes.begin(), warmTimes.begin() + runs / 2,
+                   warmTimes.end());
+  const double warmTime = warmTimes[runs / 2];
+
+  std::cout << "init() cold: " << coldTime << " us, "
+            << "cached: " << warmTime << " us, "
+            << "speedup: " << coldTime / warmTime << "x" << std::endl;
+
+  // Building the prototype creates the description of every schema
+  // element, while a cached init only clones the root element, which shares
+  // its child descriptions with the prototype. A speedup of 10 is well
+  // below the expected one, and leaves room for slow and sanitizer builds.
+  EXPECT_GT(coldTime / warmTime, 10.0);
+}
+
+/////////////////////////////////////////////////
+TEST(SchemaCache, InstancesAreIndependent)
+{
+  sdf::SDFPtr sdf1(new sdf::SDF());
+  sdf::SDFPtr sdf2(new sdf::SDF());
+  ASSERT_TRUE(sdf::init(sdf1));
+  ASSERT_TRUE(sdf::init(sdf2));
+
+  EXPECT_NE(sdf1->Root(), sdf2->Root());
+  EXPECT_EQ(description(sdf1), description(sdf2));
+
+  // Mutating one instance must not affect the other or later instances.
+  sdf1->Root()->GetAttribute("version")->SetFromString("1.0");
+  sdf1->Root()->AddElement("world")->GetAttribute("name")->SetFromString("w");
+  EXPECT_EQ("1.0", sdf1->Root()->GetAttribute("version")->GetAsString());
+  EXPECT_NE("1.0", sdf2->Root()->GetAttribute("version")->GetAsString());
+  EXPECT_FALSE(sdf2->Root()->HasElement("world"));
+
+  sdf::SDFPtr sdf3(new sdf::SDF());
+  ASSERT_TRUE(sdf::init(sdf3));
+  EXPECT_EQ(description(sdf2), description(sdf3));
+  EXPECT_FALSE(sdf3->Root()->HasElement("world"));
+}
+
+/////////////////////////////////////////////////
+TEST(SchemaCache, ReadStringAfterCachedInit)
+{
+  const std::string sdfString =
+    std::string("<sdf version='") + SDF_VERSION + "'>"
+    "  <model name='m'><link name='l'/></model>"
+    "</sdf>";
+
+  for (int i = 0; i < 3; ++i)
+  {
+    sdf::SDFPtr sdf(new sdf::SDF());
+    ASSERT_TRUE(sdf::init(sdf));
+    sdf::Errors errors;
+    ASSERT_TRUE(sdf::readString(sdfString, sdf, errors)) << errors;
+    ASSERT_TRUE(sdf->Root()->HasElement("model"));
+    EXPECT_EQ("m", sdf->Root()->GetElement("model")->Get<std::string>("name"));
+  }
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+#include "test_config.hh"
+
+/////////////////////////////////////////////////
+/// \brief Document and errors read from a file or a string.
+struct ReadResult
+{
+  /// \brief Return value of the read function.
+  bool success = false;
+
+  /// \brief The document, as a string.
+  std::string document;
+
+  /// \brief The errors, with their line numbers and XML paths.
+  std::vector<std::string> errors;
+};
+
+/////////////////////////////////////////////////
+/// \brief Read a file or a string with or without the streaming reader.
+/// \param[in] _input File name, or SDFormat string.
+/// \param[in] _isFile True if _input is a file name.
+/// \param[in] _convert True to convert the document to the latest version.
+/// \param[in] _streaming True to use the streaming reader.
+/// \return The document and errors.
+static ReadResult read(const std::string &_input, bool _isFile,
+                       bool _convert, bool _streaming)
+{
+  sdf::ParserConfig config;
+  config.SetUseStreamingReader(_streaming);
+  config.SetUnrecognizedElementsPolicy(sdf::EnforcementPolicy::ERR);
+
+  sdf::SDFPtr sdf(new sdf::SDF());
+  EXPECT_TRUE(sdf::init(sdf, config));
+
+  ReadResult result;
+  sdf::Errors errors;
+  if (_isFile && _convert)
+    result.success = sdf::readFile(_input, config, sdf, errors);
+  else if (_isFile)
+    result.success = sdf::readFileWithoutConversion(_input, config, sdf,
+                                                     errors);
+  else if (_convert)
+    result.success = sdf::readString(_input, config, sdf, errors);
+  else
+    result.success = sdf::readStringWithoutConversion(_input, config, sdf,
+                                                       errors);
+
+  result.document = sdf->Root()->ToString("");
+  for (const sdf::Error &error : errors)
+  {
+    std::stringstream stream;
+    stream << error << " line " << error.LineNumber().value_or(-1)
+           << " path " << error.XmlPath().value_or("")
+           << " file " << error.FilePath().value_or("");
+    result.errors.push_back(stream.str());
+  }
+  return result;
+}
+
+/////////////////////////////////////////////////
+/// \brief Check that the streaming reader gives the same result as tinyxml2.
+/// \param[in] _input File name, or SDFormat string.
+/// \param[in] _isFile True if _input is a file name.
+/// \param[in] _convert True to convert the document to the latest version.
+static void expectSameResult(const std::string &_input, bool _isFile,
+                             bool _convert)
+{
+  const ReadResult dom = read(_input, _isFile, _convert, false);
+  const ReadResult stream = read(_input, _isFile, _convert, true);
+  EXPECT_EQ(dom.success, stream.success) << _input;
+  EXPECT_EQ(dom.document, stream.document) << _input;
+  EXPECT_EQ(dom.errors, stream.errors) << _input;
+}
+
+/////////////////////////////////////////////////
+TEST(StreamingReader, Files)
+{
+  for (const std::string file : {
+           "bad_syntax_pose.sdf",
+           "custom_and_unknown_elements.sdf",
+           "empty_noversion.sdf",
+           "ignore_sdf_in_namespaced_elements.sdf",
+           "ignore_sdf_in_plugin.sdf",
+           "includes.sdf",
+           "invalid_xml_syntax.sdf",
+           "joint_complete.sdf",
+           "model_invalid_reserved_names.sdf",
+           "model_invalid_top_level_frame.sdf",
+           "shapes.sdf",
+           "unrecognized_elements.sdf",
+           "world_complete.sdf"})
+  {
+    const std::string path = sdf::testing::TestFile("sdf", file);
+    expectSameResult(path, true, false);
+    expectSameResult(path, true, true);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(StreamingReader, Strings)
+{
+  const std::string sdfVersion = std::string("<sdf version='") +
+      SDF_VERSION + "'>";
+  for (const std::string body : {
+           // Values, defaults, comments and entities
+           "<model name='a&amp;b'>\n"
+           "  <!-- comment -->\n"
+           "  <static>true</static>\n"
+           "  <link name='link'>\n"
+           "    <pose>  1 2\n 3   0 0 0</pose>\n"
+           "    <visual name='v'><geometry><box/></geometry></visual>\n"
+           "  </link>\n"
+           "</model>",
+           // Plugins copy their children
+           "<world name='w'>\n"
+           "  <plugin name='p' filename='f'>\n"
+           "    <link name='l'><pose>1</pose></link>\n"
+           "    <custom a='1'>text<!-- c --><b/></custom>\n"
+           "  </plugin>\n"
+           "</world>",
+           // Unknown elements, with and without a namespace
+           "<model name='m'>\n"
+           "  <link name='l'/>\n"
+           "  <unknown x='1'><child>value</child></unknown>\n"
+           "  <ns:custom ns:a='2'>v<ns:b/></ns:custom>\n"
+           "  <pose>1 2 3 0 0 0</pose>\n"
+           "</model>",
+           // Invalid values
+           "<model name='m'>\n"
+           "  <link name='l'>\n"
+           "    <pose>1 2 three</pose>\n"
+           "  </link>\n"
+           "</model>",
+           // Missing required attribute
+           "<model>\n"
+           "  <link name='l'/>\n"
+           "</model>",
+           // Top level pose relative to a frame
+           "<model name='m'>\n"
+           "  <pose relative_to='f'>1 0 0 0 0 0</pose>\n"
+           "  <link name='l'/>\n"
+           "</model>",
+           // Reserved names
+           "<model name='m::n'><link name='l'/></model>",
+           // Included model
+           "<world name='w'>\n"
+           "  <include><uri>missing</uri></include>\n"
+           "</world>",
+           // XML read by tinyxml2 only
+           "<model name='m'><link name='&#108;'/></model>",
+           "<model name='m'><link name='l'/><![CDATA[x]]></model>",
+           // Malformed XML
+           "<model name='m'><link name='l'></model>"})
+  {
+    const std::string document = sdfVersion + body + "</sdf>";
+    expectSameResult(document, false, false);
+    expectSameResult(document, false, true);
+  }
+
+  // Documents of an older version are converted by tinyxml2
+  expectSameResult("<sdf version='1.6'><model name='m'>"
+                   "<link name='l'/></model></sdf>", false, true);
+  expectSameResult("<robot name='r'><link name='l'/></robot>", false, true);
+}
+
+/////////////////////////////////////////////////
+TEST(StreamingReader, RootLoad)
+{
+  const std::string document = std::string("<sdf version='") + SDF_VERSION +
+      "'>\n"
+      "<world name='default'>\n"
+      "  <model name='m'>\n"
+      "    <link name='l'/>\n"
+      "    <joint name='j' type='fixed'>\n"
+      "      <parent>world</parent><child>l</child>\n"
+      "    </joint>\n"
+      "  </model>\n"
+      "</world>\n"
+      "</sdf>\n";
+
+  sdf::ParserConfig config;
+  config.SetUseStreamingReader(true);
+  sdf::Root root;
+  sdf::Errors errors = root.LoadSdfString(document, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+  ASSERT_NE(nullptr, root.WorldByIndex(0));
+  const sdf::Model *model = root.WorldByIndex(0)->ModelByIndex(0);
+  ASSERT_NE(nullptr, model);
+  EXPECT_EQ("m", model->Name());
+  EXPECT_EQ(1u, model->JointCount());
+  ASSERT_TRUE(model->Element()->LineNumber().has_value());
+  EXPECT_EQ(3, model->Element()->LineNumber().value());
+  EXPECT_EQ("/sdf/world[@name=\"default\"]/model[@name=\"m\"]",
+            model->Element()->XmlPath());
+}
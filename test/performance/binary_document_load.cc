@@ -0,0 +1,97 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+#include "test_config.hh"
+#include "test_utils.hh"
+
+/////////////////////////////////////////////////
+/// \brief Load a large world from XML and from a binary document.
+TEST(BinaryDocument, LargeWorld_performance)
+{
+  sdf::ParserConfig config;
+  config.SetFindCallback([](const std::string &_input)
+      {
+        return sdf::testing::TestFile("integration", "model", _input);
+      });
+
+  std::string tmpDir;
+  ASSERT_TRUE(sdf::testing::TestTmpPath(tmpDir));
+  const std::string xmlFile =
+      (std::filesystem::path(tmpDir) / "large_world.sdf").string();
+  const std::string binaryFile =
+      (std::filesystem::path(tmpDir) / "large_world.sdfb").string();
+  {
+    std::ofstream out(xmlFile);
+    out << sdf::testing::manyModelWorld(4000, SDF_VERSION, 200);
+  }
+
+  // Load from XML
+  auto start = std::chrono::steady_clock::now();
+  sdf::Root xmlRoot;
+  sdf::Errors errors = xmlRoot.Load(xmlFile, config);
+  auto end = std::chrono::steady_clock::now();
+  ASSERT_TRUE(errors.empty()) << errors;
+  const double xmlMs =
+      std::chrono::duration<double, std::milli>(end - start).count();
+
+  // Save the parsed document
+  sdf::SDFPtr sdf(new sdf::SDF());
+  ASSERT_TRUE(sdf::init(sdf, config));
+  ASSERT_TRUE(sdf::readFile(xmlFile, config, sdf, errors)) << errors;
+  start = std::chrono::steady_clock::now();
+  sdf->SaveBinary(errors, binaryFile);
+  end = std::chrono::steady_clock::now();
+  ASSERT_TRUE(errors.empty()) << errors;
+  const double saveMs =
+      std::chrono::duration<double, std::milli>(end - start).count();
+
+  // Load from the binary document
+  start = std::chrono::steady_clock::now();
+  auto loaded = std::make_shared<sdf::SDF>();
+  loaded->LoadBinary(errors, binaryFile, config);
+  sdf::Root binaryRoot;
+  sdf::Errors loadErrors = binaryRoot.Load(loaded, config);
+  end = std::chrono::steady_clock::now();
+  ASSERT_TRUE(errors.empty()) << errors;
+  ASSERT_TRUE(loadErrors.empty()) << loadErrors;
+  const double binaryMs =
+      std::chrono::duration<double, std::milli>(end - start).count();
+
+  std::cout << "XML: " << xmlMs << " ms, save binary: " << saveMs
+            << " ms (" << std::filesystem::file_size(binaryFile) << " bytes, "
+            << std::filesystem::file_size(xmlFile) << " bytes of XML)"
+            << ", binary: " << binaryMs << " ms" << std::endl;
+
+  ASSERT_NE(nullptr, binaryRoot.WorldByIndex(0));
+  EXPECT_EQ(4200u, binaryRoot.WorldByIndex(0)->ModelCount());
+  EXPECT_EQ(xmlRoot.Element()->ToString(""),
+            binaryRoot.Element()->ToString(""));
+
+  std::remove(xmlFile.c_str());
+  std::remove(binaryFile.c_str());
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/ConversionCache.hh"
+#include "sdf/sdf.hh"
+#include "test_config.hh"
+#include "test_utils.hh"
+
+/////////////////////////////////////////////////
+/// \brief Read a file.
+/// \param[in] _file Path of the file.
+/// \param[in] _config Parser configuration.
+/// \return Time taken in milliseconds.
+static double readTime(const std::string &_file,
+                       const sdf::ParserConfig &_config)
+{
+  auto start = std::chrono::steady_clock::now();
+  sdf::SDFPtr sdf(new sdf::SDF());
+  sdf::init(sdf, _config);
+  sdf::Errors errors;
+  EXPECT_TRUE(sdf::readFile(_file, _config, sdf, errors));
+  EXPECT_TRUE(errors.empty()) << errors;
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/////////////////////////////////////////////////
+/// \brief Read a converted world with and without the conversion cache.
+TEST(ConversionCache, ConvertedWorld_performance)
+{
+  std::string tmpDir;
+  ASSERT_TRUE(sdf::testing::TestTmpPath(tmpDir));
+  const std::filesystem::path directory =
+      std::filesystem::path(tmpDir) / "conversion_cache_performance";
+  std::filesystem::remove_all(directory);
+  const std::string file =
+      (std::filesystem::path(tmpDir) / "old_world.sdf").string();
+  {
+    std::ofstream out(file);
+    out << sdf::testing::manyModelWorld(2000, "1.6");
+  }
+
+  sdf::ParserConfig config;
+  const double uncachedMs = readTime(file, config);
+
+  auto cache = std::make_shared<sdf::ConversionCache>(directory.string());
+  config.SetConversionCache(cache);
+  const double missMs = readTime(file, config);
+  const double hitMs = readTime(file, config);
+  EXPECT_EQ(1u, cache->Hits());
+
+  std::cout << "uncached: " << uncachedMs << " ms, miss: " << missMs
+            << " ms, hit: " << hitMs << " ms (" << cache->Size()
+            << " bytes in the cache)" << std::endl;
+
+  std::filesystem::remove_all(directory);
+  std::remove(file.c_str());
+}
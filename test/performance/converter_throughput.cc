@@ -0,0 +1,101 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+
+/////////////////////////////////////////////////
+/// \brief Generate a small model, like those of an asset store.
+/// \param[in] _version SDFormat version of the document.
+/// \return SDFormat string of the model.
+static std::string smallModel(const std::string &_version)
+{
+  std::ostringstream stream;
+  stream
+    << "<?xml version='1.0'?>\n"
+    << "<sdf version='" << _version << "'>\n"
+    << "<model name='model'>\n"
+    << "  <pose>1 0 0 0 0 0</pose>\n"
+    << "  <link name='base'>\n"
+    << "    <inertial><mass>1</mass></inertial>\n"
+    << "    <collision name='collision'>\n"
+    << "      <geometry><box><size>1 1 1</size></box></geometry>\n"
+    << "    </collision>\n"
+    << "    <visual name='visual'>\n"
+    << "      <geometry><box><size>1 1 1</size></box></geometry>\n"
+    << "    </visual>\n"
+    << "  </link>\n"
+    << "  <link name='arm'>\n"
+    << "    <pose>0 0 1 0 0 0</pose>\n"
+    << "    <sensor name='imu' type='imu'/>\n"
+    << "  </link>\n"
+    << "  <joint name='joint' type='revolute'>\n"
+    << "    <parent>base</parent>\n"
+    << "    <child>arm</child>\n"
+    << "    <axis><xyz>0 0 1</xyz></axis>\n"
+    << "  </joint>\n"
+    << "</model>\n"
+    << "</sdf>\n";
+  return stream.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief Read many small documents.
+/// \param[in] _document SDFormat string of each document.
+/// \param[in] _count Number of documents to read.
+/// \return Time taken in milliseconds.
+static double readMany(const std::string &_document, int _count)
+{
+  sdf::ParserConfig config;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < _count; ++i)
+  {
+    sdf::SDFPtr sdf(new sdf::SDF());
+    sdf::init(sdf, config);
+    sdf::Errors errors;
+    EXPECT_TRUE(sdf::readString(_document, config, sdf, errors));
+    EXPECT_TRUE(errors.empty()) << errors;
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/////////////////////////////////////////////////
+/// \brief Read many small documents that are converted from older versions,
+/// and compare with documents of the current version.
+TEST(Converter, Throughput_performance)
+{
+  const int count = 2000;
+  const double currentMs = readMany(smallModel(SDF_VERSION), count);
+  std::cout << SDF_VERSION << ": " << count / currentMs * 1000
+            << " documents/s" << std::endl;
+
+  for (const std::string version : {"1.6", "1.7", "1.9"})
+  {
+    const double convertedMs = readMany(smallModel(version), count);
+    std::cout << version << ": " << count / convertedMs * 1000
+              << " documents/s, conversion "
+              << (convertedMs - currentMs) * 1000 / count
+              << " us per document" << std::endl;
+  }
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+#include "test_utils.hh"
+
+/////////////////////////////////////////////////
+/// \brief Generate a world with a single model made of many links, each with
+/// a visual, a collision and a joint to the previous link.
+/// \param[in] _linkCount Number of links in the model.
+/// \return SDFormat string of the world.
+static std::string largeWorld(int _linkCount)
+{
+  std::ostringstream stream;
+  stream << "<sdf version='" << SDF_VERSION << "'>\n"
+         << "<world name='default'>\n"
+         << "<model name='big_model'>\n";
+  for (int i = 0; i < _linkCount; ++i)
+  {
+    stream
+      << "<link name='link" << i << "'>\n"
+      << "  <pose>" << i << " 0 0 0 0 0</pose>\n"
+      << "  <inertial><mass>1</mass></inertial>\n"
+      << "  <collision name='collision'>\n"
+      << "    <geometry><box><size>1 1 1</size></box></geometry>\n"
+      << "  </collision>\n"
+      << "  <visual name='visual'>\n"
+      << "    <geometry><box><size>1 1 1</size></box></geometry>\n"
+      << "  </visual>\n"
+      << "</link>\n";
+    if (i > 0)
+    {
+      stream
+        << "<joint name='joint" << i << "' type='revolute'>\n"
+        << "  <parent>link" << i - 1 << "</parent>\n"
+        << "  <child>link" << i << "</child>\n"
+        << "  <axis><xyz>0 0 1</xyz></axis>\n"
+        << "</joint>\n";
+    }
+  }
+  stream << "</model>\n</world>\n</sdf>";
+  return stream.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief Load a world, then destroy it, and report the timings.
+/// \param[in] _world SDFormat string of the world.
+/// \param[in] _useArena True to load the world into a document arena.
+static void loadAndRelease(const std::string &_world, bool _useArena)
+{
+  sdf::ParserConfig config;
+  config.SetUseDocumentArena(_useArena);
+
+  const int64_t residentBefore = sdf::testing::residentKb();
+  auto root = std::make_unique<sdf::Root>();
+
+  auto start = std::chrono::steady_clock::now();
+  sdf::Errors errors = root->LoadSdfString(_world, config);
+  auto loaded = std::chrono::steady_clock::now();
+  EXPECT_TRUE(errors.empty()) << errors;
+  ASSERT_NE(nullptr, root->WorldByIndex(0));
+  ASSERT_NE(nullptr, root->WorldByIndex(0)->ModelByIndex(0));
+
+  const int64_t residentLoaded = sdf::testing::residentKb();
+
+  auto teardownStart = std::chrono::steady_clock::now();
+  root.reset();
+  auto end = std::chrono::steady_clock::now();
+
+  std::cout << (_useArena ? "arena" : "heap ") << ": load "
+            << std::chrono::duration<double, std::milli>(loaded - start).count()
+            << " ms, teardown "
+            << std::chrono::duration<double, std::milli>(
+                   end - teardownStart).count()
+            << " ms, resident growth " << residentLoaded - residentBefore
+            << " kB, peak resident " << sdf::testing::peakResidentKb() << " kB"
+            << std::endl;
+}
+
+/////////////////////////////////////////////////
+TEST(DocumentArenaLoad, LargeWorld_performance)
+{
+  const int linkCount = 10000;
+  const std::string world = largeWorld(linkCount);
+
+  // Peak resident size only grows, so the arena is measured first to keep
+  // its peak from being hidden by the heap run.
+  loadAndRelease(world, true);
+  loadAndRelease(world, false);
+  loadAndRelease(world, true);
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+#include "test_utils.hh"
+
+/////////////////////////////////////////////////
+/// \brief Load a world that includes many distinct models, reading the
+/// included files one at a time and on worker threads.
+TEST(IncludeParallel, DistinctModels_performance)
+{
+  const int modelCount = 500;
+  const std::filesystem::path dir =
+      std::filesystem::temp_directory_path() / "sdf_include_parallel";
+  std::filesystem::remove_all(dir);
+
+  std::ostringstream world;
+  world << "<sdf version='" << SDF_VERSION << "'>\n"
+        << "<world name='default'>\n";
+  for (int i = 0; i < modelCount; ++i)
+  {
+    const std::string name = "model" + std::to_string(i);
+    // An older version, so that every included file is also converted.
+    sdf::testing::writeModel(dir / name, name, "1.9", 10);
+    world << "<include><uri>" << (dir / name).string() << "</uri>"
+          << "<pose>" << i << " 0 0 0 0 0</pose></include>\n";
+  }
+  world << "</world>\n</sdf>";
+
+  const unsigned int workerCount =
+      std::max(2u, std::thread::hardware_concurrency());
+
+  std::string serialDocument;
+  double serialMs = 0;
+  for (unsigned int count : {0u, workerCount})
+  {
+    sdf::ParserConfig config;
+    config.SetIncludeWorkerCount(count);
+
+    sdf::Root root;
+    auto start = std::chrono::steady_clock::now();
+    sdf::Errors errors = root.LoadSdfString(world.str(), config);
+    auto end = std::chrono::steady_clock::now();
+    EXPECT_TRUE(errors.empty()) << errors;
+    ASSERT_NE(nullptr, root.WorldByIndex(0));
+    EXPECT_EQ(static_cast<uint64_t>(modelCount),
+              root.WorldByIndex(0)->ModelCount());
+
+    const double ms =
+        std::chrono::duration<double, std::milli>(end - start).count();
+    std::cout << modelCount << " distinct includes, " << count
+              << " worker threads: load " << ms << " ms";
+    if (count == 0)
+    {
+      serialDocument = root.Element()->ToString("");
+      serialMs = ms;
+    }
+    else
+    {
+      EXPECT_EQ(serialDocument, root.Element()->ToString(""));
+      std::cout << ", speedup " << serialMs / ms;
+    }
+    std::cout << std::endl;
+  }
+
+  std::filesystem::remove_all(dir);
+}
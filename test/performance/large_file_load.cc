@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+
+/////////////////////////////////////////////////
+/// \brief Write a world with many models, and a parse error on its last
+/// line if requested.
+/// \param[in] _filename Path of the file.
+/// \param[in] _modelCount Number of models.
+/// \param[in] _brokenEnd True to leave the last element unclosed.
+static void writeWorld(const std::string &_filename, int _modelCount,
+                       bool _brokenEnd)
+{
+  std::ofstream sdf(_filename);
+  sdf << "<?xml version='1.0'?>\n"
+      << "<sdf version='" << SDF_VERSION << "'>\n"
+      << "<world name='default'>\n";
+  for (int i = 0; i < _modelCount; ++i)
+  {
+    sdf << "  <model name='model" << i << "'>\n"
+        << "    <pose>" << i << " 0 0 0 0 0</pose>\n"
+        << "    <link name='link'>\n"
+        << "      <inertial><mass>1</mass></inertial>\n"
+        << "      <collision name='collision'>\n"
+        << "        <geometry><box><size>1  1  1</size></box></geometry>\n"
+        << "      </collision>\n"
+        << "      <visual name='visual'>\n"
+        << "        <geometry><box><size>1  1  1</size></box></geometry>\n"
+        << "      </visual>\n"
+        << "    </link>\n"
+        << "  </model>\n";
+  }
+  sdf << "</world>\n";
+  if (!_brokenEnd)
+    sdf << "</sdf>\n";
+}
+
+/////////////////////////////////////////////////
+/// \brief Load a large world file.
+TEST(LargeFileLoad, Read_performance)
+{
+  const int modelCount = 40000;
+  const std::string filename =
+      (std::filesystem::temp_directory_path() / "sdf_large_file.sdf").string();
+  writeWorld(filename, modelCount, false);
+  std::cout << "File size: " << std::filesystem::file_size(filename) / 1e6
+            << " MB" << std::endl;
+
+  // Reading the XML only.
+  std::vector<std::string> worldNames;
+  sdf::Root root;
+  auto start = std::chrono::steady_clock::now();
+  sdf::Errors errors = root.WorldNamesFromFile(filename, worldNames);
+  const double xmlMs = std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - start).count();
+  EXPECT_TRUE(errors.empty()) << errors;
+  EXPECT_EQ(1u, worldNames.size());
+
+  start = std::chrono::steady_clock::now();
+  errors = root.Load(filename);
+  const double loadMs = std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - start).count();
+  EXPECT_TRUE(errors.empty()) << errors;
+  ASSERT_NE(nullptr, root.WorldByIndex(0));
+  EXPECT_EQ(static_cast<uint64_t>(modelCount),
+            root.WorldByIndex(0)->ModelCount());
+  std::cout << "XML " << xmlMs << " ms, load " << loadMs << " ms"
+            << std::endl;
+
+  // A parse error at the end of the file is reported.
+  writeWorld(filename, modelCount, true);
+  errors = root.Load(filename);
+  EXPECT_FALSE(errors.empty());
+
+  std::filesystem::remove(filename);
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+#include "test_utils.hh"
+
+/////////////////////////////////////////////////
+/// \brief Get the time elapsed since a time point.
+/// \param[in] _start Start time.
+/// \return Elapsed time in milliseconds.
+static double elapsedMs(std::chrono::steady_clock::time_point _start)
+{
+  return std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - _start).count();
+}
+
+/////////////////////////////////////////////////
+/// \brief Resolve includes from a directory with many models, with and
+/// without a model index.
+TEST(ModelIndex, ManyModels_performance)
+{
+  const int modelCount = 5000;
+  const int includeCount = 500;
+
+  // Several search paths, with the models in the last one, so that every
+  // lookup without an index probes each of them.
+  const std::filesystem::path dir =
+      std::filesystem::temp_directory_path() / "sdf_model_index_performance";
+  std::filesystem::remove_all(dir);
+  sdf::ParserConfig config;
+  for (int i = 0; i < 8; ++i)
+  {
+    const std::filesystem::path path = dir / ("other" + std::to_string(i));
+    std::filesystem::create_directories(path);
+    config.AddURIPath("model://", path.string());
+  }
+  for (int i = 0; i < modelCount; ++i)
+  {
+    const std::string name = "model" + std::to_string(i);
+    sdf::testing::writeModel(dir / "models" / name, name);
+  }
+  config.AddURIPath("model://", (dir / "models").string());
+
+  std::ostringstream world;
+  world << "<sdf version='" << SDF_VERSION << "'>\n"
+        << "<world name='default'>\n";
+  for (int i = 0; i < includeCount; ++i)
+  {
+    world << "<include><uri>model://model" << i * (modelCount / includeCount)
+          << "</uri></include>\n";
+  }
+  world << "</world>\n</sdf>";
+
+  // Startup: scan the search paths, then save and load the index.
+  auto index = std::make_shared<sdf::ModelIndex>();
+  auto start = std::chrono::steady_clock::now();
+  sdf::Errors errors =
+      index->Build(config, std::max(1u, std::thread::hardware_concurrency()));
+  const double buildMs = elapsedMs(start);
+  EXPECT_TRUE(errors.empty()) << errors;
+  EXPECT_EQ(static_cast<uint64_t>(modelCount), index->ModelCount());
+
+  const std::string indexFile = (dir / "index.txt").string();
+  EXPECT_TRUE(index->Save(indexFile).empty());
+  sdf::ModelIndex loaded;
+  start = std::chrono::steady_clock::now();
+  errors = loaded.Load(indexFile);
+  const double loadMs = elapsedMs(start);
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  std::cout << modelCount << " models: index built in " << buildMs
+            << " ms, loaded from file in " << loadMs << " ms" << std::endl;
+
+  // Resolution of the included models.
+  std::string withoutIndex;
+  for (bool useIndex : {false, true})
+  {
+    sdf::ParserConfig loadConfig(config);
+    if (useIndex)
+      loadConfig.SetModelIndex(index);
+
+    sdf::Root root;
+    start = std::chrono::steady_clock::now();
+    errors = root.LoadSdfString(world.str(), loadConfig);
+    const double ms = elapsedMs(start);
+    EXPECT_TRUE(errors.empty()) << errors;
+    ASSERT_NE(nullptr, root.Element());
+
+    std::cout << includeCount << " includes " << (useIndex ? "with" : "without")
+              << " index: load " << ms << " ms, " << ms / includeCount
+              << " ms per include" << std::endl;
+    if (useIndex)
+      EXPECT_EQ(withoutIndex, root.Element()->ToString(""));
+    else
+      withoutIndex = root.Element()->ToString("");
+  }
+
+  std::filesystem::remove_all(dir);
+}
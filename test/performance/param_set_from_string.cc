@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/Param.hh"
+
+/////////////////////////////////////////////////
+/// \brief Time Param::SetFromString for one parameter type.
+/// \param[in] _typeName Type of the parameter.
+/// \param[in] _value String to set the parameter from.
+static void timeSetFromString(const std::string &_typeName,
+                              const std::string &_value)
+{
+  const int iterations = 100000;
+  sdf::Param param("key", _typeName, _value, false);
+
+  sdf::Errors errors;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i)
+  {
+    param.SetFromString(_value, errors);
+  }
+  auto end = std::chrono::steady_clock::now();
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  std::cout << _typeName << ": "
+            << std::chrono::duration<double, std::nano>(end - start).count() /
+               iterations
+            << " ns per SetFromString" << std::endl;
+}
+
+/////////////////////////////////////////////////
+TEST(ParamSetFromString, AllTypes_performance)
+{
+  timeSetFromString("bool", "true");
+  timeSetFromString("char", "c");
+  timeSetFromString("string", "some_name");
+  timeSetFromString("int", "-42");
+  timeSetFromString("uint64_t", "42");
+  timeSetFromString("unsigned int", "42");
+  timeSetFromString("double", "0.125");
+  timeSetFromString("float", "0.125");
+  timeSetFromString("time", "1 500");
+  timeSetFromString("angle", "1.5");
+  timeSetFromString("color", "0.1 0.2 0.3 1");
+  timeSetFromString("vector2i", "1 2");
+  timeSetFromString("vector2d", "1.5 2.5");
+  timeSetFromString("vector3", "1 2 3");
+  timeSetFromString("quaternion", "1 0 0 0");
+  timeSetFromString("pose", "1 2 3 0 0 0");
+}
@@ -15,7 +15,16 @@
  *
  */
 
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -33,3 +42,234 @@ TEST(URDFParser, AtlasURDF_5runs_performance)
     sdf::SDFPtr root = sdf::readFile(URDF_TEST_FILE);
   }
 }
+
+/////////////////////////////////////////////////
+/// \brief Time a function.
+/// \param[in] _runs Number of times to call the function.
+/// \param[in] _function Function to time.
+/// \return Average time of a call in milliseconds.
+static double averageMs(int _runs, const std::function<void()> &_function)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < _runs; ++i)
+    _function();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count() /
+         _runs;
+}
+
+/////////////////////////////////////////////////
+/// \brief Report the time taken by each stage of reading the atlas URDF.
+/// The stages are timed through the public API, so the time of a stage is
+/// the difference between a read that includes it and one that does not.
+TEST(URDFParser, AtlasURDF_stages_performance)
+{
+  const std::string file =
+      sdf::testing::TestFile("performance", "parser_urdf_atlas.urdf");
+  const int runs = 5;
+  sdf::ParserConfig config;
+
+  std::string urdf;
+  const double fileMs = averageMs(runs, [&]()
+      {
+        std::ifstream stream(file, std::ios::binary);
+        urdf.assign(std::istreambuf_iterator<char>(stream),
+                    std::istreambuf_iterator<char>());
+      });
+  ASSERT_FALSE(urdf.empty());
+
+  // Reading the file: file read, XML parse, URDF conversion, SDFormat
+  // version conversion and element building
+  sdf::SDFPtr sdf;
+  const double readFileMs = averageMs(runs, [&]()
+      {
+        sdf.reset(new sdf::SDF());
+        sdf::init(sdf, config);
+        sdf::Errors errors;
+        EXPECT_TRUE(sdf::readFile(file, config, sdf, errors)) << errors;
+      });
+
+  // Reading the string: the same, without the file read
+  const double readUrdfMs = averageMs(runs, [&]()
+      {
+        sdf::SDFPtr urdfSdf(new sdf::SDF());
+        sdf::init(urdfSdf, config);
+        sdf::Errors errors;
+        EXPECT_TRUE(sdf::readString(urdf, config, urdfSdf, errors))
+            << errors;
+      });
+
+  // Reading the converted model: XML parse and element building only
+  const std::string converted = sdf->ToString();
+  const double readSdfMs = averageMs(runs, [&]()
+      {
+        sdf::SDFPtr sdfSdf(new sdf::SDF());
+        sdf::init(sdfSdf, config);
+        sdf::Errors errors;
+        EXPECT_TRUE(sdf::readString(converted, config, sdfSdf, errors))
+            << errors;
+      });
+
+  // Building the DOM from the elements
+  const double domMs = averageMs(runs, [&]()
+      {
+        sdf::Root root;
+        root.Load(sdf, config);
+        EXPECT_NE(nullptr, root.Model());
+      });
+
+  std::cout << "file read: " << fileMs << " ms\n"
+            << "readFile: " << readFileMs << " ms\n"
+            << "  file read and detection: " << readFileMs - readUrdfMs
+            << " ms\n"
+            << "  URDF conversion: " << readUrdfMs - readSdfMs << " ms\n"
+            << "  SDFormat parse and elements: " << readSdfMs << " ms\n"
+            << "DOM: " << domMs << " ms" << std::endl;
+}
+
+/////////////////////////////////////////////////
+/// \brief Read a URDF file.
+/// \param[in] _file Path of the file.
+/// \return SDFormat string of the converted file.
+static std::string readUrdf(const std::string &_file)
+{
+  sdf::ParserConfig config;
+  sdf::SDFPtr sdf(new sdf::SDF());
+  sdf::init(sdf, config);
+  sdf::Errors errors;
+  EXPECT_TRUE(sdf::readFile(_file, config, sdf, errors)) << errors;
+  return sdf->ToString();
+}
+
+/////////////////////////////////////////////////
+/// \brief Convert the atlas URDF on several threads at once, and check that
+/// every result is the same as the serial one.
+TEST(URDFParser, AtlasURDF_parallel_performance)
+{
+  const std::string file =
+      sdf::testing::TestFile("performance", "parser_urdf_atlas.urdf");
+  const unsigned int threadCount =
+      std::max(4u, std::thread::hardware_concurrency());
+  const int runs = 5;
+
+  auto start = std::chrono::steady_clock::now();
+  const std::string expected = readUrdf(file);
+  auto end = std::chrono::steady_clock::now();
+  ASSERT_FALSE(expected.empty());
+  const double serialMs =
+      std::chrono::duration<double, std::milli>(end - start).count();
+
+  std::vector<std::vector<std::string>> results(threadCount);
+  std::vector<std::thread> threads;
+  start = std::chrono::steady_clock::now();
+  for (unsigned int t = 0; t < threadCount; ++t)
+  {
+    threads.emplace_back([&file, &results, t]()
+        {
+          for (int i = 0; i < runs; ++i)
+            results[t].push_back(readUrdf(file));
+        });
+  }
+  for (std::thread &thread : threads)
+    thread.join();
+  end = std::chrono::steady_clock::now();
+  const double parallelMs =
+      std::chrono::duration<double, std::milli>(end - start).count();
+
+  for (const std::vector<std::string> &threadResults : results)
+  {
+    ASSERT_EQ(static_cast<std::size_t>(runs), threadResults.size());
+    for (const std::string &result : threadResults)
+      EXPECT_EQ(expected, result);
+  }
+
+  std::cout << "serial: " << serialMs << " ms per conversion, "
+            << threadCount << " threads: "
+            << threadCount * runs / parallelMs * 1000
+            << " conversions/s" << std::endl;
+}
+
+/////////////////////////////////////////////////
+/// \brief Generate a URDF with a chain of links connected by fixed joints.
+/// Every tenth link has a sensor extension, and a plugin extension refers
+/// to the last link, so extensions are reduced along with the links.
+/// Extensions are not added to every link because inserting the lumped
+/// collisions and visuals searches all the extensions of the link.
+/// \param[in] _linkCount Number of links in the chain.
+/// \return URDF string of the chain.
+static std::string fixedJointChain(int _linkCount)
+{
+  std::ostringstream stream;
+  stream << "<robot name='chain'>\n";
+  for (int i = 0; i < _linkCount; ++i)
+  {
+    stream
+      << "<link name='link" << i << "'>\n"
+      << "  <inertial>\n"
+      << "    <mass value='1'/>\n"
+      << "    <inertia ixx='1' ixy='0' ixz='0' iyy='1' iyz='0' izz='1'/>\n"
+      << "  </inertial>\n"
+      << "  <visual><geometry><box size='1 1 1'/></geometry></visual>\n"
+      << "  <collision><geometry><box size='1 1 1'/></geometry></collision>\n"
+      << "</link>\n";
+    if (i % 10 == 0)
+    {
+      stream
+        << "<gazebo reference='link" << i << "'>\n"
+        << "  <sensor name='sensor" << i << "' type='imu'>\n"
+        << "    <pose>0 0 0.5 0 0 0</pose>\n"
+        << "  </sensor>\n"
+        << "</gazebo>\n";
+    }
+    if (i > 0)
+    {
+      stream
+        << "<joint name='joint" << i << "' type='fixed'>\n"
+        << "  <parent link='link" << i - 1 << "'/>\n"
+        << "  <child link='link" << i << "'/>\n"
+        << "  <origin xyz='0.1 0 0' rpy='0 0 0.01'/>\n"
+        << "</joint>\n";
+    }
+  }
+  stream
+    << "<gazebo>\n"
+    << "  <plugin name='plugin' filename='plugin'>\n"
+    << "    <bodyName>link" << _linkCount - 1 << "</bodyName>\n"
+    << "  </plugin>\n"
+    << "</gazebo>\n"
+    << "</robot>\n";
+  return stream.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief Convert chains of fixed joints of growing length, to show how the
+/// time of fixed joint reduction scales with the number of links.
+TEST(URDFParser, FixedJointChain_performance)
+{
+  sdf::ParserConfig config;
+  for (int linkCount : {100, 1000, 10000})
+  {
+    const std::string urdf = fixedJointChain(linkCount);
+    const double ms = averageMs(1, [&]()
+        {
+          sdf::SDFPtr sdf(new sdf::SDF());
+          sdf::init(sdf, config);
+          sdf::Errors errors;
+          EXPECT_TRUE(sdf::readString(urdf, config, sdf, errors)) << errors;
+          sdf::ElementPtr model = sdf->Root()->GetElement("model");
+          EXPECT_FALSE(model->HasElement("joint"));
+          int sensorCount = 0;
+          for (sdf::ElementPtr sensor =
+                   model->GetElement("link")->FindElement("sensor");
+               sensor; sensor = sensor->GetNextElement("sensor"))
+          {
+            ++sensorCount;
+          }
+          EXPECT_EQ(linkCount / 10, sensorCount);
+          EXPECT_EQ("link0", model->GetElement("plugin")->Get<std::string>(
+              "bodyName"));
+        });
+    std::cout << linkCount << " links: " << ms << " ms ("
+              << ms / linkCount * 1000 << " us per link)" << std::endl;
+  }
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+
+/////////////////////////////////////////////////
+/// \brief Generate a model in which every link has several sensors.
+/// \param[in] _linkCount Number of links in the model.
+/// \return SDFormat string of the model.
+static std::string sensorHeavyModel(int _linkCount)
+{
+  std::ostringstream stream;
+  stream << "<sdf version='" << SDF_VERSION << "'>\n"
+         << "<model name='sensor_model'>\n";
+  for (int i = 0; i < _linkCount; ++i)
+  {
+    stream
+      << "<link name='link" << i << "'>\n"
+      << "  <pose>" << i << " 0 0 0 0 0</pose>\n"
+      << "  <sensor name='camera' type='camera'>\n"
+      << "    <update_rate>30</update_rate>\n"
+      << "    <camera>\n"
+      << "      <horizontal_fov>1.047</horizontal_fov>\n"
+      << "      <image><width>320</width><height>240</height></image>\n"
+      << "      <clip><near>0.1</near><far>100</far></clip>\n"
+      << "    </camera>\n"
+      << "  </sensor>\n"
+      << "  <sensor name='depth' type='depth_camera'>\n"
+      << "    <camera>\n"
+      << "      <image><width>640</width><height>480</height></image>\n"
+      << "    </camera>\n"
+      << "  </sensor>\n"
+      << "  <sensor name='imu' type='imu'>\n"
+      << "    <imu>\n"
+      << "      <angular_velocity><x><noise type='gaussian'>"
+      << "<mean>0</mean><stddev>0.01</stddev></noise></x>"
+      << "</angular_velocity>\n"
+      << "    </imu>\n"
+      << "  </sensor>\n"
+      << "  <sensor name='lidar' type='gpu_lidar'>\n"
+      << "    <lidar>\n"
+      << "      <scan><horizontal><samples>640</samples>"
+      << "<min_angle>-1.5</min_angle><max_angle>1.5</max_angle>"
+      << "</horizontal></scan>\n"
+      << "      <range><min>0.1</min><max>30</max></range>\n"
+      << "    </lidar>\n"
+      << "  </sensor>\n"
+      << "  <sensor name='contact' type='contact'>\n"
+      << "    <contact><collision>collision</collision></contact>\n"
+      << "  </sensor>\n"
+      << "  <collision name='collision'>\n"
+      << "    <geometry><box><size>1 1 1</size></box></geometry>\n"
+      << "  </collision>\n"
+      << "</link>\n";
+  }
+  stream << "</model>\n</sdf>";
+  return stream.str();
+}
+
+/////////////////////////////////////////////////
+TEST(SensorModelLoad, SensorHeavyModel_performance)
+{
+  const int linkCount = 100;
+  const std::string modelString = sensorHeavyModel(linkCount);
+
+  const int runs = 5;
+  double totalMs = 0;
+  for (int i = 0; i < runs; ++i)
+  {
+    sdf::Root root;
+    auto start = std::chrono::steady_clock::now();
+    sdf::Errors errors = root.LoadSdfString(modelString);
+    auto end = std::chrono::steady_clock::now();
+    EXPECT_TRUE(errors.empty()) << errors;
+    ASSERT_NE(nullptr, root.Model());
+    EXPECT_EQ(static_cast<uint64_t>(linkCount), root.Model()->LinkCount());
+    totalMs += std::chrono::duration<double, std::milli>(end - start).count();
+  }
+
+  std::cout << "Loaded a model with " << linkCount << " links and "
+            << linkCount * 5 << " sensors in " << totalMs / runs
+            << " ms on average" << std::endl;
+}
+
+/////////////////////////////////////////////////
+TEST(SensorModelLoad, KeyedElementLookup_performance)
+{
+  sdf::SDFPtr sdf(new sdf::SDF());
+  sdf->SetFromString(sensorHeavyModel(1));
+  sdf::ElementPtr sensor = sdf->Root()->GetElement("model")
+      ->GetElement("link")->GetElement("sensor");
+  ASSERT_NE(nullptr, sensor);
+
+  const int iterations = 100000;
+  auto start = std::chrono::steady_clock::now();
+  double sum = 0;
+  for (int i = 0; i < iterations; ++i)
+  {
+    // Read a child that is set, and one that falls back to its description
+    sum += sensor->Get<double>("update_rate");
+    sum += sensor->Get<bool>("always_on") ? 1.0 : 0.0;
+  }
+  auto end = std::chrono::steady_clock::now();
+  EXPECT_GT(sum, 0.0);
+
+  std::cout << "Keyed Element::Get<T>: "
+            << std::chrono::duration<double, std::nano>(end - start).count() /
+               (2.0 * iterations)
+            << " ns per call" << std::endl;
+}
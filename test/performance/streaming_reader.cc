@@ -0,0 +1,64 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+#include "test_utils.hh"
+
+/////////////////////////////////////////////////
+/// \brief Load a large world with and without the streaming reader.
+TEST(StreamingReader, LargeWorld_performance)
+{
+  // 13 elements per model, about 50000 in total
+  const int modelCount = 4000;
+  const std::string world = sdf::testing::manyModelWorld(modelCount);
+
+  std::string domDocument;
+  for (bool streaming : {false, true})
+  {
+    sdf::ParserConfig config;
+    config.SetUseStreamingReader(streaming);
+
+    sdf::SDFPtr sdf(new sdf::SDF());
+    ASSERT_TRUE(sdf::init(sdf, config));
+
+    sdf::testing::resetPeakResident();
+    const int64_t residentBefore = sdf::testing::residentKb();
+    sdf::Errors errors;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(sdf::readString(world, config, sdf, errors));
+    auto end = std::chrono::steady_clock::now();
+    EXPECT_TRUE(errors.empty()) << errors;
+
+    std::cout << (streaming ? "Streaming" : "tinyxml2") << ": read "
+              << std::chrono::duration<double, std::milli>(end - start).count()
+              << " ms, peak resident growth "
+              << sdf::testing::highWaterResidentKb() - residentBefore
+              << " kB" << std::endl;
+
+    if (!streaming)
+      domDocument = sdf->Root()->ToString("");
+    else
+      EXPECT_EQ(domDocument, sdf->Root()->ToString(""));
+  }
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+
+/////////////////////////////////////////////////
+/// \brief Generate a model made of many links, each with a visual, a
+/// collision and a joint to the previous link.
+/// \param[in] _linkCount Number of links in the model.
+/// \return SDFormat string of the model.
+static std::string largeModel(int _linkCount)
+{
+  std::ostringstream stream;
+  stream << "<sdf version='" << SDF_VERSION << "'>\n"
+         << "<model name='big_model'>\n";
+  for (int i = 0; i < _linkCount; ++i)
+  {
+    stream
+      << "<link name='link" << i << "'>\n"
+      << "  <pose>" << i << " 0.1 0.2 0.3 0.4 0.5</pose>\n"
+      << "  <inertial><mass>1</mass></inertial>\n"
+      << "  <collision name='collision'>\n"
+      << "    <geometry><box><size>1 1 1</size></box></geometry>\n"
+      << "  </collision>\n"
+      << "  <visual name='visual'>\n"
+      << "    <geometry><box><size>1 1 1</size></box></geometry>\n"
+      << "  </visual>\n"
+      << "</link>\n";
+    if (i > 0)
+    {
+      stream
+        << "<joint name='joint" << i << "' type='revolute'>\n"
+        << "  <parent>link" << i - 1 << "</parent>\n"
+        << "  <child>link" << i << "</child>\n"
+        << "  <axis><xyz>0 0 1</xyz></axis>\n"
+        << "</joint>\n";
+    }
+  }
+  stream << "</model>\n</sdf>";
+  return stream.str();
+}
+
+/////////////////////////////////////////////////
+TEST(ToElement, LargeModel_performance)
+{
+  const int linkCount = 2000;
+  const int iterations = 10;
+
+  sdf::Root root;
+  sdf::Errors errors = root.LoadSdfString(largeModel(linkCount));
+  EXPECT_TRUE(errors.empty()) << errors;
+  const sdf::Model *model = root.Model();
+  ASSERT_NE(nullptr, model);
+
+  sdf::ElementPtr elem;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i)
+  {
+    elem = model->ToElement();
+  }
+  auto end = std::chrono::steady_clock::now();
+  ASSERT_NE(nullptr, elem);
+
+  std::cout << "Model::ToElement: "
+            << std::chrono::duration<double, std::milli>(end - start).count() /
+               iterations
+            << " ms per call for " << linkCount << " links" << std::endl;
+
+  // The element holds the same values as the loaded model
+  sdf::ElementPtr linkElem = elem->FindElement("link");
+  ASSERT_NE(nullptr, linkElem);
+  EXPECT_EQ(model->LinkByIndex(0)->RawPose(),
+            linkElem->Get<gz::math::Pose3d>("pose"));
+}
+
+/////////////////////////////////////////////////
+TEST(ToElement, ParamSet_performance)
+{
+  const int iterations = 100000;
+  const gz::math::Pose3d pose(1, 2, 3, 0.1, 0.2, 0.3);
+  sdf::Param param("pose", "pose", "0 0 0 0 0 0", false);
+
+  sdf::Errors errors;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i)
+  {
+    param.Set(pose, errors);
+  }
+  auto end = std::chrono::steady_clock::now();
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  gz::math::Pose3d value;
+  EXPECT_TRUE(param.Get(value));
+  EXPECT_EQ(pose, value);
+
+  std::cout << "Param::Set<Pose3d>: "
+            << std::chrono::duration<double, std::nano>(end - start).count() /
+               iterations
+            << " ns per call" << std::endl;
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+#include "test_utils.hh"
+
+/////////////////////////////////////////////////
+TEST(WorldMemory, ManyModels_performance)
+{
+  // Build the schema once so that it is not counted below.
+  {
+    sdf::Root warmup;
+    EXPECT_TRUE(warmup.LoadSdfString(sdf::testing::manyModelWorld(1)).empty());
+  }
+
+  const int modelCount = 2000;
+  const std::string world = sdf::testing::manyModelWorld(modelCount);
+
+  const int64_t residentBefore = sdf::testing::residentKb();
+  sdf::Root root;
+  auto start = std::chrono::steady_clock::now();
+  sdf::Errors errors = root.LoadSdfString(world);
+  auto end = std::chrono::steady_clock::now();
+  EXPECT_TRUE(errors.empty()) << errors;
+  ASSERT_NE(nullptr, root.WorldByIndex(0));
+  EXPECT_EQ(static_cast<uint64_t>(modelCount),
+            root.WorldByIndex(0)->ModelCount());
+
+  // Every parameter stores its own value, and shares the rest of its
+  // description with the parameters created from the same schema.
+  const int64_t growthKb = sdf::testing::residentKb() - residentBefore;
+  std::cout << modelCount << " models: load "
+            << std::chrono::duration<double, std::milli>(end - start).count()
+            << " ms, resident growth " << growthKb
+            << " kB, peak resident " << sdf::testing::peakResidentKb()
+            << " kB, "
+            << sizeof(sdf::ParamPrivate) << " bytes of private data per "
+            << "parameter" << std::endl;
+
+  // A model of this world has a few dozen elements and DOM objects, while
+  // copying the schema into each of them would take megabytes.
+  if (residentBefore > 0)
+  {
+    EXPECT_LT(growthKb / modelCount, 200);
+  }
+}
@@ -17,11 +17,21 @@
 #ifndef SDF_TEST_UTILS_HH_
 #define SDF_TEST_UTILS_HH_
 
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <ostream>
+#include <sstream>
 #include <string>
 
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
 #include "sdf/Console.hh"
 #include "sdf/Root.hh"
+#include "sdf/sdf_config.h"
 
 namespace sdf
 {
@@ -138,6 +148,165 @@ inline bool notContains(const std::string &_a, const std::string &_b)
   return !contains(_a, _b);;
 }
 
+/// \brief Generate a world with many small models, each with a link that
+/// has a visual and a collision.
+/// \param[in] _modelCount Number of models in the world.
+/// \param[in] _version SDFormat version of the world.
+/// \param[in] _includeCount Number of models included in the world from
+/// the uri "test_model".
+/// \return SDFormat string of the world.
+inline std::string manyModelWorld(int _modelCount,
+                                  const std::string &_version = SDF_VERSION,
+                                  int _includeCount = 0)
+{
+  std::ostringstream stream;
+  stream << "<?xml version='1.0'?>\n"
+         << "<sdf version='" << _version << "'>\n"
+         << "<world name='default'>\n";
+  for (int i = 0; i < _modelCount; ++i)
+  {
+    stream
+      << "<model name='model" << i << "'>\n"
+      << "  <pose>" << i << " 0 0 0 0 0</pose>\n"
+      << "  <link name='link'>\n"
+      << "    <inertial><mass>1</mass></inertial>\n"
+      << "    <collision name='collision'>\n"
+      << "      <geometry><box><size>1 1 1</size></box></geometry>\n"
+      << "    </collision>\n"
+      << "    <visual name='visual'>\n"
+      << "      <geometry><box><size>1 1 1</size></box></geometry>\n"
+      << "    </visual>\n"
+      << "  </link>\n"
+      << "</model>\n";
+  }
+  for (int i = 0; i < _includeCount; ++i)
+  {
+    stream
+      << "<include>\n"
+      << "  <uri>test_model</uri>\n"
+      << "  <name>included" << i << "</name>\n"
+      << "  <pose>" << i << " 1 0 0 0 0</pose>\n"
+      << "</include>\n";
+  }
+  stream << "</world>\n</sdf>\n";
+  return stream.str();
+}
+
+/// \brief Write a model directory with a model.config and a model.sdf file.
+/// The model is a chain of links, each with a visual and a collision,
+/// connected by revolute joints.
+/// \param[in] _dir Directory of the model, which is created if needed.
+/// \param[in] _name Name of the model.
+/// \param[in] _version SDFormat version of the model.
+/// \param[in] _linkCount Number of links in the model.
+inline void writeModel(const std::filesystem::path &_dir,
+                       const std::string &_name,
+                       const std::string &_version = SDF_VERSION,
+                       int _linkCount = 1)
+{
+  std::filesystem::create_directories(_dir);
+  std::ofstream(_dir / "model.config")
+    << "<?xml version='1.0'?>\n"
+    << "<model>\n"
+    << "  <name>" << _name << "</name>\n"
+    << "  <version>1.0</version>\n"
+    << "  <sdf version='" << _version << "'>model.sdf</sdf>\n"
+    << "</model>\n";
+
+  std::ofstream sdf(_dir / "model.sdf");
+  sdf << "<?xml version='1.0'?>\n"
+      << "<sdf version='" << _version << "'>\n"
+      << "<model name='" << _name << "'>\n";
+  for (int i = 0; i < _linkCount; ++i)
+  {
+    sdf << "  <link name='link" << i << "'>\n"
+        << "    <pose>0 0 " << i << " 0 0 0</pose>\n"
+        << "    <inertial><mass>1</mass></inertial>\n"
+        << "    <collision name='collision'>\n"
+        << "      <geometry><box><size>1 1 1</size></box></geometry>\n"
+        << "    </collision>\n"
+        << "    <visual name='visual'>\n"
+        << "      <geometry><box><size>1 1 1</size></box></geometry>\n"
+        << "    </visual>\n"
+        << "  </link>\n";
+    if (i > 0)
+    {
+      sdf << "  <joint name='joint" << i << "' type='revolute'>\n"
+          << "    <parent>link" << i - 1 << "</parent>\n"
+          << "    <child>link" << i << "</child>\n"
+          << "    <axis><xyz>0 0 1</xyz></axis>\n"
+          << "  </joint>\n";
+    }
+  }
+  sdf << "</model>\n</sdf>\n";
+}
+
+/// \brief Get the resident set size of this process.
+/// \return Resident set size in kilobytes, or 0 if it is not available.
+inline int64_t residentKb()
+{
+#ifndef _WIN32
+  std::ifstream statm("/proc/self/statm");
+  int64_t size = 0;
+  int64_t resident = 0;
+  if (statm >> size >> resident)
+  {
+    return resident * sysconf(_SC_PAGESIZE) / 1024;
+  }
+#endif
+  return 0;
+}
+
+/// \brief Get the peak resident set size of this process.
+/// \return Peak resident set size in kilobytes, or 0 if it is not available.
+inline int64_t peakResidentKb()
+{
+#ifndef _WIN32
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+  {
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+  }
+#endif
+  return 0;
+}
+
+/// \brief Reset the peak resident set size returned by highWaterResidentKb
+/// to the current resident set size. This is only supported on Linux.
+inline void resetPeakResident()
+{
+#ifdef __linux__
+  std::ofstream clearRefs("/proc/self/clear_refs");
+  clearRefs << "5";
+#endif
+}
+
+/// \brief Get the peak resident set size of this process since the last
+/// call to resetPeakResident. This is only supported on Linux.
+/// \return Peak resident set size in kilobytes, or 0 if it is not available.
+inline int64_t highWaterResidentKb()
+{
+#ifdef __linux__
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line))
+  {
+    if (line.compare(0, 6, "VmHWM:") == 0)
+    {
+      std::istringstream value(line.substr(6));
+      int64_t kb = 0;
+      if (value >> kb)
+        return kb;
+    }
+  }
+#endif
+  return 0;
+}
+
 } // namespace testing
 } // namespace sdf
 